@@ -1,5 +1,23 @@
 #include <tests/root.h>
 #include <complexities/list_analyzer.h>
+#include <complexities/linked_sort_analyzer.h>
+#include <complexities/sequence_traversal_analyzer.h>
+#include <complexities/sequence_search_analyzer.h>
+#include <complexities/hierarchy_traversal_analyzer.h>
+#include <complexities/hierarchy_fold_analyzer.h>
+#include <complexities/hierarchy_query_analyzer.h>
+#include <complexities/hierarchy_copy_analyzer.h>
+#include <complexities/network_snapshot_analyzer.h>
+#include <complexities/network_relation_analyzer.h>
+#include <complexities/network_copy_analyzer.h>
+#include <complexities/graph_search_analyzer.h>
+#include <complexities/graph_component_analyzer.h>
+#include <complexities/network_load_analyzer.h>
+#include <complexities/network_density_analyzer.h>
+#include <complexities/hash_table_analyzer.h>
+#include <complexities/priority_queue_analyzer.h>
+#include <complexities/hierarchy_walk_analyzer.h>
+#include <complexities/table_lookup_analyzer.h>
 
 #ifndef ANALYZER_OUTPUT
 #define ANALYZER_OUTPUT "."
@@ -16,6 +34,7 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests()
 
 	// TODO 02
 	mm->add_test(std::make_unique<ds::tests::CompactMemoryManagerTest>());
+	mm->add_test(std::make_unique<ds::tests::PooledMemoryManagerTest>());
 
 	// TODO 03
     amt->add_test(std::make_unique<ds::tests::ImplicitSequenceTest>());
@@ -25,10 +44,14 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests()
 
 	// TODO 05
 	 amt->add_test(std::make_unique<ds::tests::ImplicitHierarchyTest>());
+	 amt->add_test(std::make_unique<ds::tests::VebImplicitHierarchyTest>());
 
 	// TODO 06
 	amt->add_test(std::make_unique<ds::tests::ExplicitHierarchyTest>());
     amt->add_test(std::make_unique<ds::tests::HierarchyTest>());
+    amt->add_test(std::make_unique<ds::tests::AncestorIndexTest>());
+    amt->add_test(std::make_unique<ds::tests::SuccinctHierarchyTest>());
+    amt->add_test(std::make_unique<ds::tests::NetworkTest>());
 
 	// TODO 07
 	// adt->add_test(std::make_unique<ds::tests::ListTest>());
@@ -41,16 +64,25 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests()
 
 	// TODO 09
 	// adt->add_test(std::make_unique<ds::tests::SequenceTableTest>());
+	adt->add_test(std::make_unique<ds::tests::SortedSequenceTableTestFreeze>());
 
     // TODO 11
 	// adt->add_test(std::make_unique<ds::tests::NonSequenceTableTest>());
+	adt->add_test(std::make_unique<ds::tests::FlatHashTableTest>());
+	adt->add_test(std::make_unique<ds::tests::BinarySearchTreeTestRotations<ds::adt::BinarySearchTree<int, int>>>("rotations"));
+	adt->add_test(std::make_unique<ds::tests::BinarySearchTreeTestRotations<ds::adt::ThreadedBinarySearchTree<int, int>>>("threaded-rotations"));
 
 	// TODO 12
 	// adt->add_test(std::make_unique<ds::tests::SortTest>());
+	auto seeder = std::mt19937_64(247);
+	auto const bigNs = { 1,2,3,10'000 };
+	adt->add_test(std::make_unique<ds::tests::LinkedMergeSortTest>(seeder, bigNs));
+	adt->add_test(std::make_unique<ds::tests::DisjointSetsTest>());
 
 	root->add_test(std::move(mm));
 	root->add_test(std::move(amt));
 	root->add_test(std::move(adt));
+	root->add_test(std::make_unique<ds::tests::GraphTest>());
 	std::vector<std::unique_ptr<ds::tests::Test>> tests;
 	tests.emplace_back(std::move(root));
 	return tests;
@@ -62,6 +94,24 @@ std::vector<std::unique_ptr<ds::utils::Analyzer>> createAnalyzers()
 
     // TODO 01
     analyzers.emplace_back(std::make_unique<ds::utils::ListsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::LinkedSortsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::SequenceTraversalsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::SequenceSearchesAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::HierarchyTraversalsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::PriorityQueuesAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::HierarchyWalksAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::TableLookupsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::HierarchyFoldsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::HierarchyQueriesAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::HierarchyCopiesAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::NetworkSnapshotsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::NetworkRelationsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::NetworkCopiesAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::GraphSearchesAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::GraphComponentsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::NetworkLoadsAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::NetworkDensitiesAnalyzer>());
+    analyzers.emplace_back(std::make_unique<ds::utils::HashTablesAnalyzer>());
 
 	return analyzers;
 }
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <complexities/graph_search_analyzer.h>
+#include <libds/amt/csr_network.h>
+#include <libds/graph/connected_components.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes connected components of a synthetic power-law network.
+     *
+     * The network is the RMAT network of graph searches, so a step size of 10M and 10 steps reaches 100M relations.
+     * A thread count of 0 merges relations by disjoint sets without a pool, other thread counts run Afforest
+     * in a pool of that many threads; one analyzer is created per thread count, so the scaling is read across them.
+     */
+    class GraphComponentAnalyzer : public ComplexityAnalyzer<amt::CsrNetwork<int>>
+    {
+    public:
+        GraphComponentAnalyzer(const std::string& name, size_t threadCount);
+
+        void analyze() override;
+
+    protected:
+        void growToSize(amt::CsrNetwork<int>& structure, size_t size) override;
+        void executeOperation(amt::CsrNetwork<int>& structure) override;
+
+    private:
+        static const size_t EDGE_FACTOR = 16;
+
+        size_t threadCount_;
+        std::unique_ptr<WorkStealingPool> pool_;
+        std::mt19937_64 rng_;
+        size_t componentCount_;
+    };
+
+    /**
+     * @brief Container for all connected component analyzers, disjoint sets and Afforest from a single thread to all hardware threads.
+     */
+    class GraphComponentsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        GraphComponentsAnalyzer();
+    };
+
+    //----------
+
+    inline GraphComponentAnalyzer::GraphComponentAnalyzer(const std::string& name, size_t threadCount) :
+        ComplexityAnalyzer<amt::CsrNetwork<int>>(name),
+        threadCount_(threadCount),
+        pool_(nullptr),
+        rng_(144),
+        componentCount_(0)
+    {
+    }
+
+    inline void GraphComponentAnalyzer::analyze()
+    {
+        if (threadCount_ > 0)
+        {
+            pool_ = std::make_unique<WorkStealingPool>(threadCount_);
+        }
+        ComplexityAnalyzer<amt::CsrNetwork<int>>::analyze();
+        pool_.reset();
+    }
+
+    inline void GraphComponentAnalyzer::growToSize(amt::CsrNetwork<int>& structure, size_t size)
+    {
+        structure = details::makeRmatNetwork(size, EDGE_FACTOR, rng_);
+    }
+
+    inline void GraphComponentAnalyzer::executeOperation(amt::CsrNetwork<int>& structure)
+    {
+        componentCount_ += graph::connectedComponents(structure, pool_.get()).size();
+    }
+
+    //----------
+
+    inline GraphComponentsAnalyzer::GraphComponentsAnalyzer() :
+        CompositeAnalyzer("GraphComponents")
+    {
+        this->addAnalyzer(std::make_unique<GraphComponentAnalyzer>("union-find", 0));
+        const size_t maxThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; ++threadCount)
+        {
+            this->addAnalyzer(std::make_unique<GraphComponentAnalyzer>("afforest-threads-" + std::to_string(threadCount), threadCount));
+        }
+    }
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/csr_network.h>
+#include <libds/graph/breadth_first_search.h>
+#include <libds/graph/shortest_paths.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ds::utils
+{
+    namespace details
+    {
+        /**
+         * @brief RMAT network with the relation count and relationsPerNode relations per node, data of a node is its index.
+         *
+         * Every relation picks one quadrant of the adjacency matrix per bit of the node index with probabilities
+         * 0.57, 0.19, 0.19 and 0.05, loops are dropped. Indices are then shuffled so that hubs are not clustered
+         * at the start. The network is built directly in the compressed sparse row format.
+         */
+        inline amt::CsrNetwork<int> makeRmatNetwork(size_t relationCount, size_t relationsPerNode, std::mt19937_64& rng)
+        {
+            using IndexType = amt::CsrNetwork<int>::IndexType;
+
+            size_t scale = 1;
+            while ((size_t{ 1 } << scale) * relationsPerNode < relationCount)
+            {
+                ++scale;
+            }
+            const size_t nodeCount = size_t{ 1 } << scale;
+
+            std::vector<IndexType> permutation(nodeCount);
+            std::iota(permutation.begin(), permutation.end(), IndexType{ 0 });
+            std::shuffle(permutation.begin(), permutation.end(), rng);
+
+            // Quadrant thresholds of a 16-bit random number: a, a + b, a + b + c.
+            const std::uint64_t thresholds[] = { 37355, 49807, 62259 };
+            std::vector<std::pair<IndexType, IndexType>> relations;
+            relations.reserve(relationCount);
+            while (relations.size() < relationCount)
+            {
+                IndexType from = 0;
+                IndexType to = 0;
+                std::uint64_t bits = 0;
+                for (size_t level = 0; level < scale; ++level)
+                {
+                    if (level % 4 == 0)
+                    {
+                        bits = rng();
+                    }
+                    const std::uint64_t draw = (bits >> (16 * (level % 4))) & 0xFFFF;
+                    const IndexType quadrant = draw < thresholds[0] ? 0 : draw < thresholds[1] ? 1 : draw < thresholds[2] ? 2 : 3;
+                    from = (from << 1) | (quadrant >> 1);
+                    to = (to << 1) | (quadrant & 1);
+                }
+                if (from != to)
+                {
+                    relations.emplace_back(permutation[from], permutation[to]);
+                }
+            }
+
+            std::vector<size_t> offsets(nodeCount + 1, 0);
+            for (const auto& [from, to] : relations)
+            {
+                ++offsets[from + 1];
+                ++offsets[to + 1];
+            }
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            std::vector<IndexType> neighbours(offsets.back());
+            std::vector<size_t> positions(offsets.begin(), offsets.end() - 1);
+            for (const auto& [from, to] : relations)
+            {
+                neighbours[positions[from]++] = to;
+                neighbours[positions[to]++] = from;
+            }
+            relations = std::vector<std::pair<IndexType, IndexType>>();
+            positions = std::vector<size_t>();
+
+            std::vector<int> data(nodeCount);
+            std::iota(data.begin(), data.end(), 0);
+            return amt::CsrNetwork<int>(std::move(data), std::move(offsets), std::move(neighbours));
+        }
+    }
+
+    /**
+     * @brief Analyzes searches from a random node of a synthetic power-law network.
+     *
+     * The size is the number of relations of an RMAT network with EDGE_FACTOR relations per node, which is built
+     * directly in the compressed sparse row format, so a step size of 10M and 10 steps reaches 100M relations.
+     * The plain search is a top-down queue over the same snapshot, the baseline of the direction-optimizing one.
+     * Shortest paths weigh every relation from 1 to 64 by a hash of its nodes, A* has no heuristic on a network
+     * without coordinates, so it is Dijkstra that stops at a random target.
+     */
+    class GraphSearchAnalyzer : public ComplexityAnalyzer<amt::CsrNetwork<int>>
+    {
+    public:
+        enum class Method { PlainBfs, Bfs, Dijkstra, AStar };
+
+        GraphSearchAnalyzer(const std::string& name, Method method, size_t threadCount = 1);
+
+        void analyze() override;
+
+    protected:
+        void growToSize(amt::CsrNetwork<int>& structure, size_t size) override;
+        void executeOperation(amt::CsrNetwork<int>& structure) override;
+
+    private:
+        using BlockType = amt::MemoryBlock<int>;
+        using IndexType = amt::CsrNetwork<int>::IndexType;
+
+        static const size_t EDGE_FACTOR = 16;
+
+        size_t randomNode(const amt::CsrNetwork<int>& structure);
+
+        Method method_;
+        size_t threadCount_;
+        std::unique_ptr<WorkStealingPool> pool_;
+        std::mt19937_64 rng_;
+        size_t source_;
+        size_t target_;
+        std::vector<IndexType> queue_;
+        std::vector<IndexType> distances_;
+        graph::BreadthFirstSearch search_;
+        graph::ShortestPaths<std::uint32_t> paths_;
+        size_t reached_;
+    };
+
+    /**
+     * @brief Container for all graph search analyzers, parallel searches from a single thread to all hardware threads.
+     */
+    class GraphSearchesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        GraphSearchesAnalyzer();
+    };
+
+    //----------
+
+    inline GraphSearchAnalyzer::GraphSearchAnalyzer(const std::string& name, Method method, size_t threadCount) :
+        ComplexityAnalyzer<amt::CsrNetwork<int>>(name),
+        method_(method),
+        threadCount_(threadCount),
+        pool_(nullptr),
+        rng_(144),
+        source_(0),
+        target_(0),
+        reached_(0)
+    {
+        this->registerBeforeOperation([this](amt::CsrNetwork<int>& structure)
+            {
+                source_ = this->randomNode(structure);
+                target_ = this->randomNode(structure);
+            });
+    }
+
+    inline void GraphSearchAnalyzer::analyze()
+    {
+        // Only parallel searches start a pool, one thread searches without it.
+        if (threadCount_ > 1)
+        {
+            pool_ = std::make_unique<WorkStealingPool>(threadCount_);
+        }
+        ComplexityAnalyzer<amt::CsrNetwork<int>>::analyze();
+        pool_.reset();
+    }
+
+    inline void GraphSearchAnalyzer::growToSize(amt::CsrNetwork<int>& structure, size_t size)
+    {
+        structure = details::makeRmatNetwork(size, EDGE_FACTOR, rng_);
+    }
+
+    inline void GraphSearchAnalyzer::executeOperation(amt::CsrNetwork<int>& structure)
+    {
+        auto weight = [](const BlockType& from, const BlockType& to)
+            {
+                const std::uint32_t hash = static_cast<std::uint32_t>(from.data_ ^ to.data_) * 0x9E3779B1u;
+                return 1 + (hash >> 26);
+            };
+
+        switch (method_)
+        {
+            case Method::PlainBfs:
+            {
+                const BlockType* nodes = structure.accessNodeFromGate(0);
+                distances_.assign(structure.size(), graph::BreadthFirstSearch::UNREACHED);
+                queue_.clear();
+                queue_.push_back(static_cast<IndexType>(source_));
+                distances_[source_] = 0;
+                for (size_t head = 0; head < queue_.size(); ++head)
+                {
+                    const IndexType node = queue_[head];
+                    const IndexType* last = structure.endNeighbours(nodes[node]);
+                    for (const IndexType* neighbour = structure.beginNeighbours(nodes[node]); neighbour != last; ++neighbour)
+                    {
+                        if (distances_[*neighbour] == graph::BreadthFirstSearch::UNREACHED)
+                        {
+                            distances_[*neighbour] = distances_[node] + 1;
+                            queue_.push_back(*neighbour);
+                        }
+                    }
+                }
+                reached_ += queue_.size();
+                break;
+            }
+            case Method::Bfs:
+                search_.run(structure, source_, pool_.get());
+                reached_ += search_.reachedCount();
+                break;
+            case Method::Dijkstra:
+                paths_.dijkstra(structure, source_, weight);
+                reached_ += paths_.settledCount();
+                break;
+            case Method::AStar:
+                paths_.aStar(structure, source_, target_, weight, [](const BlockType&) { return std::uint32_t{ 0 }; });
+                reached_ += paths_.settledCount();
+                break;
+        }
+    }
+
+    inline size_t GraphSearchAnalyzer::randomNode(const amt::CsrNetwork<int>& structure)
+    {
+        // Searches from isolated nodes end at once, so only related nodes are picked.
+        size_t node = rng_() % structure.size();
+        while (structure.degree(*structure.accessNodeFromGate(node)) == 0)
+        {
+            node = rng_() % structure.size();
+        }
+        return node;
+    }
+
+    //----------
+
+    inline GraphSearchesAnalyzer::GraphSearchesAnalyzer() :
+        CompositeAnalyzer("GraphSearches")
+    {
+        this->addAnalyzer(std::make_unique<GraphSearchAnalyzer>("plain-bfs", GraphSearchAnalyzer::Method::PlainBfs));
+        const size_t maxThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; ++threadCount)
+        {
+            this->addAnalyzer(std::make_unique<GraphSearchAnalyzer>("bfs-threads-" + std::to_string(threadCount), GraphSearchAnalyzer::Method::Bfs, threadCount));
+        }
+        this->addAnalyzer(std::make_unique<GraphSearchAnalyzer>("dijkstra", GraphSearchAnalyzer::Method::Dijkstra));
+        this->addAnalyzer(std::make_unique<GraphSearchAnalyzer>("a-star", GraphSearchAnalyzer::Method::AStar));
+    }
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/table.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a batch of inserts or of random lookups in a hash table.
+     *
+     * The i-th key is i multiplied by an odd constant modulo 2^32, so keys are distinct and not consecutive.
+     * Inserts add the next keys to the table, including any rehash they cause, lookups hit half of the time.
+     * Keys up to 100M need a step size of 10M and 10 steps, with a step size of 1K the table stays in caches.
+     * The chained HashTable is left out while its operations are not implemented.
+     */
+    template<class TableType>
+    class HashTableAnalyzer : public ComplexityAnalyzer<TableType>
+    {
+    public:
+        enum class Operation { Insert, Lookup };
+
+        HashTableAnalyzer(const std::string& name, Operation operation);
+
+    protected:
+        void growToSize(TableType& structure, size_t size) override;
+        void executeOperation(TableType& structure) override;
+
+    private:
+        static const size_t BATCH_SIZE = 1000;
+
+        static int keyAt(size_t index);
+        static void insertKey(TableType& structure, size_t index);
+        static bool containsKey(const TableType& structure, size_t index);
+
+        Operation operation_;
+        std::default_random_engine rngIndex_;
+        size_t found_;
+    };
+
+    /**
+     * @brief Container for all hash table analyzers.
+     */
+    class HashTablesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HashTablesAnalyzer();
+    };
+
+    //----------
+
+    template<class TableType>
+    HashTableAnalyzer<TableType>::HashTableAnalyzer(const std::string& name, Operation operation) :
+        ComplexityAnalyzer<TableType>(name),
+        operation_(operation),
+        rngIndex_(144),
+        found_(0)
+    {
+    }
+
+    template<class TableType>
+    void HashTableAnalyzer<TableType>::growToSize(TableType& structure, size_t size)
+    {
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            insertKey(structure, i);
+        }
+    }
+
+    template<class TableType>
+    void HashTableAnalyzer<TableType>::executeOperation(TableType& structure)
+    {
+        const size_t size = structure.size();
+        switch (operation_)
+        {
+            case Operation::Insert:
+                for (size_t i = size; i < size + BATCH_SIZE; ++i)
+                {
+                    insertKey(structure, i);
+                }
+                break;
+            case Operation::Lookup:
+            {
+                std::uniform_int_distribution<size_t> indexDist(0, 2 * size);
+                for (size_t i = 0; i < BATCH_SIZE; ++i)
+                {
+                    found_ += containsKey(structure, indexDist(rngIndex_)) ? 1 : 0;
+                }
+                break;
+            }
+        }
+    }
+
+    template<class TableType>
+    int HashTableAnalyzer<TableType>::keyAt(size_t index)
+    {
+        return static_cast<int>(static_cast<std::uint32_t>(index) * 2654435761u);
+    }
+
+    template<class TableType>
+    void HashTableAnalyzer<TableType>::insertKey(TableType& structure, size_t index)
+    {
+        if constexpr (std::is_base_of_v<adt::Table<int, int>, TableType>)
+        {
+            structure.insert(keyAt(index), static_cast<int>(index));
+        }
+        else
+        {
+            structure.emplace(keyAt(index), static_cast<int>(index));
+        }
+    }
+
+    template<class TableType>
+    bool HashTableAnalyzer<TableType>::containsKey(const TableType& structure, size_t index)
+    {
+        if constexpr (std::is_base_of_v<adt::Table<int, int>, TableType>)
+        {
+            return structure.contains(keyAt(index));
+        }
+        else
+        {
+            return structure.find(keyAt(index)) != structure.end();
+        }
+    }
+
+    //----------
+
+    inline HashTablesAnalyzer::HashTablesAnalyzer() :
+        CompositeAnalyzer("HashTables")
+    {
+        using FlatAnalyzer = HashTableAnalyzer<adt::FlatHashTable<int, int>>;
+        using StdAnalyzer = HashTableAnalyzer<std::unordered_map<int, int>>;
+        this->addAnalyzer(std::make_unique<FlatAnalyzer>("flat-insert", FlatAnalyzer::Operation::Insert));
+        this->addAnalyzer(std::make_unique<StdAnalyzer>("std-insert", StdAnalyzer::Operation::Insert));
+        this->addAnalyzer(std::make_unique<FlatAnalyzer>("flat-lookup", FlatAnalyzer::Operation::Lookup));
+        this->addAnalyzer(std::make_unique<StdAnalyzer>("std-lookup", StdAnalyzer::Operation::Lookup));
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <libds/work_stealing_pool.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a copy of a whole explicit hierarchy, node by node or as a contiguous clone.
+     *
+     * The hierarchy is grown by random descents, a binary one into a random binary search tree shape.
+     * The copy is destroyed outside of the measurement. A replication count of 1 with a step size of 5M
+     * and 10 steps covers 5M to 50M nodes.
+     */
+    template<class HierarchyType>
+    class HierarchyCopyAnalyzer : public ComplexityAnalyzer<HierarchyType>
+    {
+    public:
+        enum class Method { Copy, Clone, ParallelClone };
+
+        HierarchyCopyAnalyzer(const std::string& name, Method method);
+
+        void analyze() override;
+
+    protected:
+        void growToSize(HierarchyType& structure, size_t size) override;
+        void executeOperation(HierarchyType& structure) override;
+
+    private:
+        using BlockType = typename HierarchyType::BlockType;
+
+        Method method_;
+        std::unique_ptr<WorkStealingPool> pool_;
+        std::unique_ptr<HierarchyType> copy_;
+        std::default_random_engine rng_;
+    };
+
+    /**
+     * @brief Container for all hierarchy copy analyzers.
+     */
+    class HierarchyCopiesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HierarchyCopiesAnalyzer();
+    };
+
+    //----------
+
+    template<class HierarchyType>
+    HierarchyCopyAnalyzer<HierarchyType>::HierarchyCopyAnalyzer(const std::string& name, Method method) :
+        ComplexityAnalyzer<HierarchyType>(name),
+        method_(method),
+        pool_(nullptr),
+        copy_(nullptr),
+        rng_(144)
+    {
+        this->registerAfterOperation([this](HierarchyType&)
+            {
+                copy_.reset();
+            });
+    }
+
+    template<class HierarchyType>
+    void HierarchyCopyAnalyzer<HierarchyType>::analyze()
+    {
+        if (method_ == Method::ParallelClone)
+        {
+            pool_ = std::make_unique<WorkStealingPool>();
+        }
+        ComplexityAnalyzer<HierarchyType>::analyze();
+        pool_.reset();
+    }
+
+    template<class HierarchyType>
+    void HierarchyCopyAnalyzer<HierarchyType>::growToSize(HierarchyType& structure, size_t size)
+    {
+        // Size of an explicit hierarchy is counted by a traversal, so it is queried only once.
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            const int data = static_cast<int>(rng_());
+            BlockType* node = structure.accessRoot();
+            if (node == nullptr)
+            {
+                structure.emplaceRoot().data_ = data;
+                continue;
+            }
+
+            if constexpr (std::is_same_v<HierarchyType, amt::BinaryEH<int>>)
+            {
+                size_t sonOrder = rng_() % 2;
+                for (BlockType* son = structure.accessSon(*node, sonOrder); son != nullptr; son = structure.accessSon(*node, sonOrder))
+                {
+                    node = son;
+                    sonOrder = rng_() % 2;
+                }
+                structure.emplaceSon(*node, sonOrder).data_ = data;
+            }
+            else
+            {
+                size_t degree = structure.degree(*node);
+                size_t choice = rng_() % (degree + 2);
+                while (choice < degree)
+                {
+                    node = structure.accessSon(*node, choice);
+                    degree = structure.degree(*node);
+                    choice = rng_() % (degree + 2);
+                }
+                structure.emplaceSon(*node, degree).data_ = data;
+            }
+        }
+    }
+
+    template<class HierarchyType>
+    void HierarchyCopyAnalyzer<HierarchyType>::executeOperation(HierarchyType& structure)
+    {
+        switch (method_)
+        {
+            case Method::Copy:
+                copy_.reset(new HierarchyType(structure));
+                break;
+            case Method::Clone:
+                copy_.reset(new HierarchyType(structure.clone()));
+                break;
+            case Method::ParallelClone:
+                copy_.reset(new HierarchyType(structure.clone(pool_.get())));
+                break;
+        }
+    }
+
+    //----------
+
+    inline HierarchyCopiesAnalyzer::HierarchyCopiesAnalyzer() :
+        CompositeAnalyzer("HierarchyCopies")
+    {
+        using BinaryAnalyzer = HierarchyCopyAnalyzer<amt::BinaryEH<int>>;
+        using MultiWayAnalyzer = HierarchyCopyAnalyzer<amt::MultiWayEH<int>>;
+        this->addAnalyzer(std::make_unique<BinaryAnalyzer>("binary-copy", BinaryAnalyzer::Method::Copy));
+        this->addAnalyzer(std::make_unique<BinaryAnalyzer>("binary-clone", BinaryAnalyzer::Method::Clone));
+        this->addAnalyzer(std::make_unique<BinaryAnalyzer>("binary-parallel-clone", BinaryAnalyzer::Method::ParallelClone));
+        this->addAnalyzer(std::make_unique<MultiWayAnalyzer>("multiway-copy", MultiWayAnalyzer::Method::Copy));
+        this->addAnalyzer(std::make_unique<MultiWayAnalyzer>("multiway-clone", MultiWayAnalyzer::Method::Clone));
+        this->addAnalyzer(std::make_unique<MultiWayAnalyzer>("multiway-parallel-clone", MultiWayAnalyzer::Method::ParallelClone));
+    }
+}
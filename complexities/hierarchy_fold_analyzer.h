@@ -0,0 +1,113 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a parallel fold (sum of all data) over a whole multi-way hierarchy.
+     *
+     * The hierarchy is the one used by adt::MultiwayTree, grown by random descents.
+     * One analyzer is created per thread count, so the scaling is read across the analyzers;
+     * a step size of 1M with 10 steps ends at 10M nodes.
+     */
+    class HierarchyFoldAnalyzer : public ComplexityAnalyzer<amt::MultiWayEH<int>>
+    {
+    public:
+        HierarchyFoldAnalyzer(const std::string& name, size_t threadCount);
+
+        void analyze() override;
+
+    protected:
+        void growToSize(amt::MultiWayEH<int>& structure, size_t size) override;
+        void executeOperation(amt::MultiWayEH<int>& structure) override;
+
+    private:
+        using BlockType = amt::MultiWayEH<int>::BlockType;
+
+        // The pool is started only for the analysis, so idle analyzers do not keep their threads.
+        std::unique_ptr<WorkStealingPool> pool_;
+        size_t threadCount_;
+        std::default_random_engine rng_;
+        long long sum_;
+    };
+
+    /**
+     * @brief Container for all hierarchy fold analyzers, from a single thread to all hardware threads.
+     */
+    class HierarchyFoldsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HierarchyFoldsAnalyzer();
+    };
+
+    //----------
+
+    inline HierarchyFoldAnalyzer::HierarchyFoldAnalyzer(const std::string& name, size_t threadCount) :
+        ComplexityAnalyzer<amt::MultiWayEH<int>>(name),
+        pool_(nullptr),
+        threadCount_(threadCount),
+        rng_(144),
+        sum_(0)
+    {
+    }
+
+    inline void HierarchyFoldAnalyzer::analyze()
+    {
+        pool_ = std::make_unique<WorkStealingPool>(threadCount_);
+        ComplexityAnalyzer<amt::MultiWayEH<int>>::analyze();
+        pool_.reset();
+    }
+
+    inline void HierarchyFoldAnalyzer::growToSize(amt::MultiWayEH<int>& structure, size_t size)
+    {
+        // Size of an explicit hierarchy is counted by a traversal, so it is queried only once.
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            const int data = static_cast<int>(rng_());
+            BlockType* node = structure.accessRoot();
+            if (node == nullptr)
+            {
+                structure.emplaceRoot().data_ = data;
+                continue;
+            }
+
+            size_t degree = structure.degree(*node);
+            size_t choice = rng_() % (degree + 2);
+            while (choice < degree)
+            {
+                node = structure.accessSon(*node, choice);
+                degree = structure.degree(*node);
+                choice = rng_() % (degree + 2);
+            }
+            structure.emplaceSon(*node, degree).data_ = data;
+        }
+    }
+
+    inline void HierarchyFoldAnalyzer::executeOperation(amt::MultiWayEH<int>& structure)
+    {
+        sum_ += structure.parallelFold(structure.accessRoot(),
+            [](const BlockType* b) { return static_cast<long long>(b->data_); },
+            [](long long a, long long b) { return a + b; },
+            *pool_);
+    }
+
+    //----------
+
+    inline HierarchyFoldsAnalyzer::HierarchyFoldsAnalyzer() :
+        CompositeAnalyzer("HierarchyFolds")
+    {
+        const size_t maxThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; ++threadCount)
+        {
+            this->addAnalyzer(std::make_unique<HierarchyFoldAnalyzer>("fold-threads-" + std::to_string(threadCount), threadCount));
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/ancestor_index.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a batch of lowest common ancestor queries over random pairs of nodes of a multi-way hierarchy.
+     *
+     * Queries are answered either by walking parents (levels included)
+     * or by the ancestor index, which is rebuilt outside of the measurement.
+     * Every third node deepens the hierarchy, so its height grows with its size.
+     */
+    class HierarchyQueryAnalyzer : public ComplexityAnalyzer<amt::MultiWayEH<int>>
+    {
+    public:
+        enum class Method { Walk, Index };
+
+        HierarchyQueryAnalyzer(const std::string& name, Method method);
+
+    protected:
+        void growToSize(amt::MultiWayEH<int>& structure, size_t size) override;
+        void executeOperation(amt::MultiWayEH<int>& structure) override;
+
+    private:
+        using BlockType = amt::MultiWayEH<int>::BlockType;
+
+        static const size_t BATCH_SIZE = 1000;
+
+        BlockType* walkLca(const amt::MultiWayEH<int>& structure, BlockType* first, BlockType* second) const;
+
+        Method method_;
+        std::default_random_engine rng_;
+        std::vector<BlockType*> nodes_;
+        std::unique_ptr<amt::AncestorIndex<BlockType>> index_;
+        size_t sum_;
+    };
+
+    /**
+     * @brief Container for all hierarchy query analyzers.
+     */
+    class HierarchyQueriesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HierarchyQueriesAnalyzer();
+    };
+
+    //----------
+
+    inline HierarchyQueryAnalyzer::HierarchyQueryAnalyzer(const std::string& name, Method method) :
+        ComplexityAnalyzer<amt::MultiWayEH<int>>(name),
+        method_(method),
+        rng_(144),
+        sum_(0)
+    {
+        if (method_ == Method::Index)
+        {
+            this->registerBeforeOperation([this](amt::MultiWayEH<int>& structure)
+                {
+                    index_ = std::make_unique<amt::AncestorIndex<BlockType>>(structure);
+                });
+            this->registerAfterOperation([this](amt::MultiWayEH<int>&)
+                {
+                    index_.reset();
+                });
+        }
+    }
+
+    inline void HierarchyQueryAnalyzer::growToSize(amt::MultiWayEH<int>& structure, size_t size)
+    {
+        // Every replication starts with an empty copy of the prototype.
+        if (structure.isEmpty())
+        {
+            nodes_.clear();
+            nodes_.push_back(&structure.emplaceRoot());
+        }
+
+        while (nodes_.size() < size)
+        {
+            BlockType* parent = nodes_.size() % 3 == 0 ? nodes_.back() : nodes_[rng_() % nodes_.size()];
+            nodes_.push_back(&structure.emplaceSon(*parent, structure.degree(*parent)));
+        }
+    }
+
+    inline void HierarchyQueryAnalyzer::executeOperation(amt::MultiWayEH<int>& structure)
+    {
+        for (size_t i = 0; i < BATCH_SIZE; ++i)
+        {
+            BlockType* first = nodes_[rng_() % nodes_.size()];
+            BlockType* second = nodes_[rng_() % nodes_.size()];
+            BlockType* ancestor = method_ == Method::Walk ? this->walkLca(structure, first, second) : index_->lca(*first, *second);
+            sum_ += reinterpret_cast<size_t>(ancestor);
+        }
+    }
+
+    inline auto HierarchyQueryAnalyzer::walkLca(const amt::MultiWayEH<int>& structure, BlockType* first, BlockType* second) const -> BlockType*
+    {
+        size_t firstLevel = structure.level(*first);
+        size_t secondLevel = structure.level(*second);
+        for (; firstLevel > secondLevel; --firstLevel)
+        {
+            first = structure.accessParent(*first);
+        }
+        for (; secondLevel > firstLevel; --secondLevel)
+        {
+            second = structure.accessParent(*second);
+        }
+        while (first != second)
+        {
+            first = structure.accessParent(*first);
+            second = structure.accessParent(*second);
+        }
+        return first;
+    }
+
+    //----------
+
+    inline HierarchyQueriesAnalyzer::HierarchyQueriesAnalyzer() :
+        CompositeAnalyzer("HierarchyQueries")
+    {
+        this->addAnalyzer(std::make_unique<HierarchyQueryAnalyzer>("walk-lca", HierarchyQueryAnalyzer::Method::Walk));
+        this->addAnalyzer(std::make_unique<HierarchyQueryAnalyzer>("index-lca", HierarchyQueryAnalyzer::Method::Index));
+    }
+}
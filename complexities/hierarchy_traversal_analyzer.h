@@ -0,0 +1,151 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <random>
+#include <type_traits>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes traversal of a whole explicit hierarchy.
+     *
+     * Binary hierarchies (plain and threaded) are grown as random binary search trees and traversed in-order,
+     * multi-way hierarchies (with a sequence of sons or with linked sons) are grown by random descents
+     * and traversed in pre-order.
+     * The traversal either uses the hierarchy iterator (range-for) or the callback processing.
+     */
+    template<class Hierarchy>
+    class HierarchyTraversalAnalyzer : public ComplexityAnalyzer<Hierarchy>
+    {
+    public:
+        enum class Traversal { Iterator, Callback };
+
+        HierarchyTraversalAnalyzer(const std::string& name, Traversal traversal);
+
+    protected:
+        void growToSize(Hierarchy& structure, size_t size) override;
+        void executeOperation(Hierarchy& structure) override;
+
+    private:
+        using BlockType = typename Hierarchy::BlockType;
+
+        static constexpr bool IS_BINARY = std::is_same_v<Hierarchy, amt::BinaryEH<int>> || std::is_same_v<Hierarchy, amt::ThreadedBinaryEH<int>>;
+
+        void insertRandomNode(Hierarchy& structure);
+
+        std::default_random_engine rng_;
+        Traversal traversal_;
+        long long sum_;
+    };
+
+    /**
+     * @brief Container for all hierarchy traversal analyzers.
+     */
+    class HierarchyTraversalsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HierarchyTraversalsAnalyzer();
+    };
+
+    //----------
+
+    template<class Hierarchy>
+    HierarchyTraversalAnalyzer<Hierarchy>::HierarchyTraversalAnalyzer(const std::string& name, Traversal traversal) :
+        ComplexityAnalyzer<Hierarchy>(name),
+        rng_(144),
+        traversal_(traversal),
+        sum_(0)
+    {
+    }
+
+    template<class Hierarchy>
+    void HierarchyTraversalAnalyzer<Hierarchy>::growToSize(Hierarchy& structure, size_t size)
+    {
+        // Size of an explicit hierarchy is counted by a traversal, so it is queried only once.
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            this->insertRandomNode(structure);
+        }
+    }
+
+    template<class Hierarchy>
+    void HierarchyTraversalAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        if (traversal_ == Traversal::Iterator)
+        {
+            for (int& data : structure)
+            {
+                sum_ += data;
+            }
+        }
+        else if constexpr (IS_BINARY)
+        {
+            structure.processInOrder(structure.accessRoot(), [this](const BlockType* b)
+                {
+                    sum_ += b->data_;
+                });
+        }
+        else
+        {
+            structure.processPreOrder(structure.accessRoot(), [this](const BlockType* b)
+                {
+                    sum_ += b->data_;
+                });
+        }
+    }
+
+    template<class Hierarchy>
+    void HierarchyTraversalAnalyzer<Hierarchy>::insertRandomNode(Hierarchy& structure)
+    {
+        const int data = static_cast<int>(rng_());
+        BlockType* node = structure.accessRoot();
+        if (node == nullptr)
+        {
+            structure.emplaceRoot().data_ = data;
+            return;
+        }
+
+        if constexpr (IS_BINARY)
+        {
+            BlockType* son = structure.accessSon(*node, data < node->data_ ? 0 : 1);
+            while (son != nullptr)
+            {
+                node = son;
+                son = structure.accessSon(*node, data < node->data_ ? 0 : 1);
+            }
+            structure.emplaceSon(*node, data < node->data_ ? 0 : 1).data_ = data;
+        }
+        else
+        {
+            size_t degree = structure.degree(*node);
+            size_t choice = rng_() % (degree + 2);
+            while (choice < degree)
+            {
+                node = structure.accessSon(*node, choice);
+                degree = structure.degree(*node);
+                choice = rng_() % (degree + 2);
+            }
+            structure.emplaceSon(*node, degree).data_ = data;
+        }
+    }
+
+    //----------
+
+    inline HierarchyTraversalsAnalyzer::HierarchyTraversalsAnalyzer() :
+        CompositeAnalyzer("HierarchyTraversals")
+    {
+        using BinaryAnalyzer = HierarchyTraversalAnalyzer<amt::BinaryEH<int>>;
+        using ThreadedAnalyzer = HierarchyTraversalAnalyzer<amt::ThreadedBinaryEH<int>>;
+        using MultiWayAnalyzer = HierarchyTraversalAnalyzer<amt::MultiWayEH<int>>;
+        using LinkedMultiWayAnalyzer = HierarchyTraversalAnalyzer<amt::LinkedMultiWayEH<int>>;
+        this->addAnalyzer(std::make_unique<BinaryAnalyzer>("beh-iterator", BinaryAnalyzer::Traversal::Iterator));
+        this->addAnalyzer(std::make_unique<BinaryAnalyzer>("beh-callback", BinaryAnalyzer::Traversal::Callback));
+        this->addAnalyzer(std::make_unique<ThreadedAnalyzer>("threaded-beh-iterator", ThreadedAnalyzer::Traversal::Iterator));
+        this->addAnalyzer(std::make_unique<ThreadedAnalyzer>("threaded-beh-callback", ThreadedAnalyzer::Traversal::Callback));
+        this->addAnalyzer(std::make_unique<MultiWayAnalyzer>("mweh-iterator", MultiWayAnalyzer::Traversal::Iterator));
+        this->addAnalyzer(std::make_unique<MultiWayAnalyzer>("mweh-callback", MultiWayAnalyzer::Traversal::Callback));
+        this->addAnalyzer(std::make_unique<LinkedMultiWayAnalyzer>("linked-mweh-iterator", LinkedMultiWayAnalyzer::Traversal::Iterator));
+        this->addAnalyzer(std::make_unique<LinkedMultiWayAnalyzer>("linked-mweh-callback", LinkedMultiWayAnalyzer::Traversal::Callback));
+    }
+}
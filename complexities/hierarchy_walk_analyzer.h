@@ -0,0 +1,101 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/implicit_hierarchy.h>
+#include <libds/amt/veb_implicit_hierarchy.h>
+#include <random>
+#include <type_traits>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes random root-to-leaf walks in a complete binary implicit hierarchy.
+     *
+     * Compares the breadth-first layout with the van Emde Boas layout,
+     * which is walked by its PathWalker.
+     * Differences show up once the hierarchy outgrows the caches, so step sizes
+     * of 1M and more are needed to see the RAM-bound end of the curve.
+     */
+    template<class Hierarchy>
+    class HierarchyWalkAnalyzer : public ComplexityAnalyzer<Hierarchy>
+    {
+    public:
+        explicit HierarchyWalkAnalyzer(const std::string& name);
+
+    protected:
+        void growToSize(Hierarchy& structure, size_t size) override;
+        void executeOperation(Hierarchy& structure) override;
+
+    private:
+        static const size_t WALK_COUNT = 1000;
+
+        std::default_random_engine rng_;
+        long long sum_;
+    };
+
+    /**
+     * @brief Container for all hierarchy walk analyzers.
+     */
+    class HierarchyWalksAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HierarchyWalksAnalyzer();
+    };
+
+    //----------
+
+    template<class Hierarchy>
+    HierarchyWalkAnalyzer<Hierarchy>::HierarchyWalkAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Hierarchy>(name),
+        rng_(144),
+        sum_(0)
+    {
+    }
+
+    template<class Hierarchy>
+    void HierarchyWalkAnalyzer<Hierarchy>::growToSize(Hierarchy& structure, size_t size)
+    {
+        while (structure.size() < size)
+        {
+            structure.insertLastLeaf().data_ = static_cast<int>(rng_());
+        }
+    }
+
+    template<class Hierarchy>
+    void HierarchyWalkAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        for (size_t walk = 0; walk < WALK_COUNT; ++walk)
+        {
+            size_t path = rng_();
+            if constexpr (std::is_same_v<Hierarchy, amt::VebIH<int>>)
+            {
+                typename Hierarchy::PathWalker walker(structure);
+                sum_ += walker.accessCurrent()->data_;
+                while (walker.goToSon(path & 1))
+                {
+                    sum_ += walker.accessCurrent()->data_;
+                    path >>= 1;
+                }
+            }
+            else
+            {
+                amt::MemoryBlock<int>* node = structure.accessRoot();
+                while (node != nullptr)
+                {
+                    sum_ += node->data_;
+                    node = structure.accessSon(*node, path & 1);
+                    path >>= 1;
+                }
+            }
+        }
+    }
+
+    //----------
+
+    inline HierarchyWalksAnalyzer::HierarchyWalksAnalyzer() :
+        CompositeAnalyzer("HierarchyWalks")
+    {
+        this->addAnalyzer(std::make_unique<HierarchyWalkAnalyzer<amt::BinaryIH<int>>>("bfs-walk"));
+        this->addAnalyzer(std::make_unique<HierarchyWalkAnalyzer<amt::VebIH<int>>>("veb-walk"));
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/sorts.h>
+#include <libds/amt/explicit_sequence.h>
+#include <libds/amt/implicit_sequence.h>
+#include <random>
+
+namespace ds::utils
+{
+    /**
+     * @brief Common base for analyzers of sorting a linked sequence.
+     */
+    template<class Sequence>
+    class LinkedSortAnalyzer : public ComplexityAnalyzer<Sequence>
+    {
+    protected:
+        explicit LinkedSortAnalyzer(const std::string& name);
+
+    protected:
+        void growToSize(Sequence& structure, size_t size) override;
+
+    private:
+        std::default_random_engine rngData_;
+    };
+
+    /**
+     * @brief Analyzes in-place merge sort that relinks the blocks.
+     */
+    template<class Sequence>
+    class LinkedMergeSortAnalyzer : public LinkedSortAnalyzer<Sequence>
+    {
+    public:
+        explicit LinkedMergeSortAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes copying into an implicit sequence, quick sort and copying back.
+     */
+    template<class Sequence>
+    class CopyQuickSortAnalyzer : public LinkedSortAnalyzer<Sequence>
+    {
+    public:
+        explicit CopyQuickSortAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Container for all linked sort analyzers.
+     */
+    class LinkedSortsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        LinkedSortsAnalyzer();
+    };
+
+    //----------
+
+    template<class Sequence>
+    LinkedSortAnalyzer<Sequence>::LinkedSortAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Sequence>(name),
+        rngData_(144)
+    {
+        // Each measurement sorts fresh random data, the blocks stay where the previous sort left them.
+        this->registerBeforeOperation([&](Sequence& sequence)
+            {
+                sequence.processAllBlocksForward([&](typename Sequence::BlockType* b)
+                    {
+                        b->data_ = static_cast<int>(rngData_());
+                    });
+            }
+        );
+    }
+
+    template<class Sequence>
+    void LinkedSortAnalyzer<Sequence>::growToSize(Sequence& structure, size_t size)
+    {
+        while (structure.size() < size)
+        {
+            structure.insertLast().data_ = static_cast<int>(rngData_());
+        }
+    }
+
+    //----------
+
+    template<class Sequence>
+    LinkedMergeSortAnalyzer<Sequence>::LinkedMergeSortAnalyzer(const std::string& name) :
+        LinkedSortAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void LinkedMergeSortAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        adt::LinkedMergeSort<int>().sort(structure);
+    }
+
+    //----------
+
+    template<class Sequence>
+    CopyQuickSortAnalyzer<Sequence>::CopyQuickSortAnalyzer(const std::string& name) :
+        LinkedSortAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void CopyQuickSortAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        amt::ImplicitSequence<int> is(structure.size(), false);
+        structure.processAllBlocksForward([&is](typename Sequence::BlockType* b)
+            {
+                is.insertLast().data_ = b->data_;
+            });
+
+        adt::QuickSort<int>().sort(is, [](const int& a, const int& b) { return a < b; });
+
+        size_t index = 0;
+        structure.processAllBlocksForward([&is, &index](typename Sequence::BlockType* b)
+            {
+                b->data_ = is.access(index++)->data_;
+            });
+    }
+
+    //----------
+
+    inline LinkedSortsAnalyzer::LinkedSortsAnalyzer() :
+        CompositeAnalyzer("LinkedSorts")
+    {
+        this->addAnalyzer(std::make_unique<LinkedMergeSortAnalyzer<amt::SinglyLS<int>>>("singly-linked-merge-sort"));
+        this->addAnalyzer(std::make_unique<LinkedMergeSortAnalyzer<amt::DoublyLS<int>>>("doubly-linked-merge-sort"));
+        this->addAnalyzer(std::make_unique<CopyQuickSortAnalyzer<amt::SinglyLS<int>>>("singly-copy-quick-sort"));
+        this->addAnalyzer(std::make_unique<CopyQuickSortAnalyzer<amt::DoublyLS<int>>>("doubly-copy-quick-sort"));
+    }
+}
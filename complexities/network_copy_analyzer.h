@@ -0,0 +1,134 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_network.h>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a copy of a whole network or a removal of a batch of its random nodes.
+     *
+     * The size is the number of nodes, every node is connected to EDGES_PER_NODE random nodes when inserted.
+     * Copies are destroyed outside of the measurement, removed nodes are replaced when the network grows.
+     * A replication count of 1 with a step size of 100k and 10 steps reaches 1M nodes.
+     */
+    template<class NetworkType>
+    class NetworkCopyAnalyzer : public ComplexityAnalyzer<NetworkType>
+    {
+    public:
+        enum class Operation { Copy, Remove };
+
+        NetworkCopyAnalyzer(const std::string& name, Operation operation);
+
+    protected:
+        void growToSize(NetworkType& structure, size_t size) override;
+        void executeOperation(NetworkType& structure) override;
+
+    private:
+        using BlockType = typename NetworkType::NodeType;
+
+        static const size_t EDGES_PER_NODE = 4;
+        static const size_t BATCH_SIZE = 100;
+
+        Operation operation_;
+        std::default_random_engine rng_;
+        // Data of a node is its position here.
+        std::vector<BlockType*> nodes_;
+        std::vector<BlockType*> removedNodes_;
+        std::unique_ptr<NetworkType> copy_;
+    };
+
+    /**
+     * @brief Container for all network copy analyzers.
+     */
+    class NetworkCopiesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        NetworkCopiesAnalyzer();
+    };
+
+    //----------
+
+    template<class NetworkType>
+    NetworkCopyAnalyzer<NetworkType>::NetworkCopyAnalyzer(const std::string& name, Operation operation) :
+        ComplexityAnalyzer<NetworkType>(name),
+        operation_(operation),
+        rng_(144)
+    {
+        if (operation_ == Operation::Remove)
+        {
+            this->registerBeforeOperation([this](NetworkType&)
+                {
+                    // Random nodes are moved to the back of the nodes and taken from there.
+                    removedNodes_.clear();
+                    while (removedNodes_.size() < BATCH_SIZE && !nodes_.empty())
+                    {
+                        const size_t position = rng_() % nodes_.size();
+                        std::swap(nodes_[position], nodes_.back());
+                        nodes_[position]->data_ = static_cast<int>(position);
+                        removedNodes_.push_back(nodes_.back());
+                        nodes_.pop_back();
+                    }
+                });
+        }
+        this->registerAfterOperation([this](NetworkType&)
+            {
+                copy_.reset();
+            });
+    }
+
+    template<class NetworkType>
+    void NetworkCopyAnalyzer<NetworkType>::growToSize(NetworkType& structure, size_t size)
+    {
+        // Every replication starts with an empty copy of the prototype.
+        if (structure.isEmpty())
+        {
+            nodes_.clear();
+        }
+
+        while (structure.size() < size)
+        {
+            BlockType& node = structure.insert();
+            node.data_ = static_cast<int>(nodes_.size());
+            nodes_.push_back(&node);
+            for (size_t i = 0; i < EDGES_PER_NODE; ++i)
+            {
+                structure.connect(node, *nodes_[rng_() % nodes_.size()]);
+            }
+        }
+    }
+
+    template<class NetworkType>
+    void NetworkCopyAnalyzer<NetworkType>::executeOperation(NetworkType& structure)
+    {
+        switch (operation_)
+        {
+            case Operation::Copy:
+                copy_ = std::make_unique<NetworkType>(structure);
+                break;
+            case Operation::Remove:
+                for (BlockType* node : removedNodes_)
+                {
+                    structure.remove(node);
+                }
+                break;
+        }
+    }
+
+    //----------
+
+    inline NetworkCopiesAnalyzer::NetworkCopiesAnalyzer() :
+        CompositeAnalyzer("NetworkCopies")
+    {
+        using ImplicitAnalyzer = NetworkCopyAnalyzer<amt::IGIRNetwork<int>>;
+        using ExplicitAnalyzer = NetworkCopyAnalyzer<amt::EGERNetwork<int>>;
+        this->addAnalyzer(std::make_unique<ImplicitAnalyzer>("implicit-copy", ImplicitAnalyzer::Operation::Copy));
+        this->addAnalyzer(std::make_unique<ImplicitAnalyzer>("implicit-remove", ImplicitAnalyzer::Operation::Remove));
+        this->addAnalyzer(std::make_unique<ExplicitAnalyzer>("explicit-copy", ExplicitAnalyzer::Operation::Copy));
+        this->addAnalyzer(std::make_unique<ExplicitAnalyzer>("explicit-remove", ExplicitAnalyzer::Operation::Remove));
+    }
+}
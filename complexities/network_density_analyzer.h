@@ -0,0 +1,174 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/bit_matrix_network.h>
+#include <libds/amt/explicit_network.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes queries of relations and counting of triangles of a network with a growing density.
+     *
+     * The network has NODE_COUNT nodes and the size is the number of its relations, added in a random order
+     * of all pairs of distinct nodes, so a step size of 26k and 20 steps go from 5 % to almost full density.
+     * Queries ask QUERY_COUNT random pairs, triangles are counted by ANDs of rows in a bit matrix and by marks
+     * of the neighbours of a node and a scan of the relations of its higher neighbours in relation lists.
+     */
+    template<class NetworkType>
+    class NetworkDensityAnalyzer : public ComplexityAnalyzer<NetworkType>
+    {
+    public:
+        enum class Operation { Exists, Triangles };
+
+        NetworkDensityAnalyzer(const std::string& name, Operation operation);
+
+    protected:
+        void growToSize(NetworkType& structure, size_t size) override;
+        void executeOperation(NetworkType& structure) override;
+
+    private:
+        using BlockType = typename NetworkType::NodeType;
+
+        static const size_t NODE_COUNT = 1024;
+        static const size_t QUERY_COUNT = 100000;
+
+        size_t countTriangles(NetworkType& structure);
+
+        Operation operation_;
+        std::default_random_engine rng_;
+        std::vector<std::pair<size_t, size_t>> pairs_;
+        size_t connected_;
+        std::vector<std::pair<size_t, size_t>> queries_;
+        std::vector<bool> marks_;
+        size_t result_;
+    };
+
+    /**
+     * @brief Container for all network density analyzers.
+     */
+    class NetworkDensitiesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        NetworkDensitiesAnalyzer();
+    };
+
+    //----------
+
+    template<class NetworkType>
+    NetworkDensityAnalyzer<NetworkType>::NetworkDensityAnalyzer(const std::string& name, Operation operation) :
+        ComplexityAnalyzer<NetworkType>(name),
+        operation_(operation),
+        rng_(144),
+        connected_(0),
+        result_(0)
+    {
+        if (operation_ == Operation::Exists)
+        {
+            this->registerBeforeOperation([this](NetworkType&)
+                {
+                    queries_.clear();
+                    for (size_t i = 0; i < QUERY_COUNT; ++i)
+                    {
+                        queries_.emplace_back(rng_() % NODE_COUNT, rng_() % NODE_COUNT);
+                    }
+                });
+        }
+    }
+
+    template<class NetworkType>
+    void NetworkDensityAnalyzer<NetworkType>::growToSize(NetworkType& structure, size_t size)
+    {
+        // Every replication starts with an empty copy of the prototype and a new order of pairs.
+        if (structure.isEmpty())
+        {
+            for (size_t i = 0; i < NODE_COUNT; ++i)
+            {
+                structure.insert().data_ = static_cast<int>(i);
+            }
+            pairs_.clear();
+            for (size_t a = 0; a < NODE_COUNT; ++a)
+            {
+                for (size_t b = a + 1; b < NODE_COUNT; ++b)
+                {
+                    pairs_.emplace_back(a, b);
+                }
+            }
+            std::shuffle(pairs_.begin(), pairs_.end(), rng_);
+            connected_ = 0;
+        }
+
+        for (; connected_ < std::min(size, pairs_.size()); ++connected_)
+        {
+            structure.connect(*structure.accessNodeFromGate(pairs_[connected_].first), *structure.accessNodeFromGate(pairs_[connected_].second));
+        }
+    }
+
+    template<class NetworkType>
+    void NetworkDensityAnalyzer<NetworkType>::executeOperation(NetworkType& structure)
+    {
+        switch (operation_)
+        {
+            case Operation::Exists:
+                for (const auto& [a, b] : queries_)
+                {
+                    result_ += structure.relationExists(*structure.accessNodeFromGate(a), *structure.accessNodeFromGate(b)) ? 1 : 0;
+                }
+                break;
+            case Operation::Triangles:
+                result_ += this->countTriangles(structure);
+                break;
+        }
+    }
+
+    template<class NetworkType>
+    size_t NetworkDensityAnalyzer<NetworkType>::countTriangles(NetworkType& structure)
+    {
+        if constexpr (std::is_same_v<NetworkType, amt::BitMatrixNetwork<int>>)
+        {
+            return structure.triangleCount();
+        }
+        else
+        {
+            size_t result = 0;
+            marks_.assign(structure.size(), false);
+            for (size_t u = 0; u < structure.size(); ++u)
+            {
+                BlockType* nodeU = structure.accessNodeFromGate(u);
+                nodeU->relations_->processAllBlocksForward([this](auto* b) { marks_[b->data_->gateIndex_] = true; });
+                nodeU->relations_->processAllBlocksForward([this, &result, u](auto* b)
+                    {
+                        const size_t v = b->data_->gateIndex_;
+                        if (v > u)
+                        {
+                            b->data_->relations_->processAllBlocksForward([this, &result, v](auto* c)
+                                {
+                                    result += c->data_->gateIndex_ > v && marks_[c->data_->gateIndex_] ? 1 : 0;
+                                });
+                        }
+                    });
+                nodeU->relations_->processAllBlocksForward([this](auto* b) { marks_[b->data_->gateIndex_] = false; });
+            }
+            return result;
+        }
+    }
+
+    //----------
+
+    inline NetworkDensitiesAnalyzer::NetworkDensitiesAnalyzer() :
+        CompositeAnalyzer("NetworkDensities")
+    {
+        using MatrixAnalyzer = NetworkDensityAnalyzer<amt::BitMatrixNetwork<int>>;
+        using ListAnalyzer = NetworkDensityAnalyzer<amt::IGIRNetwork<int>>;
+        this->addAnalyzer(std::make_unique<MatrixAnalyzer>("bit-matrix-exists", MatrixAnalyzer::Operation::Exists));
+        this->addAnalyzer(std::make_unique<ListAnalyzer>("implicit-exists", ListAnalyzer::Operation::Exists));
+        this->addAnalyzer(std::make_unique<MatrixAnalyzer>("bit-matrix-triangles", MatrixAnalyzer::Operation::Triangles));
+        this->addAnalyzer(std::make_unique<ListAnalyzer>("implicit-triangles", ListAnalyzer::Operation::Triangles));
+    }
+}
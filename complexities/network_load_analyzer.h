@@ -0,0 +1,251 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <complexities/graph_search_analyzer.h>
+#include <libds/amt/csr_network.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/graph/edge_list.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) && defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace ds::utils
+{
+    namespace details
+    {
+        // Starts a new peak of the resident set size of the process, where the platform allows it.
+        void resetPeakResidentSize();
+
+        // Peak resident set size of the process in kB since the last reset, 0 where the platform does not tell.
+        size_t peakResidentSize();
+    }
+
+    /**
+     * @brief Analyzes loading of an edge list into an implicit network, in bulk or relation by relation.
+     *
+     * The size is the number of relations of the RMAT network of graph searches, which is written outside
+     * of the measurement into a file in the temporary directory, relations sorted by their lower node.
+     * Incremental loads read the same mapped list and insert and connect nodes through the gate.
+     * A thread count of 0 loads in bulk without a pool, other thread counts shard the second pass in a pool.
+     * The peak resident set size of every load in kB is saved into name-rss.csv next to the times, in the same layout.
+     */
+    class NetworkLoadAnalyzer : public ComplexityAnalyzer<std::string>
+    {
+    public:
+        NetworkLoadAnalyzer(const std::string& name, graph::EdgeListFormat format, bool bulk, size_t threadCount = 0);
+
+        void analyze() override;
+
+    protected:
+        // The structure is the path of the edge list.
+        void growToSize(std::string& structure, size_t size) override;
+        void executeOperation(std::string& structure) override;
+
+    private:
+        static const size_t EDGE_FACTOR = 16;
+
+        void saveResidentSizes() const;
+
+        graph::EdgeListFormat format_;
+        bool bulk_;
+        size_t threadCount_;
+        std::unique_ptr<WorkStealingPool> pool_;
+        std::mt19937_64 rng_;
+        amt::IGIRNetwork<int> network_;
+        std::vector<std::vector<size_t>> residentSizes_;
+    };
+
+    /**
+     * @brief Container for all network load analyzers, sharded bulk loads from a single thread to all hardware threads.
+     */
+    class NetworkLoadsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        NetworkLoadsAnalyzer();
+    };
+
+    //----------
+
+    namespace details
+    {
+        inline void resetPeakResidentSize()
+        {
+#if defined(__linux__)
+            std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+        }
+
+        inline size_t peakResidentSize()
+        {
+#if defined(__linux__)
+            std::ifstream status("/proc/self/status");
+            std::string field;
+            while (status >> field)
+            {
+                if (field == "VmHWM:")
+                {
+                    size_t result = 0;
+                    status >> result;
+                    return result;
+                }
+            }
+#endif
+            return 0;
+        }
+    }
+
+    inline NetworkLoadAnalyzer::NetworkLoadAnalyzer(const std::string& name, graph::EdgeListFormat format, bool bulk, size_t threadCount) :
+        ComplexityAnalyzer<std::string>(name),
+        format_(format),
+        bulk_(bulk),
+        threadCount_(threadCount),
+        pool_(nullptr),
+        rng_(144)
+    {
+        this->registerBeforeOperation([](std::string&)
+            {
+                details::resetPeakResidentSize();
+            });
+        this->registerAfterOperation([this](std::string&)
+            {
+                if (residentSizes_.empty() || residentSizes_.back().size() == this->getStepCount())
+                {
+                    residentSizes_.emplace_back();
+                }
+                residentSizes_.back().push_back(details::peakResidentSize());
+
+                // Freed nodes are returned to the system, so they do not count into the next peak.
+                network_.clear();
+#if defined(__linux__) && defined(__GLIBC__)
+                ::malloc_trim(0);
+#endif
+            });
+    }
+
+    inline void NetworkLoadAnalyzer::analyze()
+    {
+        if (threadCount_ > 0)
+        {
+            pool_ = std::make_unique<WorkStealingPool>(threadCount_);
+        }
+        residentSizes_.clear();
+        ComplexityAnalyzer<std::string>::analyze();
+        pool_.reset();
+        saveResidentSizes();
+        std::filesystem::remove(std::filesystem::temp_directory_path() / (this->getName() + ".edges"));
+    }
+
+    inline void NetworkLoadAnalyzer::growToSize(std::string& structure, size_t size)
+    {
+        structure = (std::filesystem::temp_directory_path() / (this->getName() + ".edges")).string();
+        const amt::CsrNetwork<int> network = details::makeRmatNetwork(size, EDGE_FACTOR, rng_);
+        const amt::MemoryBlock<int>* nodes = network.size() > 0 ? network.accessNodeFromGate(0) : nullptr;
+
+        std::ofstream file(structure, std::ios::binary | std::ios::trunc);
+        std::vector<char> buffer;
+        for (std::uint32_t node = 0; node < network.size(); ++node)
+        {
+            const std::uint32_t* last = network.endNeighbours(nodes[node]);
+            for (const std::uint32_t* neighbour = network.beginNeighbours(nodes[node]); neighbour != last; ++neighbour)
+            {
+                if (node > *neighbour)
+                {
+                    continue;
+                }
+
+                if (format_ == graph::EdgeListFormat::Binary)
+                {
+                    const std::uint32_t relation[] = { node, *neighbour };
+                    buffer.insert(buffer.end(), reinterpret_cast<const char*>(relation), reinterpret_cast<const char*>(relation + 2));
+                }
+                else
+                {
+                    char digits[16];
+                    buffer.insert(buffer.end(), digits, std::to_chars(digits, digits + sizeof(digits), node).ptr);
+                    buffer.push_back(' ');
+                    buffer.insert(buffer.end(), digits, std::to_chars(digits, digits + sizeof(digits), *neighbour).ptr);
+                    buffer.push_back('\n');
+                }
+            }
+            if (buffer.size() >= (1 << 20))
+            {
+                file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    inline void NetworkLoadAnalyzer::executeOperation(std::string& structure)
+    {
+        if (bulk_)
+        {
+            graph::loadEdgeList(network_, structure, format_, pool_.get());
+            return;
+        }
+
+        graph::details::MappedFile file(structure);
+        graph::details::forEachEdge(file, format_, [this](std::uint32_t from, std::uint32_t to)
+            {
+                while (network_.size() <= std::max(from, to))
+                {
+                    amt::IRNetworkBlock<int>& node = network_.insert();
+                    node.data_ = static_cast<int>(node.gateIndex_);
+                }
+                network_.connect(*network_.accessNodeFromGate(from), *network_.accessNodeFromGate(to));
+            });
+    }
+
+    inline void NetworkLoadAnalyzer::saveResidentSizes() const
+    {
+        std::filesystem::path path = this->getOutputPath();
+        path.replace_filename(this->getName() + "-rss.csv");
+        std::ofstream ost(path);
+        if (!ost.is_open())
+        {
+            throw std::runtime_error("Failed to open output file.");
+        }
+
+        for (size_t step = 1; step <= this->getStepCount(); ++step)
+        {
+            ost << step * this->getStepSize() << (step != this->getStepCount() ? ';' : '\n');
+        }
+        for (const std::vector<size_t>& sizes : residentSizes_)
+        {
+            for (size_t i = 0; i < sizes.size(); ++i)
+            {
+                ost << sizes[i] << (i + 1 != sizes.size() ? ';' : '\n');
+            }
+        }
+    }
+
+    //----------
+
+    inline NetworkLoadsAnalyzer::NetworkLoadsAnalyzer() :
+        CompositeAnalyzer("NetworkLoads")
+    {
+        using graph::EdgeListFormat;
+        this->addAnalyzer(std::make_unique<NetworkLoadAnalyzer>("incremental-text", EdgeListFormat::Text, false));
+        this->addAnalyzer(std::make_unique<NetworkLoadAnalyzer>("bulk-text", EdgeListFormat::Text, true));
+        this->addAnalyzer(std::make_unique<NetworkLoadAnalyzer>("incremental-binary", EdgeListFormat::Binary, false));
+        this->addAnalyzer(std::make_unique<NetworkLoadAnalyzer>("bulk-binary", EdgeListFormat::Binary, true));
+        const size_t maxThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; ++threadCount)
+        {
+            this->addAnalyzer(std::make_unique<NetworkLoadAnalyzer>("bulk-binary-threads-" + std::to_string(threadCount), EdgeListFormat::Binary, true, threadCount));
+        }
+    }
+}
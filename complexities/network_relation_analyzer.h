@@ -0,0 +1,196 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/amt/sorted_network.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a batch of checks, connections or disconnections of relations of a power-law network.
+     *
+     * The network grows by preferential attachment: every new node is connected to EDGES_PER_NODE distinct nodes
+     * picked as endpoints of random relations, so degrees follow a power law. Pairs of the batch are picked the same way,
+     * so hubs take part in most operations. Connected pairs are unrelated and get disconnected outside of the measurement,
+     * disconnected pairs are connected outside of it, so the network does not change between operations.
+     */
+    template<class NetworkType>
+    class NetworkRelationAnalyzer : public ComplexityAnalyzer<NetworkType>
+    {
+    public:
+        enum class Operation { Exists, Connect, Disconnect };
+
+        NetworkRelationAnalyzer(const std::string& name, Operation operation);
+
+    protected:
+        void growToSize(NetworkType& structure, size_t size) override;
+        void executeOperation(NetworkType& structure) override;
+
+    private:
+        using BlockType = typename NetworkType::NodeType;
+
+        static const size_t EDGES_PER_NODE = 4;
+        static const size_t BATCH_SIZE = 1000;
+
+        BlockType* randomEndpoint();
+        void pickUnrelatedPairs(NetworkType& structure);
+
+        Operation operation_;
+        std::default_random_engine rng_;
+        std::vector<BlockType*> nodes_;
+        std::vector<BlockType*> endpoints_;
+        std::vector<std::pair<BlockType*, BlockType*>> pairs_;
+        size_t existing_;
+    };
+
+    /**
+     * @brief Container for all network relation analyzers.
+     */
+    class NetworkRelationsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        NetworkRelationsAnalyzer();
+    };
+
+    //----------
+
+    template<class NetworkType>
+    NetworkRelationAnalyzer<NetworkType>::NetworkRelationAnalyzer(const std::string& name, Operation operation) :
+        ComplexityAnalyzer<NetworkType>(name),
+        operation_(operation),
+        rng_(144),
+        existing_(0)
+    {
+        this->registerBeforeOperation([this](NetworkType& structure)
+            {
+                pairs_.clear();
+                if (operation_ == Operation::Exists)
+                {
+                    for (size_t i = 0; i < BATCH_SIZE; ++i)
+                    {
+                        pairs_.emplace_back(this->randomEndpoint(), this->randomEndpoint());
+                    }
+                }
+                else
+                {
+                    this->pickUnrelatedPairs(structure);
+                    if (operation_ == Operation::Disconnect)
+                    {
+                        for (auto& [nodeA, nodeB] : pairs_)
+                        {
+                            structure.connect(*nodeA, *nodeB);
+                        }
+                    }
+                }
+            });
+        if (operation_ == Operation::Connect)
+        {
+            this->registerAfterOperation([this](NetworkType& structure)
+                {
+                    for (auto& [nodeA, nodeB] : pairs_)
+                    {
+                        structure.disconnect(*nodeA, *nodeB);
+                    }
+                });
+        }
+    }
+
+    template<class NetworkType>
+    void NetworkRelationAnalyzer<NetworkType>::growToSize(NetworkType& structure, size_t size)
+    {
+        // Every replication starts with an empty copy of the prototype.
+        if (structure.isEmpty())
+        {
+            nodes_.clear();
+            endpoints_.clear();
+        }
+
+        while (nodes_.size() < size)
+        {
+            BlockType& node = structure.insert();
+            node.data_ = static_cast<int>(nodes_.size());
+
+            std::vector<BlockType*> targets;
+            while (targets.size() < EDGES_PER_NODE && targets.size() < nodes_.size())
+            {
+                BlockType* target = endpoints_.empty() ? nodes_[rng_() % nodes_.size()] : this->randomEndpoint();
+                if (std::find(targets.begin(), targets.end(), target) == targets.end())
+                {
+                    targets.push_back(target);
+                }
+            }
+            for (BlockType* target : targets)
+            {
+                structure.connect(node, *target);
+                endpoints_.push_back(&node);
+                endpoints_.push_back(target);
+            }
+            nodes_.push_back(&node);
+        }
+    }
+
+    template<class NetworkType>
+    void NetworkRelationAnalyzer<NetworkType>::executeOperation(NetworkType& structure)
+    {
+        for (auto& [nodeA, nodeB] : pairs_)
+        {
+            switch (operation_)
+            {
+                case Operation::Exists:
+                    existing_ += structure.relationExists(*nodeA, *nodeB) ? 1 : 0;
+                    break;
+                case Operation::Connect:
+                    structure.connect(*nodeA, *nodeB);
+                    break;
+                case Operation::Disconnect:
+                    structure.disconnect(*nodeA, *nodeB);
+                    break;
+            }
+        }
+    }
+
+    template<class NetworkType>
+    auto NetworkRelationAnalyzer<NetworkType>::randomEndpoint() -> BlockType*
+    {
+        return endpoints_[rng_() % endpoints_.size()];
+    }
+
+    template<class NetworkType>
+    void NetworkRelationAnalyzer<NetworkType>::pickUnrelatedPairs(NetworkType& structure)
+    {
+        // Pairs are distinct, so every one of them is connected or disconnected exactly once.
+        while (pairs_.size() < BATCH_SIZE)
+        {
+            BlockType* nodeA = this->randomEndpoint();
+            BlockType* nodeB = this->randomEndpoint();
+            auto samePair = [nodeA, nodeB](const std::pair<BlockType*, BlockType*>& pair)
+                {
+                    return (pair.first == nodeA && pair.second == nodeB) || (pair.first == nodeB && pair.second == nodeA);
+                };
+            if (nodeA != nodeB && !structure.relationExists(*nodeA, *nodeB) && std::find_if(pairs_.begin(), pairs_.end(), samePair) == pairs_.end())
+            {
+                pairs_.emplace_back(nodeA, nodeB);
+            }
+        }
+    }
+
+    //----------
+
+    inline NetworkRelationsAnalyzer::NetworkRelationsAnalyzer() :
+        CompositeAnalyzer("NetworkRelations")
+    {
+        using ImplicitAnalyzer = NetworkRelationAnalyzer<amt::IGIRNetwork<int>>;
+        using SortedAnalyzer = NetworkRelationAnalyzer<amt::IGSRNetwork<int>>;
+        this->addAnalyzer(std::make_unique<ImplicitAnalyzer>("implicit-exists", ImplicitAnalyzer::Operation::Exists));
+        this->addAnalyzer(std::make_unique<ImplicitAnalyzer>("implicit-connect", ImplicitAnalyzer::Operation::Connect));
+        this->addAnalyzer(std::make_unique<ImplicitAnalyzer>("implicit-disconnect", ImplicitAnalyzer::Operation::Disconnect));
+        this->addAnalyzer(std::make_unique<SortedAnalyzer>("sorted-exists", SortedAnalyzer::Operation::Exists));
+        this->addAnalyzer(std::make_unique<SortedAnalyzer>("sorted-connect", SortedAnalyzer::Operation::Connect));
+        this->addAnalyzer(std::make_unique<SortedAnalyzer>("sorted-disconnect", SortedAnalyzer::Operation::Disconnect));
+    }
+}
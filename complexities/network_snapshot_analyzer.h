@@ -0,0 +1,135 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/csr_network.h>
+#include <libds/amt/explicit_network.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a snapshot of a network with implicit relations and traversals over all of its relations.
+     *
+     * The size is the number of connections between random pairs of nodes, there are EDGES_PER_NODE of them per node.
+     * A traversal sums data of neighbours of all nodes, either in the network or in its snapshot, which is frozen
+     * outside of the measurement. A replication count of 1 with a step size of 1M and 10 steps reaches 10M connections.
+     */
+    class NetworkSnapshotAnalyzer : public ComplexityAnalyzer<amt::IGIRNetwork<int>>
+    {
+    public:
+        enum class Method { Freeze, NetworkTraversal, SnapshotTraversal };
+
+        NetworkSnapshotAnalyzer(const std::string& name, Method method);
+
+    protected:
+        void growToSize(amt::IGIRNetwork<int>& structure, size_t size) override;
+        void executeOperation(amt::IGIRNetwork<int>& structure) override;
+
+    private:
+        using BlockType = amt::IGIRNetwork<int>::NodeType;
+
+        static const size_t EDGES_PER_NODE = 4;
+
+        Method method_;
+        std::default_random_engine rng_;
+        std::vector<BlockType*> nodes_;
+        size_t edgeCount_;
+        std::unique_ptr<amt::CsrNetwork<int>> snapshot_;
+        long long sum_;
+    };
+
+    /**
+     * @brief Container for all network snapshot analyzers.
+     */
+    class NetworkSnapshotsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        NetworkSnapshotsAnalyzer();
+    };
+
+    //----------
+
+    inline NetworkSnapshotAnalyzer::NetworkSnapshotAnalyzer(const std::string& name, Method method) :
+        ComplexityAnalyzer<amt::IGIRNetwork<int>>(name),
+        method_(method),
+        rng_(144),
+        edgeCount_(0),
+        sum_(0)
+    {
+        if (method_ == Method::SnapshotTraversal)
+        {
+            this->registerBeforeOperation([this](amt::IGIRNetwork<int>& structure)
+                {
+                    snapshot_ = std::make_unique<amt::CsrNetwork<int>>(structure.freeze());
+                });
+        }
+        this->registerAfterOperation([this](amt::IGIRNetwork<int>&)
+            {
+                snapshot_.reset();
+            });
+    }
+
+    inline void NetworkSnapshotAnalyzer::growToSize(amt::IGIRNetwork<int>& structure, size_t size)
+    {
+        // Every replication starts with an empty copy of the prototype.
+        if (structure.isEmpty())
+        {
+            nodes_.clear();
+            edgeCount_ = 0;
+        }
+
+        while (nodes_.size() < size / EDGES_PER_NODE + 1)
+        {
+            BlockType& node = structure.insert();
+            node.data_ = static_cast<int>(nodes_.size());
+            nodes_.push_back(&node);
+        }
+
+        for (; edgeCount_ < size; ++edgeCount_)
+        {
+            structure.connect(*nodes_[rng_() % nodes_.size()], *nodes_[rng_() % nodes_.size()]);
+        }
+    }
+
+    inline void NetworkSnapshotAnalyzer::executeOperation(amt::IGIRNetwork<int>& structure)
+    {
+        switch (method_)
+        {
+            case Method::Freeze:
+                snapshot_ = std::make_unique<amt::CsrNetwork<int>>(structure.freeze());
+                break;
+            case Method::NetworkTraversal:
+                for (size_t i = 0; i < structure.size(); ++i)
+                {
+                    BlockType* node = structure.accessNodeFromGate(i);
+                    const size_t degree = structure.degree(*node);
+                    for (size_t order = 0; order < degree; ++order)
+                    {
+                        sum_ += structure.accessNodeFromNode(*node, order)->data_;
+                    }
+                }
+                break;
+            case Method::SnapshotTraversal:
+                for (size_t i = 0; i < snapshot_->size(); ++i)
+                {
+                    snapshot_->processNeighbours(*snapshot_->accessNodeFromGate(i), [this](amt::MemoryBlock<int>* b)
+                        {
+                            sum_ += b->data_;
+                        });
+                }
+                break;
+        }
+    }
+
+    //----------
+
+    inline NetworkSnapshotsAnalyzer::NetworkSnapshotsAnalyzer() :
+        CompositeAnalyzer("NetworkSnapshots")
+    {
+        this->addAnalyzer(std::make_unique<NetworkSnapshotAnalyzer>("freeze", NetworkSnapshotAnalyzer::Method::Freeze));
+        this->addAnalyzer(std::make_unique<NetworkSnapshotAnalyzer>("network-traversal", NetworkSnapshotAnalyzer::Method::NetworkTraversal));
+        this->addAnalyzer(std::make_unique<NetworkSnapshotAnalyzer>("snapshot-traversal", NetworkSnapshotAnalyzer::Method::SnapshotTraversal));
+    }
+}
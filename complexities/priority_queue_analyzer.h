@@ -0,0 +1,147 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/priority_queue.h>
+#include <random>
+
+namespace ds::utils
+{
+    /**
+     * @brief Common base for priority queue analyzers.
+     *
+     * A single push or pop takes only tens of nanoseconds, so every measurement
+     * covers a batch of operations. The queue is restored to its size afterwards.
+     */
+    template<class Queue>
+    class PriorityQueueAnalyzer : public ComplexityAnalyzer<Queue>
+    {
+    protected:
+        explicit PriorityQueueAnalyzer(const std::string& name);
+
+        void growToSize(Queue& structure, size_t size) override;
+
+        void pushRandom(Queue& structure, size_t count);
+        void pop(Queue& structure, size_t count);
+
+        static const size_t BATCH_SIZE = 1000;
+
+    private:
+        std::default_random_engine rngPriority_;
+        long long sum_;
+    };
+
+    /**
+     * @brief Analyzes a batch of pushes.
+     */
+    template<class Queue>
+    class PriorityQueuePushAnalyzer : public PriorityQueueAnalyzer<Queue>
+    {
+    public:
+        explicit PriorityQueuePushAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Queue& structure) override;
+    };
+
+    /**
+     * @brief Analyzes a batch of pops.
+     */
+    template<class Queue>
+    class PriorityQueuePopAnalyzer : public PriorityQueueAnalyzer<Queue>
+    {
+    public:
+        explicit PriorityQueuePopAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Queue& structure) override;
+    };
+
+    /**
+     * @brief Container for all priority queue analyzers.
+     */
+    class PriorityQueuesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        PriorityQueuesAnalyzer();
+    };
+
+    //----------
+
+    template<class Queue>
+    PriorityQueueAnalyzer<Queue>::PriorityQueueAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Queue>(name),
+        rngPriority_(144),
+        sum_(0)
+    {
+    }
+
+    template<class Queue>
+    void PriorityQueueAnalyzer<Queue>::growToSize(Queue& structure, size_t size)
+    {
+        this->pushRandom(structure, size - structure.size());
+    }
+
+    template<class Queue>
+    void PriorityQueueAnalyzer<Queue>::pushRandom(Queue& structure, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            const int priority = static_cast<int>(rngPriority_());
+            structure.push(priority, priority);
+        }
+    }
+
+    template<class Queue>
+    void PriorityQueueAnalyzer<Queue>::pop(Queue& structure, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            sum_ += structure.pop();
+        }
+    }
+
+    //----------
+
+    template<class Queue>
+    PriorityQueuePushAnalyzer<Queue>::PriorityQueuePushAnalyzer(const std::string& name) :
+        PriorityQueueAnalyzer<Queue>(name)
+    {
+        this->registerAfterOperation([this](Queue& queue)
+            {
+                this->pop(queue, PriorityQueueAnalyzer<Queue>::BATCH_SIZE);
+            });
+    }
+
+    template<class Queue>
+    void PriorityQueuePushAnalyzer<Queue>::executeOperation(Queue& structure)
+    {
+        this->pushRandom(structure, PriorityQueueAnalyzer<Queue>::BATCH_SIZE);
+    }
+
+    //----------
+
+    template<class Queue>
+    PriorityQueuePopAnalyzer<Queue>::PriorityQueuePopAnalyzer(const std::string& name) :
+        PriorityQueueAnalyzer<Queue>(name)
+    {
+        this->registerBeforeOperation([this](Queue& queue)
+            {
+                this->pushRandom(queue, PriorityQueueAnalyzer<Queue>::BATCH_SIZE);
+            });
+    }
+
+    template<class Queue>
+    void PriorityQueuePopAnalyzer<Queue>::executeOperation(Queue& structure)
+    {
+        this->pop(structure, PriorityQueueAnalyzer<Queue>::BATCH_SIZE);
+    }
+
+    //----------
+
+    inline PriorityQueuesAnalyzer::PriorityQueuesAnalyzer() :
+        CompositeAnalyzer("PriorityQueues")
+    {
+        this->addAnalyzer(std::make_unique<PriorityQueuePushAnalyzer<adt::BinaryHeap<int, int>>>("binary-heap-push"));
+        this->addAnalyzer(std::make_unique<PriorityQueuePopAnalyzer<adt::BinaryHeap<int, int>>>("binary-heap-pop"));
+    }
+}
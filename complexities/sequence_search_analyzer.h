@@ -0,0 +1,103 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/simd.h>
+#include <random>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes search and sum over an implicit sequence of ints.
+     *
+     * The searched value is never present, so every search scans the whole sequence.
+     */
+    class SequenceSearchAnalyzer : public ComplexityAnalyzer<amt::ImplicitSequence<int>>
+    {
+    public:
+        enum class Kernel { FindProperty, FindScalar, FindVectorized, SumProcess, SumScalar, SumVectorized };
+
+        SequenceSearchAnalyzer(const std::string& name, Kernel kernel);
+
+    protected:
+        void growToSize(amt::ImplicitSequence<int>& structure, size_t size) override;
+        void executeOperation(amt::ImplicitSequence<int>& structure) override;
+
+    private:
+        static const int MISSING = -1;
+
+        std::default_random_engine rngData_;
+        Kernel kernel_;
+        size_t index_;
+        long long sum_;
+    };
+
+    /**
+     * @brief Container for all sequence search analyzers.
+     */
+    class SequenceSearchesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        SequenceSearchesAnalyzer();
+    };
+
+    //----------
+
+    inline SequenceSearchAnalyzer::SequenceSearchAnalyzer(const std::string& name, Kernel kernel) :
+        ComplexityAnalyzer<amt::ImplicitSequence<int>>(name),
+        rngData_(144),
+        kernel_(kernel),
+        index_(0),
+        sum_(0)
+    {
+    }
+
+    inline void SequenceSearchAnalyzer::growToSize(amt::ImplicitSequence<int>& structure, size_t size)
+    {
+        std::uniform_int_distribution<int> dist(0, 1'000'000);
+        while (structure.size() < size)
+        {
+            structure.insertLast().data_ = dist(rngData_);
+        }
+    }
+
+    inline void SequenceSearchAnalyzer::executeOperation(amt::ImplicitSequence<int>& structure)
+    {
+        const int* data = &structure.read(0)->data_;
+        switch (kernel_)
+        {
+        case Kernel::FindProperty:
+            index_ += structure.findBlockWithProperty([](amt::MemoryBlock<int>* b) { return b->data_ == MISSING; }) == nullptr ? 1 : 0;
+            break;
+        case Kernel::FindScalar:
+            index_ += simd::scalar::find(data, structure.size(), MISSING);
+            break;
+        case Kernel::FindVectorized:
+            index_ += structure.find(MISSING);
+            break;
+        case Kernel::SumProcess:
+            structure.processAllBlocksForward([this](amt::MemoryBlock<int>* b) { sum_ += b->data_; });
+            break;
+        case Kernel::SumScalar:
+            sum_ += simd::scalar::sum(data, structure.size());
+            break;
+        case Kernel::SumVectorized:
+            sum_ += structure.sum();
+            break;
+        }
+    }
+
+    //----------
+
+    inline SequenceSearchesAnalyzer::SequenceSearchesAnalyzer() :
+        CompositeAnalyzer("SequenceSearches")
+    {
+        using Kernel = SequenceSearchAnalyzer::Kernel;
+        this->addAnalyzer(std::make_unique<SequenceSearchAnalyzer>("is-find-property", Kernel::FindProperty));
+        this->addAnalyzer(std::make_unique<SequenceSearchAnalyzer>("is-find-scalar", Kernel::FindScalar));
+        this->addAnalyzer(std::make_unique<SequenceSearchAnalyzer>("is-find-simd", Kernel::FindVectorized));
+        this->addAnalyzer(std::make_unique<SequenceSearchAnalyzer>("is-sum-process", Kernel::SumProcess));
+        this->addAnalyzer(std::make_unique<SequenceSearchAnalyzer>("is-sum-scalar", Kernel::SumScalar));
+        this->addAnalyzer(std::make_unique<SequenceSearchAnalyzer>("is-sum-simd", Kernel::SumVectorized));
+    }
+}
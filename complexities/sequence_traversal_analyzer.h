@@ -0,0 +1,92 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_sequence.h>
+#include <libds/mm/pooled_memory_manager.h>
+#include <random>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes forward traversal of a doubly linked sequence.
+     *
+     * Blocks are shuffled in memory by sorting random data, so that logical order
+     * does not follow allocation order. Cache effects show up with step size of 1M and more.
+     */
+    class SequenceTraversalAnalyzer : public ComplexityAnalyzer<amt::DoublyLS<int>>
+    {
+    public:
+        enum class Layout { Scattered, Compacted, Pooled };
+
+        SequenceTraversalAnalyzer(const std::string& name, Layout layout);
+
+    protected:
+        void growToSize(amt::DoublyLS<int>& structure, size_t size) override;
+        void executeOperation(amt::DoublyLS<int>& structure) override;
+
+    private:
+        std::default_random_engine rngData_;
+        Layout layout_;
+        long long sum_;
+    };
+
+    /**
+     * @brief Container for all sequence traversal analyzers.
+     */
+    class SequenceTraversalsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        SequenceTraversalsAnalyzer();
+    };
+
+    //----------
+
+    inline SequenceTraversalAnalyzer::SequenceTraversalAnalyzer(const std::string& name, Layout layout) :
+        ComplexityAnalyzer<amt::DoublyLS<int>>(name),
+        rngData_(144),
+        layout_(layout),
+        sum_(0)
+    {
+    }
+
+    inline void SequenceTraversalAnalyzer::growToSize(amt::DoublyLS<int>& structure, size_t size)
+    {
+        while (structure.size() < size)
+        {
+            structure.insertLast().data_ = static_cast<int>(rngData_());
+        }
+
+        structure.sortBlocks([](const auto& a, const auto& b) { return a.data_ < b.data_; });
+
+        switch (layout_)
+        {
+        case Layout::Compacted:
+            structure.compact();
+            break;
+        case Layout::Pooled:
+            structure.compact(new mm::PooledMemoryManager<amt::DoublyLS<int>::BlockType>());
+            break;
+        default:
+            break;
+        }
+    }
+
+    inline void SequenceTraversalAnalyzer::executeOperation(amt::DoublyLS<int>& structure)
+    {
+        structure.processAllBlocksForward([this](amt::DoublyLS<int>::BlockType* b)
+            {
+                sum_ += b->data_;
+            });
+    }
+
+    //----------
+
+    inline SequenceTraversalsAnalyzer::SequenceTraversalsAnalyzer() :
+        CompositeAnalyzer("SequenceTraversals")
+    {
+        using Layout = SequenceTraversalAnalyzer::Layout;
+        this->addAnalyzer(std::make_unique<SequenceTraversalAnalyzer>("doubly-traversal-scattered", Layout::Scattered));
+        this->addAnalyzer(std::make_unique<SequenceTraversalAnalyzer>("doubly-traversal-compacted", Layout::Compacted));
+        this->addAnalyzer(std::make_unique<SequenceTraversalAnalyzer>("doubly-traversal-pooled", Layout::Pooled));
+    }
+}
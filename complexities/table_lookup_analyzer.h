@@ -0,0 +1,92 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/table.h>
+#include <random>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes a batch of random lookups in a sorted sequence table.
+     *
+     * The table holds even keys only, so half of the lookups miss.
+     * A frozen table is searched through its Eytzinger index, otherwise by binary search.
+     * Step sizes of 1M and more are needed to see the RAM-bound end of the curve.
+     */
+    template<class Table>
+    class TableLookupAnalyzer : public ComplexityAnalyzer<Table>
+    {
+    public:
+        TableLookupAnalyzer(const std::string& name, bool frozen);
+
+    protected:
+        void growToSize(Table& structure, size_t size) override;
+        void executeOperation(Table& structure) override;
+
+    private:
+        static const size_t BATCH_SIZE = 1000;
+
+        std::default_random_engine rngKey_;
+        bool frozen_;
+        size_t keyCount_;
+        size_t found_;
+    };
+
+    /**
+     * @brief Container for all table lookup analyzers.
+     */
+    class TableLookupsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        TableLookupsAnalyzer();
+    };
+
+    //----------
+
+    template<class Table>
+    TableLookupAnalyzer<Table>::TableLookupAnalyzer(const std::string& name, bool frozen) :
+        ComplexityAnalyzer<Table>(name),
+        rngKey_(144),
+        frozen_(frozen),
+        keyCount_(0),
+        found_(0)
+    {
+    }
+
+    template<class Table>
+    void TableLookupAnalyzer<Table>::growToSize(Table& structure, size_t size)
+    {
+        // Increasing keys are appended at the end of the sequence.
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            structure.insert(static_cast<int>(2 * i), static_cast<int>(i));
+        }
+        keyCount_ = size;
+
+        if (frozen_)
+        {
+            structure.freeze();
+        }
+    }
+
+    template<class Table>
+    void TableLookupAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        std::uniform_int_distribution<int> keyDist(0, static_cast<int>(2 * keyCount_));
+        for (size_t i = 0; i < BATCH_SIZE; ++i)
+        {
+            int* data = nullptr;
+            found_ += structure.tryFind(keyDist(rngKey_), data) ? 1 : 0;
+        }
+    }
+
+    //----------
+
+    inline TableLookupsAnalyzer::TableLookupsAnalyzer() :
+        CompositeAnalyzer("TableLookups")
+    {
+        using SortedAnalyzer = TableLookupAnalyzer<adt::SortedSequenceTable<int, int>>;
+        this->addAnalyzer(std::make_unique<SortedAnalyzer>("sorted-binary-search", false));
+        this->addAnalyzer(std::make_unique<SortedAnalyzer>("sorted-eytzinger", true));
+    }
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <libds/adt/abstract_data_type.h>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ds::adt {
+
+    /**
+     * @brief Partition of elements 0 to size - 1 into disjoint sets, every element starts in its own set.
+     *
+     * Every set is a tree kept in one contiguous array of parents, its root represents the set.
+     * unite hangs the root of lower rank under the other root, find halves the path it walks by pointing
+     * every other element to its grandparent, so both take amortized almost constant time and no recursion.
+     */
+    class DisjointSets :
+        virtual public ADT
+    {
+    public:
+        using IndexType = std::uint32_t;
+
+        explicit DisjointSets(size_t size = 0); // throw(std::length_error)
+        DisjointSets(const DisjointSets& other);
+
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+        // Equal partitions of the same elements, representatives may differ.
+        bool equals(const ADT& other) override;
+
+        // Adds an element in its own set and returns it.
+        size_t add(); // throw(std::length_error)
+        size_t setCount() const;
+
+        // Representative of the set of the element.
+        size_t find(size_t element); // throw(std::out_of_range)
+        // Merges sets of the elements, returns false if they already were in the same set.
+        bool unite(size_t elementA, size_t elementB); // throw(std::out_of_range)
+        bool connected(size_t elementA, size_t elementB); // throw(std::out_of_range)
+
+    private:
+        void checkElement(size_t element) const;
+        // Root of the element without changing the trees.
+        IndexType rootOf(IndexType element) const;
+
+        std::vector<IndexType> parents_;
+        // Upper bound of the height of every tree, meaningful for roots only.
+        std::vector<std::uint8_t> ranks_;
+        size_t setCount_;
+    };
+
+    //----------
+
+    inline DisjointSets::DisjointSets(size_t size) :
+        parents_(),
+        ranks_(),
+        setCount_(0)
+    {
+        if (size >= std::numeric_limits<IndexType>::max())
+        {
+            throw std::length_error("Too many elements of disjoint sets!");
+        }
+
+        parents_.resize(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            parents_[i] = static_cast<IndexType>(i);
+        }
+        ranks_.assign(size, 0);
+        setCount_ = size;
+    }
+
+    inline DisjointSets::DisjointSets(const DisjointSets& other) :
+        parents_(other.parents_),
+        ranks_(other.ranks_),
+        setCount_(other.setCount_)
+    {
+    }
+
+    inline ADT& DisjointSets::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const DisjointSets& otherSets = dynamic_cast<const DisjointSets&>(other);
+            parents_ = otherSets.parents_;
+            ranks_ = otherSets.ranks_;
+            setCount_ = otherSets.setCount_;
+        }
+
+        return *this;
+    }
+
+    inline void DisjointSets::clear()
+    {
+        parents_.clear();
+        ranks_.clear();
+        setCount_ = 0;
+    }
+
+    inline size_t DisjointSets::size() const
+    {
+        return parents_.size();
+    }
+
+    inline bool DisjointSets::isEmpty() const
+    {
+        return parents_.empty();
+    }
+
+    inline bool DisjointSets::equals(const ADT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const DisjointSets* otherSets = dynamic_cast<const DisjointSets*>(&other);
+        if (otherSets == nullptr || this->size() != otherSets->size() || setCount_ != otherSets->setCount_)
+        {
+            return false;
+        }
+
+        // Representatives of both partitions have to correspond one to one.
+        const IndexType none = std::numeric_limits<IndexType>::max();
+        std::vector<IndexType> otherRoots(this->size(), none);
+        std::vector<IndexType> roots(this->size(), none);
+        for (size_t i = 0; i < this->size(); ++i)
+        {
+            const IndexType root = static_cast<IndexType>(this->find(i));
+            const IndexType otherRoot = otherSets->rootOf(static_cast<IndexType>(i));
+            if (otherRoots[root] == none && roots[otherRoot] == none)
+            {
+                otherRoots[root] = otherRoot;
+                roots[otherRoot] = root;
+            }
+            else if (otherRoots[root] != otherRoot || roots[otherRoot] != root)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    inline size_t DisjointSets::add()
+    {
+        if (parents_.size() + 1 >= std::numeric_limits<IndexType>::max())
+        {
+            throw std::length_error("Too many elements of disjoint sets!");
+        }
+
+        parents_.push_back(static_cast<IndexType>(parents_.size()));
+        ranks_.push_back(0);
+        ++setCount_;
+        return parents_.size() - 1;
+    }
+
+    inline size_t DisjointSets::setCount() const
+    {
+        return setCount_;
+    }
+
+    inline size_t DisjointSets::find(size_t element)
+    {
+        this->checkElement(element);
+        IndexType current = static_cast<IndexType>(element);
+        while (parents_[current] != current)
+        {
+            parents_[current] = parents_[parents_[current]];
+            current = parents_[current];
+        }
+        return current;
+    }
+
+    inline bool DisjointSets::unite(size_t elementA, size_t elementB)
+    {
+        IndexType rootA = static_cast<IndexType>(this->find(elementA));
+        IndexType rootB = static_cast<IndexType>(this->find(elementB));
+        if (rootA == rootB)
+        {
+            return false;
+        }
+
+        if (ranks_[rootA] < ranks_[rootB])
+        {
+            std::swap(rootA, rootB);
+        }
+        parents_[rootB] = rootA;
+        if (ranks_[rootA] == ranks_[rootB])
+        {
+            ++ranks_[rootA];
+        }
+        --setCount_;
+        return true;
+    }
+
+    inline bool DisjointSets::connected(size_t elementA, size_t elementB)
+    {
+        return this->find(elementA) == this->find(elementB);
+    }
+
+    inline void DisjointSets::checkElement(size_t element) const
+    {
+        if (element >= parents_.size())
+        {
+            throw std::out_of_range("Invalid element!");
+        }
+    }
+
+    inline auto DisjointSets::rootOf(IndexType element) const -> IndexType
+    {
+        while (parents_[element] != element)
+        {
+            element = parents_[element];
+        }
+        return element;
+    }
+}
@@ -3,6 +3,7 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
+#include <type_traits>
 
 namespace ds::adt {
 
@@ -75,6 +76,8 @@ namespace ds::adt {
     class ImplicitList :
         public GeneralList<T, amt::IS<T>>
     {
+    public:
+        size_t calculateIndex(T element) override;
     };
 
     //----------
@@ -107,6 +110,10 @@ namespace ds::adt {
     class DoublyLinkedList :
         public GeneralList<T, amt::DoublyLS<T>>
     {
+    public:
+        void splice(size_t index, DoublyLinkedList<T>& other, size_t firstIndex, size_t lastIndex);
+        void splitAfter(size_t index, DoublyLinkedList<T>& target);
+        void concat(DoublyLinkedList<T>& other);
     };
 
     //----------
@@ -134,9 +141,21 @@ namespace ds::adt {
     template<typename T, typename SequenceType>
     size_t GeneralList<T, SequenceType>::calculateIndex(T element)
     {
-        // TODO 08
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        // Bounded by size, cyclic sequences never run out of blocks.
+        SequenceType* sequence = this->getSequence();
+        const size_t size = sequence->size();
+        typename SequenceType::BlockType* block = sequence->accessFirst();
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            if (block->data_ == element)
+            {
+                return index;
+            }
+            block = sequence->accessNext(*block);
+        }
+
+        return INVALID_INDEX;
     }
 
     template<typename T, typename SequenceType>
@@ -246,4 +265,53 @@ namespace ds::adt {
     {
         return dynamic_cast<SequenceType*>(this->memoryStructure_);
     }
+
+    //----------
+
+    template<typename T>
+    size_t ImplicitList<T>::calculateIndex(T element)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            return this->getSequence()->find(element);
+        }
+        else
+        {
+            return GeneralList<T, amt::IS<T>>::calculateIndex(element);
+        }
+    }
+
+    //----------
+
+    template<typename T>
+    void DoublyLinkedList<T>::splice(size_t index, DoublyLinkedList<T>& other, size_t firstIndex, size_t lastIndex)
+    {
+        if (index > this->size() || firstIndex > lastIndex || lastIndex >= other.size() ||
+            (&other == this && index > firstIndex && index <= lastIndex + 1))
+        {
+            throw std::out_of_range("Invalid index!");
+        }
+
+        amt::DoublyLS<T>* sequence = this->getSequence();
+        amt::DoublyLS<T>* otherSequence = other.getSequence();
+        auto* targetBlock = index == 0 ? nullptr : sequence->access(index - 1);
+        sequence->splice(targetBlock, *otherSequence, *otherSequence->access(firstIndex), *otherSequence->access(lastIndex));
+    }
+
+    template<typename T>
+    void DoublyLinkedList<T>::splitAfter(size_t index, DoublyLinkedList<T>& target)
+    {
+        if (index >= this->size())
+        {
+            throw std::out_of_range("Invalid index!");
+        }
+
+        this->getSequence()->splitAfter(*this->getSequence()->access(index), *target.getSequence());
+    }
+
+    template<typename T>
+    void DoublyLinkedList<T>::concat(DoublyLinkedList<T>& other)
+    {
+        this->getSequence()->concat(*other.getSequence());
+    }
 }
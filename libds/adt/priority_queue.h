@@ -6,6 +6,7 @@
 #include <libds/amt/implicit_hierarchy.h>
 #include <cmath>
 #include <functional>
+#include <utility>
 
 namespace ds::adt {
 
@@ -460,25 +461,64 @@ namespace ds::adt {
     template<typename P, typename T>
     void BinaryHeap<P, T>::push(P priority, T data)
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        amt::BinaryIH<PQItem<P, T>>* hierarchy = this->getHierarchy();
+        HierarchyBlockType* current = &hierarchy->insertLastLeaf();
+        current->data_.priority_ = priority;
+        current->data_.data_ = data;
+
+        HierarchyBlockType* parent = hierarchy->accessParent(*current);
+        while (parent != nullptr && current->data_.priority_ < parent->data_.priority_)
+        {
+            std::swap(current->data_, parent->data_);
+            current = parent;
+            parent = hierarchy->accessParent(*current);
+        }
     }
 
     template<typename P, typename T>
     T& BinaryHeap<P, T>::peek()
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this->isEmpty())
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        return this->getHierarchy()->accessRoot()->data_.data_;
     }
 
     template<typename P, typename T>
     T BinaryHeap<P, T>::pop()
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this->isEmpty())
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        amt::BinaryIH<PQItem<P, T>>* hierarchy = this->getHierarchy();
+        HierarchyBlockType* current = hierarchy->accessRoot();
+        T result = current->data_.data_;
+        std::swap(current->data_, hierarchy->accessLastLeaf()->data_);
+        hierarchy->removeLastLeaf();
+
+        auto findSonWithHigherPriority = [hierarchy](HierarchyBlockType* node) -> HierarchyBlockType*
+        {
+            HierarchyBlockType* leftSon = hierarchy->accessLeftSon(*node);
+            HierarchyBlockType* rightSon = hierarchy->accessRightSon(*node);
+            return rightSon == nullptr || leftSon->data_.priority_ <= rightSon->data_.priority_ ? leftSon : rightSon;
+        };
+
+        if (!hierarchy->isEmpty())
+        {
+            HierarchyBlockType* son = findSonWithHigherPriority(current);
+            while (son != nullptr && son->data_.priority_ < current->data_.priority_)
+            {
+                std::swap(current->data_, son->data_);
+                current = son;
+                son = findSonWithHigherPriority(current);
+            }
+        }
+
+        return result;
     }
 
     template<typename P, typename T>
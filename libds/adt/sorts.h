@@ -1,6 +1,7 @@
 #pragma once
 
 #include <libds/amt/implicit_sequence.h>
+#include <libds/amt/explicit_sequence.h>
 #include <libds/adt/queue.h>
 #include <libds/adt/array.h>
 #include <functional>
@@ -123,6 +124,22 @@ namespace ds::adt
 
     //----------
 
+    template <typename T>
+    class LinkedMergeSort
+    {
+    public:
+        void sort(amt::SinglyLS<T>& ls, std::function<bool(const T&, const T&)> compare);
+        void sort(amt::DoublyLS<T>& ls, std::function<bool(const T&, const T&)> compare);
+        void sort(amt::SinglyLS<T>& ls) { sort(ls, [](const T& a, const T& b)->bool {return a < b; }); }
+        void sort(amt::DoublyLS<T>& ls) { sort(ls, [](const T& a, const T& b)->bool {return a < b; }); }
+
+    private:
+        template <typename BlockType>
+        void sortBlocks(amt::ExplicitSequence<BlockType>& es, std::function<bool(const T&, const T&)>& compare);
+    };
+
+    //----------
+
     template<typename T>
     void SelectSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
     {
@@ -159,9 +176,43 @@ namespace ds::adt
     template<typename T>
     void QuickSort<T>::quick(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare, size_t min, size_t max)
     {
-        // TODO 12
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        const T pivot = is.access(min + (max - min) / 2)->data_;
+        size_t left = min;
+        size_t right = max;
+
+        do
+        {
+            while (compare(is.access(left)->data_, pivot))
+            {
+                ++left;
+            }
+
+            while (right > 0 && compare(pivot, is.access(right)->data_))
+            {
+                --right;
+            }
+
+            if (left <= right)
+            {
+                std::swap(is.access(left)->data_, is.access(right)->data_);
+                ++left;
+                if (right == 0)
+                {
+                    break;
+                }
+                --right;
+            }
+        } while (left <= right);
+
+        if (min < right)
+        {
+            quick(is, compare, min, right);
+        }
+
+        if (left < max)
+        {
+            quick(is, compare, left, max);
+        }
     }
 
     template<typename T>
@@ -229,4 +280,25 @@ namespace ds::adt
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
+
+    //----------
+
+    template<typename T>
+    void LinkedMergeSort<T>::sort(amt::SinglyLS<T>& ls, std::function<bool(const T&, const T&)> compare)
+    {
+        this->sortBlocks(ls, compare);
+    }
+
+    template<typename T>
+    void LinkedMergeSort<T>::sort(amt::DoublyLS<T>& ls, std::function<bool(const T&, const T&)> compare)
+    {
+        this->sortBlocks(ls, compare);
+    }
+
+    template<typename T>
+    template<typename BlockType>
+    void LinkedMergeSort<T>::sortBlocks(amt::ExplicitSequence<BlockType>& es, std::function<bool(const T&, const T&)>& compare)
+    {
+        es.sortBlocks([&compare](const BlockType& a, const BlockType& b)->bool { return compare(a.data_, b.data_); });
+    }
 }
@@ -3,9 +3,15 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_hierarchy.h>
+#include <libds/prefetch.h>
+#include <libds/simd.h>
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <random>
+#include <type_traits>
+#include <vector>
 
 namespace ds::adt {
 
@@ -130,10 +136,18 @@ namespace ds::adt {
         public SequenceTable<K, T, amt::IS<TableItem<K, T>>>
     {
     public:
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+
         void insert(const K& key, T data) override;
         T remove(const K& key) override;
         bool equals(const ADT& other) override;
 
+        // Builds a read-only search index of the keys in Eytzinger (breadth-first) order.
+        // Lookups use the index until the next insert, remove, assign or clear drops it.
+        void freeze();
+        bool isFrozen() const;
+
     protected:
         using BlockType = typename amt::IS<TableItem<K, T>>::BlockType;
 
@@ -141,6 +155,16 @@ namespace ds::adt {
 
     private:
         bool tryFindBlockWithKey(const K& key, size_t firstIndex, size_t lastIndex, BlockType*& lastBlock) const;
+        bool tryFindIndexInFrozen(const K& key, size_t& index) const;
+        void thaw();
+
+    private:
+        // One cache line ahead of the current node holds its great-great-grandsons.
+        static constexpr size_t PREFETCH_STRIDE = sizeof(K) < 64 ? 64 / sizeof(K) : 1;
+
+        // Slot 0 is unused, sons of slot i are at 2i and 2i + 1.
+        std::vector<K> frozenKeys_;
+        std::vector<size_t> frozenIndices_;
     };
 
     template <typename K, typename T>
@@ -210,13 +234,97 @@ namespace ds::adt {
 
     //----------
 
-    template <typename K, typename T, typename ItemType>
+    // Open addressing hash table with items stored inline and a control byte per slot, in the style of SwissTable.
+    // Control bytes of empty and deleted slots are negative, a full slot keeps the low 7 bits of the hash of its key.
+    // A probe compares the control bytes of a whole group of slots with these bits at once and compares keys only
+    // in the matching slots. Groups are probed in triangular steps until a group with an empty slot.
+    // A removed slot becomes empty if its group has an empty slot, since no probe goes past such a group,
+    // otherwise it becomes deleted. Inserts reuse deleted slots, rehashing drops them.
+    template <typename K, typename T>
+    class FlatHashTable :
+        public Table<K, T>,
+        public AUMS<TableItem<K, T>>
+    {
+    public:
+        using HashFunctionType = std::function<size_t(const K&)>;
+
+    public:
+        FlatHashTable();
+        FlatHashTable(const FlatHashTable& other);
+        // The capacity is rounded up to a power of two number of groups.
+        FlatHashTable(HashFunctionType hashFunction, size_t capacity);
+        ~FlatHashTable() override;
+
+        ADT& assign(const ADT& other) override;
+        bool equals(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+
+        void insert(const K& key, T data) override;
+        bool tryFind(const K& key, T*& data) const override;
+        T remove(const K& key) override;
+
+        // Number of slots, at most 7/8 of them are full or deleted.
+        size_t capacity() const;
+
+    private:
+        static constexpr size_t GROUP_SIZE = simd::BYTE_GROUP_SIZE;
+        static constexpr std::int8_t EMPTY = -128;
+        static constexpr std::int8_t DELETED = -2;
+        static const size_t CAPACITY = GROUP_SIZE;
+
+        static size_t maxLoad(size_t capacity);
+        static std::int8_t control(size_t hash);
+
+        // Mixes the hash, so keys hashed to consecutive values, such as integers by std::hash, spread over groups.
+        size_t hashKey(const K& key) const;
+        size_t firstGroup(size_t hash) const;
+        bool tryFindSlot(const K& key, size_t hash, size_t& slot) const;
+        size_t findFreeSlot(size_t hash) const;
+        void allocate(size_t capacity);
+        void rehash(size_t capacity);
+
+    private:
+        std::int8_t* controls_;
+        TableItem<K, T>* items_;
+        size_t capacity_;
+        HashFunctionType hashFunction_;
+        size_t size_;
+        size_t deletedCount_;
+
+    public:
+        class FlatHashTableIterator
+        {
+        public:
+            FlatHashTableIterator(const std::int8_t* control, const std::int8_t* controlsEnd, TableItem<K, T>* item);
+            FlatHashTableIterator& operator++();
+            FlatHashTableIterator operator++(int);
+            bool operator==(const FlatHashTableIterator& other) const;
+            bool operator!=(const FlatHashTableIterator& other) const;
+            TableItem<K, T>& operator*();
+
+        private:
+            void skipFreeSlots();
+
+            const std::int8_t* control_;
+            const std::int8_t* controlsEnd_;
+            TableItem<K, T>* item_;
+        };
+
+        FlatHashTableIterator begin() const;
+        FlatHashTableIterator end() const;
+    };
+
+    //----------
+
+    template <typename K, typename T, typename ItemType, typename HierarchyType = amt::BinaryEH<ItemType>>
     class GeneralBinarySearchTree :
         public Table<K, T>,
         public ADS<ItemType>
     {
     public:
-        using IteratorType = typename amt::BinaryEH<ItemType>::IteratorType;
+        using IteratorType = typename HierarchyType::IteratorType;
 
     public:
         GeneralBinarySearchTree();
@@ -234,9 +342,9 @@ namespace ds::adt {
         IteratorType end() const;
 
     protected:
-        using BSTNodeType = typename amt::BinaryEH<ItemType>::BlockType;
+        using BSTNodeType = typename HierarchyType::BlockType;
 
-        amt::BinaryEH<ItemType>* getHierarchy() const;
+        HierarchyType* getHierarchy() const;
 
         virtual void removeNode(BSTNodeType* node);
         virtual void balanceTree(BSTNodeType* node) { }
@@ -247,6 +355,9 @@ namespace ds::adt {
         void rotateRight(BSTNodeType* node);
 
     private:
+        // Hierarchies supporting it are cloned into one contiguous run of nodes instead of node by node.
+        static HierarchyType* copyHierarchy(const HierarchyType& hierarchy);
+
         size_t size_;
     };
 
@@ -262,6 +373,17 @@ namespace ds::adt {
 
     //----------
 
+    // Binary search tree over the threaded hierarchy, iterated in order without a stack.
+    template <typename K, typename T>
+    class ThreadedBinarySearchTree :
+        public GeneralBinarySearchTree<K, T, TableItem<K, T>, amt::ThreadedBinaryEH<TableItem<K, T>>>
+    {
+    public:
+        bool equals(const ADT& other) override;
+    };
+
+    //----------
+
     template <typename K, typename T>
     struct TreapItem:
         public TableItem<K, T>
@@ -357,9 +479,14 @@ namespace ds::adt {
     template<typename K, typename T, typename SequenceType>
     bool SequenceTable<K, T, SequenceType>::tryFind(const K& key, T*& data) const
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        BlockType* blockWithKey = this->findBlockWithKey(key);
+        if (blockWithKey == nullptr)
+        {
+            return false;
+        }
+
+        data = &blockWithKey->data_.data_;
+        return true;
     }
 
     template <typename K, typename T, typename SequenceType>
@@ -385,9 +512,25 @@ namespace ds::adt {
     template<typename K, typename T, typename SequenceType>
     typename UnsortedSequenceTable<K, T, SequenceType>::BlockType* UnsortedSequenceTable<K, T, SequenceType>::findBlockWithKey(const K& key) const
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        SequenceType* sequence = this->getSequence();
+
+        if constexpr (std::is_same_v<SequenceType, amt::IS<TableItem<K, T>>>)
+        {
+            // Keys are interleaved with data, so a plain loop over the buffer replaces the per block std::function.
+            const size_t size = sequence->size();
+            for (size_t index = 0; index < size; ++index)
+            {
+                if (sequence->read(index)->data_.key_ == key)
+                {
+                    return sequence->access(index);
+                }
+            }
+            return nullptr;
+        }
+        else
+        {
+            return sequence->findBlockWithProperty([&key](BlockType* block) { return block->data_.key_ == key; });
+        }
     }
 
     //----------
@@ -444,25 +587,72 @@ namespace ds::adt {
 
     //----------
 
+    template<typename K, typename T>
+    ADT& SortedSequenceTable<K, T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            this->thaw();
+            SequenceTable<K, T, amt::IS<TableItem<K, T>>>::assign(other);
+        }
+
+        return *this;
+    }
+
+    template<typename K, typename T>
+    void SortedSequenceTable<K, T>::clear()
+    {
+        this->thaw();
+        SequenceTable<K, T, amt::IS<TableItem<K, T>>>::clear();
+    }
+
     template<typename K, typename T>
     void SortedSequenceTable<K, T>::insert(const K& key, T data)
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        BlockType* lastBlock = nullptr;
+        if (this->tryFindBlockWithKey(key, 0, this->size(), lastBlock))
+        {
+            throw std::logic_error("Key already present!");
+        }
+
+        this->thaw();
+        amt::IS<TableItem<K, T>>* sequence = this->getSequence();
+        BlockType& block = lastBlock == nullptr
+            ? sequence->insertLast()
+            : lastBlock->data_.key_ < key
+                ? sequence->insertAfter(*lastBlock)
+                : sequence->insertBefore(*lastBlock);
+        block.data_.key_ = key;
+        block.data_.data_ = data;
     }
 
     template<typename K, typename T>
     T SortedSequenceTable<K, T>::remove(const K& key)
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        BlockType* blockWithKey = this->findBlockWithKey(key);
+        if (blockWithKey == nullptr)
+        {
+            throw std::out_of_range("No such key!");
+        }
+
+        this->thaw();
+        amt::IS<TableItem<K, T>>* sequence = this->getSequence();
+        T result = blockWithKey->data_.data_;
+        sequence->remove(sequence->calculateIndex(*blockWithKey));
+        return result;
     }
 
     template<typename K, typename T>
     typename SortedSequenceTable<K, T>::BlockType* SortedSequenceTable<K, T>::findBlockWithKey(const K& key) const
     {
+        if (this->isFrozen())
+        {
+            size_t index = 0;
+            return this->tryFindIndexInFrozen(key, index)
+                ? this->getSequence()->access(index)
+                : nullptr;
+        }
+
         BlockType* blockWithKey = nullptr;
         return this->tryFindBlockWithKey(key, 0, this->size(), blockWithKey)
             ? blockWithKey
@@ -472,17 +662,114 @@ namespace ds::adt {
     template<typename K, typename T>
     bool SortedSequenceTable<K, T>::equals(const ADT& other)
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        return this->areEqual(*this, other);
+    }
+
+    template<typename K, typename T>
+    void SortedSequenceTable<K, T>::freeze()
+    {
+        const amt::IS<TableItem<K, T>>* sequence = this->getSequence();
+        const size_t size = sequence->size();
+        frozenKeys_.assign(size + 1, K());
+        frozenIndices_.assign(size + 1, 0);
+
+        // In-order walk of the complete binary tree over slots 1..size visits the slots in key order.
+        size_t slot = 1;
+        while (2 * slot <= size)
+        {
+            slot *= 2;
+        }
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            frozenKeys_[slot] = sequence->read(index)->data_.key_;
+            frozenIndices_[slot] = index;
+
+            if (2 * slot + 1 <= size)
+            {
+                slot = 2 * slot + 1;
+                while (2 * slot <= size)
+                {
+                    slot *= 2;
+                }
+            }
+            else
+            {
+                slot >>= simd::scalar::countTrailingZeros(~static_cast<std::uint64_t>(slot)) + 1;
+            }
+        }
+    }
+
+    template<typename K, typename T>
+    bool SortedSequenceTable<K, T>::isFrozen() const
+    {
+        return !frozenKeys_.empty();
     }
 
     template<typename K, typename T>
     bool SortedSequenceTable<K, T>::tryFindBlockWithKey(const K& key, size_t firstIndex, size_t lastIndex, BlockType*& lastBlock) const
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        amt::IS<TableItem<K, T>>* sequence = this->getSequence();
+        if (firstIndex >= lastIndex)
+        {
+            lastBlock = nullptr;
+            return false;
+        }
+
+        // Blocks are contiguous, so probes read them directly and only the final block is accessed.
+        const BlockType* blocks = sequence->read(0);
+        size_t middleIndex = firstIndex;
+        bool found = false;
+        while (firstIndex < lastIndex && !found)
+        {
+            middleIndex = firstIndex + (lastIndex - firstIndex) / 2;
+            const K& middleKey = blocks[middleIndex].data_.key_;
+            if (middleKey == key)
+            {
+                found = true;
+            }
+            else if (middleKey < key)
+            {
+                firstIndex = middleIndex + 1;
+            }
+            else
+            {
+                lastIndex = middleIndex;
+            }
+        }
+
+        lastBlock = sequence->access(middleIndex);
+        return found;
+    }
+
+    template<typename K, typename T>
+    bool SortedSequenceTable<K, T>::tryFindIndexInFrozen(const K& key, size_t& index) const
+    {
+        // Branchless descent, the comparison only selects the son. Each step goes right past smaller keys,
+        // so the last slot with a key not smaller than the searched one is where the descent last went left.
+        const K* keys = frozenKeys_.data();
+        const size_t size = frozenKeys_.size() - 1;
+        size_t slot = 1;
+        while (slot <= size)
+        {
+            ds::prefetch(keys + (std::min)(PREFETCH_STRIDE * slot, size));
+            slot = 2 * slot + static_cast<size_t>(keys[slot] < key);
+        }
+        slot >>= simd::scalar::countTrailingZeros(~static_cast<std::uint64_t>(slot)) + 1;
+
+        if (slot == 0 || !(keys[slot] == key))
+        {
+            return false;
+        }
+        index = frozenIndices_[slot];
+        return true;
+    }
+
+    template<typename K, typename T>
+    void SortedSequenceTable<K, T>::thaw()
+    {
+        frozenKeys_.clear();
+        frozenIndices_.clear();
     }
 
     //----------
@@ -680,111 +967,520 @@ namespace ds::adt {
 
     //----------
 
-    template<typename K, typename T, typename ItemType>
-    GeneralBinarySearchTree<K, T, ItemType>::GeneralBinarySearchTree():
-        ADS<ItemType>(new amt::BinaryEH<ItemType>()),
+    template<typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTable() :
+        FlatHashTable([](const K& key) { return std::hash<K>()(key); }, CAPACITY)
+    {
+    }
+
+    template<typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTable(const FlatHashTable& other) :
+        controls_(nullptr),
+        items_(nullptr),
+        capacity_(0),
+        hashFunction_(other.hashFunction_),
+        size_(0),
+        deletedCount_(0)
+    {
+        assign(other);
+    }
+
+    template<typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTable(HashFunctionType hashFunction, size_t capacity) :
+        controls_(nullptr),
+        items_(nullptr),
+        capacity_(0),
+        hashFunction_(hashFunction),
+        size_(0),
+        deletedCount_(0)
+    {
+        size_t groupCount = 1;
+        while (groupCount * GROUP_SIZE < capacity)
+        {
+            groupCount *= 2;
+        }
+        this->allocate(groupCount * GROUP_SIZE);
+    }
+
+    template<typename K, typename T>
+    FlatHashTable<K, T>::~FlatHashTable()
+    {
+        delete[] controls_;
+        delete[] items_;
+    }
+
+    template<typename K, typename T>
+    ADT& FlatHashTable<K, T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const FlatHashTable& otherTable = dynamic_cast<const FlatHashTable&>(other);
+            if (capacity_ != otherTable.capacity_)
+            {
+                delete[] controls_;
+                delete[] items_;
+                this->allocate(otherTable.capacity_);
+            }
+            else
+            {
+                this->clear();
+            }
+
+            // The same hash function puts every item into the same slot as in the other table.
+            hashFunction_ = otherTable.hashFunction_;
+            std::copy(otherTable.controls_, otherTable.controls_ + capacity_, controls_);
+            for (size_t slot = 0; slot < capacity_; ++slot)
+            {
+                if (controls_[slot] >= 0)
+                {
+                    items_[slot] = otherTable.items_[slot];
+                }
+            }
+            size_ = otherTable.size_;
+            deletedCount_ = otherTable.deletedCount_;
+        }
+
+        return *this;
+    }
+
+    template<typename K, typename T>
+    bool FlatHashTable<K, T>::equals(const ADT& other)
+    {
+        return this->areEqual(*this, other);
+    }
+
+    template<typename K, typename T>
+    void FlatHashTable<K, T>::clear()
+    {
+        for (size_t slot = 0; slot < capacity_; ++slot)
+        {
+            if (controls_[slot] >= 0)
+            {
+                items_[slot] = TableItem<K, T>();
+            }
+            controls_[slot] = EMPTY;
+        }
+        size_ = 0;
+        deletedCount_ = 0;
+    }
+
+    template<typename K, typename T>
+    size_t FlatHashTable<K, T>::size() const
+    {
+        return size_;
+    }
+
+    template<typename K, typename T>
+    bool FlatHashTable<K, T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template<typename K, typename T>
+    void FlatHashTable<K, T>::insert(const K& key, T data)
+    {
+        const size_t hash = this->hashKey(key);
+        size_t slot = 0;
+        if (this->tryFindSlot(key, hash, slot))
+        {
+            throw std::logic_error("Key already present!");
+        }
+
+        if (size_ + deletedCount_ >= maxLoad(capacity_))
+        {
+            // Mostly deleted slots are dropped in place, otherwise the table doubles.
+            this->rehash(2 * (size_ + 1) > maxLoad(capacity_) ? 2 * capacity_ : capacity_);
+        }
+
+        slot = this->findFreeSlot(hash);
+        deletedCount_ -= controls_[slot] == DELETED ? 1 : 0;
+        controls_[slot] = control(hash);
+        items_[slot].key_ = key;
+        items_[slot].data_ = std::move(data);
+        ++size_;
+    }
+
+    template<typename K, typename T>
+    bool FlatHashTable<K, T>::tryFind(const K& key, T*& data) const
+    {
+        size_t slot = 0;
+        if (!this->tryFindSlot(key, this->hashKey(key), slot))
+        {
+            return false;
+        }
+
+        data = &items_[slot].data_;
+        return true;
+    }
+
+    template<typename K, typename T>
+    T FlatHashTable<K, T>::remove(const K& key)
+    {
+        size_t slot = 0;
+        if (!this->tryFindSlot(key, this->hashKey(key), slot))
+        {
+            throw std::out_of_range("No such key!");
+        }
+
+        T result = std::move(items_[slot].data_);
+        items_[slot] = TableItem<K, T>();
+        if (simd::matchBytes(controls_ + slot / GROUP_SIZE * GROUP_SIZE, EMPTY) != 0)
+        {
+            controls_[slot] = EMPTY;
+        }
+        else
+        {
+            controls_[slot] = DELETED;
+            ++deletedCount_;
+        }
+        --size_;
+        return result;
+    }
+
+    template<typename K, typename T>
+    size_t FlatHashTable<K, T>::capacity() const
+    {
+        return capacity_;
+    }
+
+    template<typename K, typename T>
+    size_t FlatHashTable<K, T>::maxLoad(size_t capacity)
+    {
+        return capacity - capacity / 8;
+    }
+
+    template<typename K, typename T>
+    std::int8_t FlatHashTable<K, T>::control(size_t hash)
+    {
+        return static_cast<std::int8_t>(hash & 0x7F);
+    }
+
+    template<typename K, typename T>
+    size_t FlatHashTable<K, T>::hashKey(const K& key) const
+    {
+        std::uint64_t hash = static_cast<std::uint64_t>(hashFunction_(key));
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash);
+    }
+
+    template<typename K, typename T>
+    size_t FlatHashTable<K, T>::firstGroup(size_t hash) const
+    {
+        return (hash >> 7) & (capacity_ / GROUP_SIZE - 1);
+    }
+
+    template<typename K, typename T>
+    bool FlatHashTable<K, T>::tryFindSlot(const K& key, size_t hash, size_t& slot) const
+    {
+        const size_t groupMask = capacity_ / GROUP_SIZE - 1;
+        const std::int8_t keyControl = control(hash);
+        size_t group = this->firstGroup(hash);
+        for (size_t step = 1; ; ++step)
+        {
+            const std::int8_t* controls = controls_ + group * GROUP_SIZE;
+            // Items of the group are fetched while its control bytes are matched, so a hit does not wait for a second miss.
+            prefetch(items_ + group * GROUP_SIZE);
+            prefetch(items_ + group * GROUP_SIZE + GROUP_SIZE / 2);
+            for (unsigned mask = simd::matchBytes(controls, keyControl); mask != 0; mask &= mask - 1)
+            {
+                const size_t candidate = group * GROUP_SIZE + simd::scalar::countTrailingZeros(mask);
+                if (items_[candidate].key_ == key)
+                {
+                    slot = candidate;
+                    return true;
+                }
+            }
+
+            // There is always an empty slot, so the probe ends.
+            if (simd::matchBytes(controls, EMPTY) != 0)
+            {
+                return false;
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    template<typename K, typename T>
+    size_t FlatHashTable<K, T>::findFreeSlot(size_t hash) const
+    {
+        const size_t groupMask = capacity_ / GROUP_SIZE - 1;
+        size_t group = this->firstGroup(hash);
+        for (size_t step = 1; ; ++step)
+        {
+            const unsigned mask = simd::negativeBytes(controls_ + group * GROUP_SIZE);
+            if (mask != 0)
+            {
+                return group * GROUP_SIZE + simd::scalar::countTrailingZeros(mask);
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    template<typename K, typename T>
+    void FlatHashTable<K, T>::allocate(size_t capacity)
+    {
+        // Items are default constructed and free slots keep default items, so removal resets its item to release the data.
+        controls_ = new std::int8_t[capacity];
+        items_ = new TableItem<K, T>[capacity];
+        capacity_ = capacity;
+        std::fill(controls_, controls_ + capacity_, EMPTY);
+        size_ = 0;
+        deletedCount_ = 0;
+    }
+
+    template<typename K, typename T>
+    void FlatHashTable<K, T>::rehash(size_t capacity)
+    {
+        std::int8_t* oldControls = controls_;
+        TableItem<K, T>* oldItems = items_;
+        const size_t oldCapacity = capacity_;
+        const size_t size = size_;
+
+        this->allocate(capacity);
+        for (size_t oldSlot = 0; oldSlot < oldCapacity; ++oldSlot)
+        {
+            if (oldControls[oldSlot] >= 0)
+            {
+                const size_t slot = this->findFreeSlot(this->hashKey(oldItems[oldSlot].key_));
+                controls_[slot] = oldControls[oldSlot];
+                items_[slot] = std::move(oldItems[oldSlot]);
+            }
+        }
+        size_ = size;
+
+        delete[] oldControls;
+        delete[] oldItems;
+    }
+
+    template<typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTableIterator::FlatHashTableIterator
+        (const std::int8_t* control, const std::int8_t* controlsEnd, TableItem<K, T>* item) :
+        control_(control),
+        controlsEnd_(controlsEnd),
+        item_(item)
+    {
+        this->skipFreeSlots();
+    }
+
+    template<typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator& FlatHashTable<K, T>::FlatHashTableIterator::operator++()
+    {
+        ++control_;
+        ++item_;
+        this->skipFreeSlots();
+        return *this;
+    }
+
+    template<typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator FlatHashTable<K, T>::FlatHashTableIterator::operator++(int)
+    {
+        FlatHashTableIterator tmp(*this);
+        this->operator++();
+        return tmp;
+    }
+
+    template<typename K, typename T>
+    bool FlatHashTable<K, T>::FlatHashTableIterator::operator==(const FlatHashTableIterator& other) const
+    {
+        return control_ == other.control_;
+    }
+
+    template<typename K, typename T>
+    bool FlatHashTable<K, T>::FlatHashTableIterator::operator!=(const FlatHashTableIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template<typename K, typename T>
+    TableItem<K, T>& FlatHashTable<K, T>::FlatHashTableIterator::operator*()
+    {
+        return *item_;
+    }
+
+    template<typename K, typename T>
+    void FlatHashTable<K, T>::FlatHashTableIterator::skipFreeSlots()
+    {
+        while (control_ != controlsEnd_ && *control_ < 0)
+        {
+            ++control_;
+            ++item_;
+        }
+    }
+
+    template<typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator FlatHashTable<K, T>::begin() const
+    {
+        return FlatHashTableIterator(controls_, controls_ + capacity_, items_);
+    }
+
+    template<typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator FlatHashTable<K, T>::end() const
+    {
+        return FlatHashTableIterator(controls_ + capacity_, controls_ + capacity_, items_ + capacity_);
+    }
+
+    //----------
+
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::GeneralBinarySearchTree():
+        ADS<ItemType>(new HierarchyType()),
         size_(0)
     {
     }
 
-    template<typename K, typename T, typename ItemType>
-    GeneralBinarySearchTree<K, T, ItemType>::GeneralBinarySearchTree(const GeneralBinarySearchTree& other):
-        ADS<ItemType>(new amt::BinaryEH<ItemType>(), other),
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::GeneralBinarySearchTree(const GeneralBinarySearchTree& other):
+        ADS<ItemType>(copyHierarchy(*other.getHierarchy())),
         size_(other.size_)
     {
     }
 
-    template<typename K, typename T, typename ItemType>
-    GeneralBinarySearchTree<K, T, ItemType>::~GeneralBinarySearchTree()
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::~GeneralBinarySearchTree()
     {
         size_ = 0;
     }
 
-    template<typename K, typename T, typename ItemType>
-    size_t GeneralBinarySearchTree<K, T, ItemType>::size() const
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    size_t GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::size() const
     {
         return size_;
     }
 
-    template<typename K, typename T, typename ItemType>
-    void GeneralBinarySearchTree<K, T, ItemType>::clear()
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    void GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::clear()
     {
         ADS<ItemType>::clear();
         size_ = 0;
     }
 
-    template<typename K, typename T, typename ItemType>
-    void GeneralBinarySearchTree<K, T, ItemType>::insert(const K& key, T data)
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    void GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::insert(const K& key, T data)
     {
         // TODO 11
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
 
-    template<typename K, typename T, typename ItemType>
-    bool GeneralBinarySearchTree<K, T, ItemType>::tryFind(const K& key, T*& data) const
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    bool GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::tryFind(const K& key, T*& data) const
     {
         // TODO 11
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
 
-    template<typename K, typename T, typename ItemType>
-    T GeneralBinarySearchTree<K, T, ItemType>::remove(const K& key)
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    T GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::remove(const K& key)
     {
         // TODO 11
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
 
-    template <typename K, typename T, typename ItemType>
-    typename GeneralBinarySearchTree<K, T, ItemType>::IteratorType GeneralBinarySearchTree<K, T, ItemType>::begin() const
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    typename GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::IteratorType GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::begin() const
     {
         return this->getHierarchy()->begin();
     }
 
-    template <typename K, typename T, typename ItemType>
-    typename GeneralBinarySearchTree<K, T, ItemType>::IteratorType GeneralBinarySearchTree<K, T, ItemType>::end() const
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    typename GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::IteratorType GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::end() const
     {
         return this->getHierarchy()->end();
     }
 
-    template<typename K, typename T, typename ItemType>
-    amt::BinaryEH<ItemType>* GeneralBinarySearchTree<K, T, ItemType>::getHierarchy() const
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    HierarchyType* GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::getHierarchy() const
     {
-        return dynamic_cast<amt::BinaryEH<ItemType>*>(this->memoryStructure_);
+        return dynamic_cast<HierarchyType*>(this->memoryStructure_);
     }
     
-    template<typename K, typename T, typename ItemType>
-    void GeneralBinarySearchTree<K, T, ItemType>::removeNode(BSTNodeType* node)
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    HierarchyType* GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::copyHierarchy(const HierarchyType& hierarchy)
     {
-        // TODO 11
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if constexpr (std::is_constructible_v<HierarchyType, const HierarchyType&, WorkStealingPool*>)
+        {
+            return new HierarchyType(hierarchy, nullptr);
+        }
+        else
+        {
+            return new HierarchyType(hierarchy);
+        }
     }
 
-    template<typename K, typename T, typename ItemType>
-    bool GeneralBinarySearchTree<K, T, ItemType>::tryFindNodeWithKey(const K& key, BSTNodeType*& node) const
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    void GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::removeNode(BSTNodeType* node)
     {
         // TODO 11
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
 
-    template<typename K, typename T, typename ItemType>
-    void GeneralBinarySearchTree<K, T, ItemType>::rotateLeft(BSTNodeType* node)
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    bool GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::tryFindNodeWithKey(const K& key, BSTNodeType*& node) const
     {
         // TODO 11
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
 
-    template<typename K, typename T, typename ItemType>
-    void GeneralBinarySearchTree<K, T, ItemType>::rotateRight(BSTNodeType* node)
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    void GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::rotateLeft(BSTNodeType* node)
+    {
+        // The right son node takes the place of its parent, which becomes its left son.
+        // Sons are detached before they are linked again, so the hierarchy keeps the parent links
+        // (and the threads of a threaded hierarchy) of every moved subtree correct.
+        HierarchyType* hierarchy = this->getHierarchy();
+        BSTNodeType* parent = hierarchy->accessParent(*node);
+        BSTNodeType* grandParent = hierarchy->accessParent(*parent);
+        BSTNodeType* leftSon = hierarchy->accessLeftSon(*node);
+        const bool parentIsLeftSon = hierarchy->isLeftSon(*parent);
+
+        hierarchy->changeLeftSon(*node, nullptr);
+        hierarchy->changeRightSon(*parent, leftSon);
+        if (grandParent == nullptr)
+        {
+            hierarchy->changeRoot(node);
+        }
+        else if (parentIsLeftSon)
+        {
+            hierarchy->changeLeftSon(*grandParent, node);
+        }
+        else
+        {
+            hierarchy->changeRightSon(*grandParent, node);
+        }
+        hierarchy->changeLeftSon(*node, parent);
+    }
+
+    template<typename K, typename T, typename ItemType, typename HierarchyType>
+    void GeneralBinarySearchTree<K, T, ItemType, HierarchyType>::rotateRight(BSTNodeType* node)
     {
-        // TODO 11
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        // Mirror image of the left rotation.
+        HierarchyType* hierarchy = this->getHierarchy();
+        BSTNodeType* parent = hierarchy->accessParent(*node);
+        BSTNodeType* grandParent = hierarchy->accessParent(*parent);
+        BSTNodeType* rightSon = hierarchy->accessRightSon(*node);
+        const bool parentIsLeftSon = hierarchy->isLeftSon(*parent);
+
+        hierarchy->changeRightSon(*node, nullptr);
+        hierarchy->changeLeftSon(*parent, rightSon);
+        if (grandParent == nullptr)
+        {
+            hierarchy->changeRoot(node);
+        }
+        else if (parentIsLeftSon)
+        {
+            hierarchy->changeLeftSon(*grandParent, node);
+        }
+        else
+        {
+            hierarchy->changeRightSon(*grandParent, node);
+        }
+        hierarchy->changeRightSon(*node, parent);
     }
 
     //----------
@@ -797,6 +1493,12 @@ namespace ds::adt {
         throw std::runtime_error("Not implemented yet");
     }
 
+    template<typename K, typename T>
+    bool ThreadedBinarySearchTree<K, T>::equals(const ADT& other)
+    {
+        return this->areEqual(*this, other);
+    }
+
     //----------
 
     template<typename K, typename T>
@@ -3,6 +3,7 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_hierarchy.h>
 #include <libds/amt/explicit_hierarchy.h>
+#include <libds/amt/veb_implicit_hierarchy.h>
 
 namespace ds::adt {
 
@@ -99,11 +100,19 @@ namespace ds::adt {
 
     //----------
 
-    template<typename T>
-    class ImplicitBinaryTree : public GeneralTree<T, amt::ImplicitHierarchy<T, 2>>
+    /**
+     *  @brief Binary tree over an implicit hierarchy.
+     *  The default BFS layout may be replaced with amt::VebImplicitHierarchy<T>,
+     *  which keeps root-to-leaf paths of large trees cache friendly.
+     */
+    template<typename T, typename HierarchyType = amt::ImplicitHierarchy<T, 2>>
+    class ImplicitBinaryTree : public GeneralTree<T, HierarchyType>
     {
     };
 
+    template<typename T>
+    using VebImplicitBinaryTree = ImplicitBinaryTree<T, amt::VebImplicitHierarchy<T>>;
+
     //----------
 
     template<typename T>
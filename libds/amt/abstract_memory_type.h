@@ -87,10 +87,17 @@ namespace ds::amt {
 		size_t getCapacity();
 		void changeCapacity(size_t newCapacity);
 
+		// Access handing out writable blocks copies a buffer shared by copy-on-write, read-only access keeps it shared.
+		void setCopyOnWrite(bool copyOnWrite);
+		bool isCopyOnWrite() const;
+		void detach();
+
 		static const int INIT_CAPACITY = 10;
 
 	protected:
 		MemoryManagerType* getMemoryManager() const;
+		// Block at the index for writing, a buffer shared by copy-on-write is copied first.
+		BlockType* accessBlockAt(size_t index) const;
 	};
 
 	template<typename DataType>
@@ -303,12 +310,36 @@ namespace ds::amt {
 		this->getMemoryManager()->changeCapacity(newCapacity);
 	}
 
+	template<typename DataType>
+    void ImplicitAbstractMemoryStructure<DataType>::setCopyOnWrite(bool copyOnWrite)
+	{
+		this->getMemoryManager()->setCopyOnWrite(copyOnWrite);
+	}
+
+	template<typename DataType>
+    bool ImplicitAbstractMemoryStructure<DataType>::isCopyOnWrite() const
+	{
+		return this->getMemoryManager()->isCopyOnWrite();
+	}
+
+	template<typename DataType>
+    void ImplicitAbstractMemoryStructure<DataType>::detach()
+	{
+		this->getMemoryManager()->detach();
+	}
+
 	template<typename DataType>
     auto ImplicitAbstractMemoryStructure<DataType>::getMemoryManager() const -> MemoryManagerType*
 	{
 		return dynamic_cast<MemoryManagerType*>(AMS<BlockType>::memoryManager_);
 	}
 
+	template<typename DataType>
+    auto ImplicitAbstractMemoryStructure<DataType>::accessBlockAt(size_t index) const -> BlockType*
+	{
+		return &this->getMemoryManager()->getBlockAt(index);
+	}
+
 	template<typename BlockType>
     ExplicitAbstractMemoryStructure<BlockType>::ExplicitAbstractMemoryStructure():
 		AMS<BlockType>(new mm::MemoryManager<BlockType>())
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <libds/amt/explicit_hierarchy.h>
+#include <libds/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace ds::amt {
+
+    /**
+     * @brief Build-once index answering ancestor queries over an explicit hierarchy.
+     *
+     * Nodes are numbered in pre-order. The lowest common ancestor of two nodes is the parent
+     * of the highest node between them in pre-order, which is found in O(1) by a sparse table
+     * over the levels. The level ancestor is the last node of the target level preceding
+     * the node in pre-order, found by a binary search in O(log n).
+     * Nodes are mapped to their numbers by a hash table.
+     *
+     * The index takes O(n log n) memory and must be rebuilt after the hierarchy changes,
+     * queries on an out of date index throw std::logic_error.
+     */
+    template<typename BlockType>
+    class AncestorIndex
+    {
+    public:
+        explicit AncestorIndex(const ExplicitHierarchy<BlockType>& hierarchy);
+
+        void rebuild();
+        bool isValid() const;
+        size_t size() const;
+
+        size_t level(const BlockType& node) const;
+        BlockType* lca(const BlockType& first, const BlockType& second) const;
+        // Ancestor k levels above the node (the node itself for k == 0), nullptr above the root.
+        BlockType* levelAncestor(const BlockType& node, size_t k) const;
+
+    private:
+        using IndexType = std::uint32_t;
+
+        size_t indexOf(const BlockType& node) const;
+        IndexType higherOf(IndexType first, IndexType second) const;
+        IndexType highestIn(size_t first, size_t last) const;
+
+        const ExplicitHierarchy<BlockType>* hierarchy_;
+        size_t modificationCount_;
+
+        std::unordered_map<const BlockType*, IndexType> indices_;
+        std::vector<BlockType*> nodes_;
+        std::vector<IndexType> levels_;
+        std::vector<IndexType> parents_;
+        // Row r holds the highest node of every range of 2^r nodes.
+        std::vector<std::vector<IndexType>> highest_;
+        // Numbers of the nodes of every level, ascending.
+        std::vector<std::vector<IndexType>> levelNodes_;
+    };
+
+    //----------
+
+    template<typename BlockType>
+    AncestorIndex<BlockType>::AncestorIndex(const ExplicitHierarchy<BlockType>& hierarchy) :
+        hierarchy_(&hierarchy),
+        modificationCount_(0)
+    {
+        this->rebuild();
+    }
+
+    template<typename BlockType>
+    void AncestorIndex<BlockType>::rebuild()
+    {
+        indices_.clear();
+        nodes_.clear();
+        levels_.clear();
+        parents_.clear();
+        highest_.clear();
+        levelNodes_.clear();
+
+        // The path from the root to the current node is kept on a stack,
+        // so the parent of the next node in pre-order is found without a lookup.
+        std::vector<IndexType> path;
+        hierarchy_->processPreOrder(hierarchy_->accessRoot(), [&](const BlockType* b)
+            {
+                if (nodes_.size() == std::numeric_limits<IndexType>::max())
+                {
+                    throw std::length_error("Hierarchy is too large to be indexed!");
+                }
+
+                const BlockType* parent = hierarchy_->accessParent(*b);
+                while (!path.empty() && nodes_[path.back()] != parent)
+                {
+                    path.pop_back();
+                }
+
+                const IndexType index = static_cast<IndexType>(nodes_.size());
+                const IndexType level = static_cast<IndexType>(path.size());
+                indices_.emplace(b, index);
+                nodes_.push_back(const_cast<BlockType*>(b));
+                levels_.push_back(level);
+                parents_.push_back(path.empty() ? index : path.back());
+                if (levelNodes_.size() <= level)
+                {
+                    levelNodes_.emplace_back();
+                }
+                levelNodes_[level].push_back(index);
+                path.push_back(index);
+            });
+
+        const size_t count = nodes_.size();
+        if (count > 0)
+        {
+            highest_.emplace_back(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                highest_[0][i] = static_cast<IndexType>(i);
+            }
+            for (size_t width = 1; 2 * width <= count; width *= 2)
+            {
+                const std::vector<IndexType>& previous = highest_.back();
+                std::vector<IndexType> row(count - 2 * width + 1);
+                for (size_t i = 0; i < row.size(); ++i)
+                {
+                    row[i] = this->higherOf(previous[i], previous[i + width]);
+                }
+                highest_.push_back(std::move(row));
+            }
+        }
+
+        modificationCount_ = hierarchy_->getModificationCount();
+    }
+
+    template<typename BlockType>
+    bool AncestorIndex<BlockType>::isValid() const
+    {
+        return modificationCount_ == hierarchy_->getModificationCount();
+    }
+
+    template<typename BlockType>
+    size_t AncestorIndex<BlockType>::size() const
+    {
+        return nodes_.size();
+    }
+
+    template<typename BlockType>
+    size_t AncestorIndex<BlockType>::level(const BlockType& node) const
+    {
+        return levels_[this->indexOf(node)];
+    }
+
+    template<typename BlockType>
+    BlockType* AncestorIndex<BlockType>::lca(const BlockType& first, const BlockType& second) const
+    {
+        size_t firstIndex = this->indexOf(first);
+        size_t secondIndex = this->indexOf(second);
+        if (firstIndex == secondIndex)
+        {
+            return nodes_[firstIndex];
+        }
+        if (firstIndex > secondIndex)
+        {
+            std::swap(firstIndex, secondIndex);
+        }
+
+        // Nodes after the first one up to the second one lie in sub-hierarchies of the sons of the ancestor,
+        // the highest of them is one of these sons.
+        return nodes_[parents_[this->highestIn(firstIndex + 1, secondIndex)]];
+    }
+
+    template<typename BlockType>
+    BlockType* AncestorIndex<BlockType>::levelAncestor(const BlockType& node, size_t k) const
+    {
+        const size_t index = this->indexOf(node);
+        const size_t nodeLevel = levels_[index];
+        if (k > nodeLevel)
+        {
+            return nullptr;
+        }
+
+        const std::vector<IndexType>& candidates = levelNodes_[nodeLevel - k];
+        auto it = std::upper_bound(candidates.begin(), candidates.end(), static_cast<IndexType>(index));
+        return nodes_[*(it - 1)];
+    }
+
+    template<typename BlockType>
+    size_t AncestorIndex<BlockType>::indexOf(const BlockType& node) const
+    {
+        if (!this->isValid())
+        {
+            throw std::logic_error("Hierarchy was modified after the index was built!");
+        }
+
+        auto it = indices_.find(&node);
+        if (it == indices_.end())
+        {
+            throw std::out_of_range("Node is not in the indexed hierarchy!");
+        }
+        return it->second;
+    }
+
+    template<typename BlockType>
+    auto AncestorIndex<BlockType>::higherOf(IndexType first, IndexType second) const -> IndexType
+    {
+        return levels_[second] < levels_[first] ? second : first;
+    }
+
+    template<typename BlockType>
+    auto AncestorIndex<BlockType>::highestIn(size_t first, size_t last) const -> IndexType
+    {
+        const size_t row = simd::scalar::floorLog2(last - first + 1);
+        const size_t width = static_cast<size_t>(1) << row;
+        return this->higherOf(highest_[row][first], highest_[row][last + 1 - width]);
+    }
+}
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/network.h>
+#include <libds/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace ds::amt {
+
+	template<typename DataType>
+	struct BitMatrixNetworkBlock :
+		public MemoryBlock<DataType>
+	{
+		BitMatrixNetworkBlock() : gateIndex_(0) {}
+
+		size_t gateIndex_;
+	};
+
+	//----------
+
+	/**
+	 *  @brief Network of dense relations kept in an adjacency matrix of bits, one packed row of words per node.
+	 *
+	 *  relationExists, connect and disconnect take O(1), degree counts bits of a row and the i-th related node
+	 *  is found by a scan of a row, both in O(n / 64). Relations form sets, so connecting related nodes again
+	 *  does nothing and disconnecting unrelated nodes does nothing either. Like in explicit networks, a relation
+	 *  is stored in the rows of both of its nodes, a loop only once. Rows take n^2 / 8 bytes for n nodes, less
+	 *  than relation lists of pointers once a node is related to more than about one in a hundred nodes.
+	 *  Like an implicit gate, removal moves the last node to the place of the removed one.
+	 */
+	template<typename DataType>
+	class BitMatrixNetwork :
+		public Network<BitMatrixNetworkBlock<DataType>>,
+		public ExplicitAMS<BitMatrixNetworkBlock<DataType>>
+	{
+	public:
+		using BlockType = BitMatrixNetworkBlock<DataType>;
+		using WordType = std::uint64_t;
+
+		static constexpr size_t WORD_BITS = 64;
+
+		BitMatrixNetwork();
+		BitMatrixNetwork(const BitMatrixNetwork<DataType>& other);
+		~BitMatrixNetwork() override;
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		size_t size() const override;
+		bool equals(const AMT& other) override;
+
+		size_t relationCount() const override;
+		size_t degree(const BlockType& node) const override;
+
+		BlockType* accessNodeFromGate(size_t order) const override; // throw(std::out_of_range)
+		BlockType* accessNodeFromNode(const BlockType& node, size_t order) const override; // throw(std::out_of_range)
+
+		bool relationExists(const BlockType& nodeA, const BlockType& nodeB) const override;
+
+		BlockType& insert() override;
+		void remove(BlockType* node) override;
+
+		void connect(BlockType& nodeA, BlockType& nodeB) override;
+		void disconnect(BlockType& nodeA, BlockType& nodeB) override;
+
+		// Number of nodes related to both nodes, by an AND of their rows.
+		size_t commonNeighbourCount(const BlockType& nodeA, const BlockType& nodeB) const;
+		// Number of nodes related to either node, by an OR of their rows.
+		size_t neighbourUnionCount(const BlockType& nodeA, const BlockType& nodeB) const;
+		// Number of triangles of distinct nodes, every relation ANDs the rows of its nodes above the higher node.
+		size_t triangleCount() const;
+
+		// Words of the row of the node, bit i of the row is set if the node is related to the i-th node of the gate.
+		// They are valid until a node is inserted or removed.
+		const WordType* row(const BlockType& node) const;
+		size_t rowWordCount() const;
+
+	private:
+		WordType* row(size_t index);
+		const WordType* row(size_t index) const;
+		bool testBit(size_t rowIndex, size_t column) const;
+		// Sets or clears the bit, returns whether it changed.
+		bool changeBit(size_t rowIndex, size_t column, bool value);
+		void growRows();
+
+		std::vector<BlockType*> nodes_;
+		// Row i takes the words rowWordCount_ * i to rowWordCount_ * (i + 1) - 1, columns above the size are zero.
+		std::vector<WordType> words_;
+		size_t rowWordCount_;
+		size_t relationCount_;
+	};
+
+	//----------
+
+	template<typename DataType>
+	BitMatrixNetwork<DataType>::BitMatrixNetwork() :
+		ExplicitAMS<BlockType>(),
+		nodes_(),
+		words_(),
+		rowWordCount_(0),
+		relationCount_(0)
+	{
+	}
+
+	template<typename DataType>
+	BitMatrixNetwork<DataType>::BitMatrixNetwork(const BitMatrixNetwork<DataType>& other) :
+		BitMatrixNetwork()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType>
+	BitMatrixNetwork<DataType>::~BitMatrixNetwork()
+	{
+		this->clear();
+	}
+
+	template<typename DataType>
+	AMT& BitMatrixNetwork<DataType>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			const BitMatrixNetwork<DataType>& otherNetwork = dynamic_cast<const BitMatrixNetwork<DataType>&>(other);
+			this->clear();
+			nodes_.reserve(otherNetwork.nodes_.size());
+			for (const BlockType* otherNode : otherNetwork.nodes_)
+			{
+				BlockType* node = AMS<BlockType>::memoryManager_->allocateMemory();
+				node->data_ = otherNode->data_;
+				node->gateIndex_ = nodes_.size();
+				nodes_.push_back(node);
+			}
+			words_ = otherNetwork.words_;
+			rowWordCount_ = otherNetwork.rowWordCount_;
+			relationCount_ = otherNetwork.relationCount_;
+		}
+
+		return *this;
+	}
+
+	template<typename DataType>
+	void BitMatrixNetwork<DataType>::clear()
+	{
+		for (BlockType* node : nodes_)
+		{
+			AMS<BlockType>::memoryManager_->releaseMemory(node);
+		}
+		nodes_.clear();
+		words_.clear();
+		rowWordCount_ = 0;
+		relationCount_ = 0;
+	}
+
+	template<typename DataType>
+	size_t BitMatrixNetwork<DataType>::size() const
+	{
+		return nodes_.size();
+	}
+
+	template<typename DataType>
+	bool BitMatrixNetwork<DataType>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		const BitMatrixNetwork<DataType>* otherNetwork = dynamic_cast<const BitMatrixNetwork<DataType>*>(&other);
+		if (otherNetwork == nullptr || nodes_.size() != otherNetwork->nodes_.size() || relationCount_ != otherNetwork->relationCount_)
+		{
+			return false;
+		}
+
+		const size_t usedWords = (nodes_.size() + WORD_BITS - 1) / WORD_BITS;
+		for (size_t i = 0; i < nodes_.size(); ++i)
+		{
+			if (!(nodes_[i]->data_ == otherNetwork->nodes_[i]->data_))
+			{
+				return false;
+			}
+			const WordType* myRow = this->row(i);
+			const WordType* otherRow = otherNetwork->row(i);
+			if (!std::equal(myRow, myRow + usedWords, otherRow))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename DataType>
+	size_t BitMatrixNetwork<DataType>::relationCount() const
+	{
+		return relationCount_;
+	}
+
+	template<typename DataType>
+	size_t BitMatrixNetwork<DataType>::degree(const BlockType& node) const
+	{
+		return simd::popcount(this->row(node.gateIndex_), rowWordCount_);
+	}
+
+	template<typename DataType>
+	auto BitMatrixNetwork<DataType>::accessNodeFromGate(size_t order) const -> BlockType*
+	{
+		if (order >= nodes_.size())
+		{
+			throw std::out_of_range("Invalid node order!");
+		}
+
+		return nodes_[order];
+	}
+
+	template<typename DataType>
+	auto BitMatrixNetwork<DataType>::accessNodeFromNode(const BlockType& node, size_t order) const -> BlockType*
+	{
+		const WordType* words = this->row(node.gateIndex_);
+		for (size_t i = 0; i < rowWordCount_; ++i)
+		{
+			const size_t count = simd::scalar::popcount(words[i]);
+			if (order < count)
+			{
+				WordType word = words[i];
+				for (; order > 0; --order)
+				{
+					word &= word - 1;
+				}
+				return nodes_[i * WORD_BITS + simd::scalar::countTrailingZeros(word)];
+			}
+			order -= count;
+		}
+
+		throw std::out_of_range("Invalid relation order!");
+	}
+
+	template<typename DataType>
+	bool BitMatrixNetwork<DataType>::relationExists(const BlockType& nodeA, const BlockType& nodeB) const
+	{
+		return this->testBit(nodeA.gateIndex_, nodeB.gateIndex_);
+	}
+
+	template<typename DataType>
+	auto BitMatrixNetwork<DataType>::insert() -> BlockType&
+	{
+		if (nodes_.size() == rowWordCount_ * WORD_BITS)
+		{
+			this->growRows();
+		}
+
+		BlockType* newNode = AMS<BlockType>::memoryManager_->allocateMemory();
+		newNode->gateIndex_ = nodes_.size();
+		nodes_.push_back(newNode);
+		return *newNode;
+	}
+
+	template<typename DataType>
+	void BitMatrixNetwork<DataType>::remove(BlockType* node)
+	{
+		const size_t index = node->gateIndex_;
+		const size_t last = nodes_.size() - 1;
+
+		relationCount_ -= 2 * this->degree(*node) - (this->testBit(index, index) ? 1 : 0);
+
+		// The last row and column move to the removed ones, then they are cleared.
+		if (index != last)
+		{
+			std::copy(this->row(last), this->row(last) + rowWordCount_, this->row(index));
+			for (size_t i = 0; i < last; ++i)
+			{
+				this->changeBit(i, index, this->testBit(i, last));
+			}
+			this->changeBit(index, index, this->testBit(last, last));
+			nodes_[index] = nodes_[last];
+			nodes_[index]->gateIndex_ = index;
+		}
+		std::fill(this->row(last), this->row(last) + rowWordCount_, WordType{ 0 });
+		for (size_t i = 0; i < last; ++i)
+		{
+			this->changeBit(i, last, false);
+		}
+
+		nodes_.pop_back();
+		AMS<BlockType>::memoryManager_->releaseMemory(node);
+	}
+
+	template<typename DataType>
+	void BitMatrixNetwork<DataType>::connect(BlockType& nodeA, BlockType& nodeB)
+	{
+		if (this->changeBit(nodeA.gateIndex_, nodeB.gateIndex_, true))
+		{
+			relationCount_ += &nodeA == &nodeB ? 1 : 2;
+			this->changeBit(nodeB.gateIndex_, nodeA.gateIndex_, true);
+		}
+	}
+
+	template<typename DataType>
+	void BitMatrixNetwork<DataType>::disconnect(BlockType& nodeA, BlockType& nodeB)
+	{
+		if (this->changeBit(nodeA.gateIndex_, nodeB.gateIndex_, false))
+		{
+			relationCount_ -= &nodeA == &nodeB ? 1 : 2;
+			this->changeBit(nodeB.gateIndex_, nodeA.gateIndex_, false);
+		}
+	}
+
+	template<typename DataType>
+	size_t BitMatrixNetwork<DataType>::commonNeighbourCount(const BlockType& nodeA, const BlockType& nodeB) const
+	{
+		return simd::andPopcount(this->row(nodeA.gateIndex_), this->row(nodeB.gateIndex_), rowWordCount_);
+	}
+
+	template<typename DataType>
+	size_t BitMatrixNetwork<DataType>::neighbourUnionCount(const BlockType& nodeA, const BlockType& nodeB) const
+	{
+		return simd::orPopcount(this->row(nodeA.gateIndex_), this->row(nodeB.gateIndex_), rowWordCount_);
+	}
+
+	template<typename DataType>
+	size_t BitMatrixNetwork<DataType>::triangleCount() const
+	{
+		// Every triangle u < v < w is counted once, from its relation u-v and the common neighbours above v.
+		size_t result = 0;
+		for (size_t u = 0; u < nodes_.size(); ++u)
+		{
+			const WordType* rowU = this->row(u);
+			for (size_t wordIndex = (u + 1) / WORD_BITS; wordIndex < rowWordCount_; ++wordIndex)
+			{
+				WordType word = rowU[wordIndex];
+				if (wordIndex == (u + 1) / WORD_BITS)
+				{
+					word &= ~WordType{ 0 } << ((u + 1) % WORD_BITS);
+				}
+				for (; word != 0; word &= word - 1)
+				{
+					const size_t v = wordIndex * WORD_BITS + simd::scalar::countTrailingZeros(word);
+					const WordType* rowV = this->row(v);
+					const size_t first = (v + 1) / WORD_BITS;
+					if (first < rowWordCount_)
+					{
+						const WordType above = ~WordType{ 0 } << ((v + 1) % WORD_BITS);
+						result += simd::scalar::popcount(rowU[first] & rowV[first] & above);
+						result += simd::andPopcount(rowU + first + 1, rowV + first + 1, rowWordCount_ - first - 1);
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	template<typename DataType>
+	auto BitMatrixNetwork<DataType>::row(const BlockType& node) const -> const WordType*
+	{
+		return this->row(node.gateIndex_);
+	}
+
+	template<typename DataType>
+	size_t BitMatrixNetwork<DataType>::rowWordCount() const
+	{
+		return rowWordCount_;
+	}
+
+	template<typename DataType>
+	auto BitMatrixNetwork<DataType>::row(size_t index) -> WordType*
+	{
+		return words_.data() + index * rowWordCount_;
+	}
+
+	template<typename DataType>
+	auto BitMatrixNetwork<DataType>::row(size_t index) const -> const WordType*
+	{
+		return words_.data() + index * rowWordCount_;
+	}
+
+	template<typename DataType>
+	bool BitMatrixNetwork<DataType>::testBit(size_t rowIndex, size_t column) const
+	{
+		return (this->row(rowIndex)[column / WORD_BITS] >> (column % WORD_BITS) & 1) != 0;
+	}
+
+	template<typename DataType>
+	bool BitMatrixNetwork<DataType>::changeBit(size_t rowIndex, size_t column, bool value)
+	{
+		WordType& word = this->row(rowIndex)[column / WORD_BITS];
+		const WordType mask = WordType{ 1 } << (column % WORD_BITS);
+		const bool changed = ((word & mask) != 0) != value;
+		word = value ? word | mask : word & ~mask;
+		return changed;
+	}
+
+	template<typename DataType>
+	void BitMatrixNetwork<DataType>::growRows()
+	{
+		// Rows double their words, so the matrix is copied O(log n) times.
+		const size_t newRowWordCount = rowWordCount_ == 0 ? 1 : 2 * rowWordCount_;
+		std::vector<WordType> words(newRowWordCount * newRowWordCount * WORD_BITS, 0);
+		for (size_t i = 0; i < nodes_.size(); ++i)
+		{
+			std::copy(this->row(i), this->row(i) + rowWordCount_, words.data() + i * newRowWordCount);
+		}
+		words_.swap(words);
+		rowWordCount_ = newRowWordCount;
+	}
+}
@@ -0,0 +1,271 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/network.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ds::amt {
+
+	/**
+	 *  @brief Read-only network in the compressed sparse row format.
+	 *
+	 *  Data of nodes lie contiguously in the order of the gate they were frozen from. Relations of the i-th node
+	 *  are the indices neighbours_[offsets_[i]] to neighbours_[offsets_[i + 1] - 1], kept in their original order,
+	 *  so degree and access to a neighbour take O(1) and neighbours are processed by a scan of one array.
+	 *  Like in explicit networks, every relation is stored at both of its nodes.
+	 *  Data of nodes may be changed, nodes and relations may not.
+	 */
+	template<typename DataType>
+	class CompressedSparseRowNetwork :
+		public Network<MemoryBlock<DataType>>
+	{
+	public:
+		using BlockType = MemoryBlock<DataType>;
+		using IndexType = std::uint32_t;
+
+		CompressedSparseRowNetwork();
+		// Relations of node i are neighbours[offsets[i]] to neighbours[offsets[i + 1] - 1], offsets has one element more than data.
+		CompressedSparseRowNetwork(std::vector<DataType> data, std::vector<size_t> offsets, std::vector<IndexType> neighbours); // throw(std::invalid_argument)
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		size_t size() const override;
+		bool isEmpty() const override;
+		bool equals(const AMT& other) override;
+
+		size_t relationCount() const override;
+		size_t degree(const BlockType& node) const override;
+
+		BlockType* accessNodeFromGate(size_t order) const override;
+		BlockType* accessNodeFromNode(const BlockType& node, size_t order) const override;
+
+		bool relationExists(const BlockType& nodeA, const BlockType& nodeB) const override;
+
+		BlockType& insert() override; // throw(unavailable_function_call)
+		void remove(BlockType* node) override; // throw(unavailable_function_call)
+
+		void connect(BlockType& nodeA, BlockType& nodeB) override; // throw(unavailable_function_call)
+		void disconnect(BlockType& nodeA, BlockType& nodeB) override; // throw(unavailable_function_call)
+
+		// Order of the node in the gate, the node must belong to this network.
+		size_t indexOf(const BlockType& node) const;
+		// Indices of neighbours of the node, they are valid until the network is changed.
+		const IndexType* beginNeighbours(const BlockType& node) const;
+		const IndexType* endNeighbours(const BlockType& node) const;
+
+		template<typename Operation>
+		void processNeighbours(const BlockType& node, Operation operation) const;
+
+	private:
+		std::vector<BlockType> nodes_;
+		std::vector<size_t> offsets_;
+		std::vector<IndexType> neighbours_;
+	};
+
+	template<typename DataType>
+	using CsrNetwork = CompressedSparseRowNetwork<DataType>;
+
+	//----------
+
+	template<typename DataType>
+	CompressedSparseRowNetwork<DataType>::CompressedSparseRowNetwork() :
+		nodes_(),
+		offsets_(1, 0),
+		neighbours_()
+	{
+	}
+
+	template<typename DataType>
+	CompressedSparseRowNetwork<DataType>::CompressedSparseRowNetwork(std::vector<DataType> data, std::vector<size_t> offsets, std::vector<IndexType> neighbours) :
+		nodes_(),
+		offsets_(std::move(offsets)),
+		neighbours_(std::move(neighbours))
+	{
+		const size_t nodeCount = data.size();
+		bool valid = nodeCount < std::numeric_limits<IndexType>::max() &&
+		             offsets_.size() == nodeCount + 1 &&
+		             offsets_.front() == 0 &&
+		             offsets_.back() == neighbours_.size();
+		for (size_t i = 0; valid && i < nodeCount; ++i)
+		{
+			valid = offsets_[i] <= offsets_[i + 1];
+		}
+		for (size_t i = 0; valid && i < neighbours_.size(); ++i)
+		{
+			valid = neighbours_[i] < nodeCount;
+		}
+		if (!valid)
+		{
+			throw std::invalid_argument("Invalid compressed sparse row network!");
+		}
+
+		nodes_.reserve(nodeCount);
+		for (DataType& nodeData : data)
+		{
+			nodes_.push_back(BlockType{ std::move(nodeData) });
+		}
+	}
+
+	template<typename DataType>
+	AMT& CompressedSparseRowNetwork<DataType>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			const CompressedSparseRowNetwork<DataType>& otherNetwork = dynamic_cast<const CompressedSparseRowNetwork<DataType>&>(other);
+			nodes_ = otherNetwork.nodes_;
+			offsets_ = otherNetwork.offsets_;
+			neighbours_ = otherNetwork.neighbours_;
+		}
+
+		return *this;
+	}
+
+	template<typename DataType>
+	void CompressedSparseRowNetwork<DataType>::clear()
+	{
+		nodes_.clear();
+		offsets_.assign(1, 0);
+		neighbours_.clear();
+	}
+
+	template<typename DataType>
+	size_t CompressedSparseRowNetwork<DataType>::size() const
+	{
+		return nodes_.size();
+	}
+
+	template<typename DataType>
+	bool CompressedSparseRowNetwork<DataType>::isEmpty() const
+	{
+		return nodes_.empty();
+	}
+
+	template<typename DataType>
+	bool CompressedSparseRowNetwork<DataType>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		const CompressedSparseRowNetwork<DataType>* otherNetwork = dynamic_cast<const CompressedSparseRowNetwork<DataType>*>(&other);
+		if (otherNetwork == nullptr || offsets_ != otherNetwork->offsets_ || neighbours_ != otherNetwork->neighbours_)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < nodes_.size(); ++i)
+		{
+			if (!(nodes_[i].data_ == otherNetwork->nodes_[i].data_))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename DataType>
+	size_t CompressedSparseRowNetwork<DataType>::relationCount() const
+	{
+		return neighbours_.size();
+	}
+
+	template<typename DataType>
+	size_t CompressedSparseRowNetwork<DataType>::degree(const BlockType& node) const
+	{
+		const size_t index = this->indexOf(node);
+		return offsets_[index + 1] - offsets_[index];
+	}
+
+	template<typename DataType>
+	auto CompressedSparseRowNetwork<DataType>::accessNodeFromGate(size_t order) const -> BlockType*
+	{
+		if (order >= nodes_.size())
+		{
+			throw std::out_of_range("Invalid node order!");
+		}
+
+		return const_cast<BlockType*>(nodes_.data() + order);
+	}
+
+	template<typename DataType>
+	auto CompressedSparseRowNetwork<DataType>::accessNodeFromNode(const BlockType& node, size_t order) const -> BlockType*
+	{
+		const size_t index = this->indexOf(node);
+		if (order >= offsets_[index + 1] - offsets_[index])
+		{
+			throw std::out_of_range("Invalid relation order!");
+		}
+
+		return const_cast<BlockType*>(nodes_.data() + neighbours_[offsets_[index] + order]);
+	}
+
+	template<typename DataType>
+	bool CompressedSparseRowNetwork<DataType>::relationExists(const BlockType& nodeA, const BlockType& nodeB) const
+	{
+		const BlockType& nodeFrom = this->degree(nodeA) <= this->degree(nodeB) ? nodeA : nodeB;
+		const IndexType indexTo = static_cast<IndexType>(this->indexOf(&nodeFrom == &nodeA ? nodeB : nodeA));
+		const IndexType* end = this->endNeighbours(nodeFrom);
+		return std::find(this->beginNeighbours(nodeFrom), end, indexTo) != end;
+	}
+
+	template<typename DataType>
+	auto CompressedSparseRowNetwork<DataType>::insert() -> BlockType&
+	{
+		throw unavailable_function_call("Method insert() unavailable in compressed sparse row networks!");
+	}
+
+	template<typename DataType>
+	void CompressedSparseRowNetwork<DataType>::remove(BlockType*)
+	{
+		throw unavailable_function_call("Method remove() unavailable in compressed sparse row networks!");
+	}
+
+	template<typename DataType>
+	void CompressedSparseRowNetwork<DataType>::connect(BlockType&, BlockType&)
+	{
+		throw unavailable_function_call("Method connect() unavailable in compressed sparse row networks!");
+	}
+
+	template<typename DataType>
+	void CompressedSparseRowNetwork<DataType>::disconnect(BlockType&, BlockType&)
+	{
+		throw unavailable_function_call("Method disconnect() unavailable in compressed sparse row networks!");
+	}
+
+	template<typename DataType>
+	size_t CompressedSparseRowNetwork<DataType>::indexOf(const BlockType& node) const
+	{
+		return static_cast<size_t>(&node - nodes_.data());
+	}
+
+	template<typename DataType>
+	auto CompressedSparseRowNetwork<DataType>::beginNeighbours(const BlockType& node) const -> const IndexType*
+	{
+		return neighbours_.data() + offsets_[this->indexOf(node)];
+	}
+
+	template<typename DataType>
+	auto CompressedSparseRowNetwork<DataType>::endNeighbours(const BlockType& node) const -> const IndexType*
+	{
+		return neighbours_.data() + offsets_[this->indexOf(node) + 1];
+	}
+
+	template<typename DataType>
+	template<typename Operation>
+	void CompressedSparseRowNetwork<DataType>::processNeighbours(const BlockType& node, Operation operation) const
+	{
+		BlockType* nodes = const_cast<BlockType*>(nodes_.data());
+		const IndexType* end = this->endNeighbours(node);
+		for (const IndexType* neighbour = this->beginNeighbours(node); neighbour != end; ++neighbour)
+		{
+			operation(nodes + *neighbour);
+		}
+	}
+}
@@ -3,7 +3,15 @@
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/hierarchy.h>
 #include <libds/amt/implicit_sequence.h>
+#include <libds/mm/pooled_memory_manager.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace ds::amt {
 
@@ -27,6 +35,7 @@ namespace ds::amt {
     {
     public:
         ExplicitHierarchy();
+        explicit ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
         ExplicitHierarchy(const ExplicitHierarchy& other);
 
         AMT& assign(const AMT& other) override;
@@ -41,8 +50,24 @@ namespace ds::amt {
         BlockType& emplaceRoot() override;
         void changeRoot(BlockType* newRoot) override;
 
+        // Number of changes of the structure so far, which lets indices over the hierarchy detect they are out of date.
+        size_t getModificationCount() const;
+
     protected:
+        /**
+         *  @brief Copies the other hierarchy into this empty one with a pooled memory manager,
+         *  taking all nodes from one run of blocks in pre-order.
+         *  Nodes of the other hierarchy are numbered in pre-order and their sub-hierarchies counted first,
+         *  so the copy of node i is block i of the run, its first son is block i + 1 and every next son
+         *  follows the sub-hierarchy of the previous son. Blocks are then wired independently of each other,
+         *  so with a pool the run is split into tasks of cutoff blocks.
+         *  linkSon(parent, sonOrder, son) stores the son into the parent without accessing the son.
+         */
+        template<typename LinkFunction>
+        void cloneFrom(const ExplicitHierarchy<BlockType>& other, LinkFunction linkSon, WorkStealingPool* pool, size_t cutoff);
+
         BlockType* root_;
+        size_t modificationCount_;
     };
 
     template<typename BlockType>
@@ -72,8 +97,14 @@ namespace ds::amt {
 
         MultiWayExplicitHierarchy();
         MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other);
+        // Copy whose nodes lie in one pooled run in pre-order, see ExplicitHierarchy::cloneFrom. The pool is optional.
+        MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other, WorkStealingPool* pool,
+                                  size_t cutoff = Hierarchy<MultiWayExplicitHierarchyBlock<DataType>>::PARALLEL_CUTOFF);
         ~MultiWayExplicitHierarchy() override;
 
+        MultiWayExplicitHierarchy<DataType> clone(WorkStealingPool* pool = nullptr,
+                                                  size_t cutoff = Hierarchy<MultiWayExplicitHierarchyBlock<DataType>>::PARALLEL_CUTOFF) const;
+
         size_t degree(const BlockType& node) const override;
 
         BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
@@ -88,6 +119,66 @@ namespace ds::amt {
 
     //----------
 
+    template<typename DataType>
+    struct LinkedMultiWayExplicitHierarchyBlock :
+            public ExplicitHierarchyBlock<DataType>
+    {
+        LinkedMultiWayExplicitHierarchyBlock() : firstSon_(nullptr), nextBrother_(nullptr) {}
+        ~LinkedMultiWayExplicitHierarchyBlock() { firstSon_ = nullptr; nextBrother_ = nullptr; }
+
+        LinkedMultiWayExplicitHierarchyBlock<DataType>* firstSon_;
+        LinkedMultiWayExplicitHierarchyBlock<DataType>* nextBrother_;
+    };
+
+    template<typename DataType>
+    using LinkedMWEHBlock = LinkedMultiWayExplicitHierarchyBlock<DataType>;
+
+    /**
+     * @brief Multi-way hierarchy whose sons are linked through their first son and next brother.
+     *
+     * A node stores only three pointers and all nodes are allocated from a pool,
+     * so there is no per-node son sequence. Inserting a son at the front is O(1),
+     * access, insertion and removal of the son of order k take O(k).
+     * Nodes belong to the pool of their hierarchy and must not be moved to another one.
+     */
+    template<typename DataType>
+    class LinkedMultiWayExplicitHierarchy :
+            public ExplicitHierarchy<LinkedMultiWayExplicitHierarchyBlock<DataType>>
+    {
+    public:
+        using BlockType = LinkedMultiWayExplicitHierarchyBlock<DataType>;
+
+        LinkedMultiWayExplicitHierarchy();
+        LinkedMultiWayExplicitHierarchy(const LinkedMultiWayExplicitHierarchy& other);
+        ~LinkedMultiWayExplicitHierarchy() override;
+
+        AMT& assign(const AMT& other) override;
+
+        size_t degree(const BlockType& node) const override;
+
+        BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
+
+        BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override;
+        void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
+        void removeSon(BlockType& parent, size_t sonOrder) override;
+
+    protected:
+        using TraversalFrame = typename Hierarchy<BlockType>::TraversalFrame;
+
+        TraversalFrame makeTraversalFrame(BlockType* node) const override;
+        BlockType* accessNextSon(TraversalFrame& frame) const override;
+        BlockType* accessSonAfter(const BlockType& node, const BlockType* son, size_t& sonOrder, size_t visitedSonCount) const override;
+
+    private:
+        // Link that holds the son of the given order, the link past the last son for sonOrder == degree.
+        static BlockType** accessSonLink(BlockType& parent, size_t sonOrder);
+    };
+
+    template<typename DataType>
+    using LinkedMultiWayEH = LinkedMultiWayExplicitHierarchy<DataType>;
+
+    //----------
+
     template<typename DataType, size_t K>
     struct KWayExplicitHierarchyBlock :
             public ExplicitHierarchyBlock<DataType>
@@ -151,8 +242,14 @@ namespace ds::amt {
 
         BinaryExplicitHierarchy();
         BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other);
+        // Copy whose nodes lie in one pooled run in pre-order, see ExplicitHierarchy::cloneFrom. The pool is optional.
+        BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other, WorkStealingPool* pool,
+                                size_t cutoff = Hierarchy<BinaryExplicitHierarchyBlock<DataType>>::PARALLEL_CUTOFF);
         ~BinaryExplicitHierarchy() override;
 
+        BinaryExplicitHierarchy<DataType> clone(WorkStealingPool* pool = nullptr,
+                                                size_t cutoff = Hierarchy<BinaryExplicitHierarchyBlock<DataType>>::PARALLEL_CUTOFF) const;
+
         size_t degree(const BlockType& node) const override;
 
         BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
@@ -185,9 +282,109 @@ namespace ds::amt {
 
     //----------
 
+    template<typename DataType>
+    struct ThreadedBinaryExplicitHierarchyBlock :
+            public ExplicitHierarchyBlock<DataType>
+    {
+        using LinkType = std::uintptr_t;
+
+        // Links tagged by the lowest bit are threads to the in-order predecessor (left) or successor (right),
+        // untagged links point to a son. The tag alone is a thread to no node.
+        static constexpr LinkType THREAD_TAG = 1;
+
+        ThreadedBinaryExplicitHierarchyBlock() : left_(THREAD_TAG), right_(THREAD_TAG) {}
+        ~ThreadedBinaryExplicitHierarchyBlock() { left_ = THREAD_TAG; right_ = THREAD_TAG; }
+
+        static bool isThread(LinkType link) { return (link & THREAD_TAG) != 0; }
+        static ThreadedBinaryExplicitHierarchyBlock<DataType>* target(LinkType link) { return reinterpret_cast<ThreadedBinaryExplicitHierarchyBlock<DataType>*>(link & ~THREAD_TAG); }
+        static LinkType sonLink(ThreadedBinaryExplicitHierarchyBlock<DataType>* son) { return reinterpret_cast<LinkType>(son); }
+        static LinkType threadLink(ThreadedBinaryExplicitHierarchyBlock<DataType>* neighbour) { return reinterpret_cast<LinkType>(neighbour) | THREAD_TAG; }
+
+        LinkType left_;
+        LinkType right_;
+    };
+
+    template<typename DataType>
+    using ThreadedBEHBlock = ThreadedBinaryExplicitHierarchyBlock<DataType>;
+
+    /**
+     *  Binary explicit hierarchy whose empty son links point to the in-order neighbours.
+     *  In-order iteration and neighbour queries need neither a stack nor parent links.
+     *  Attaching or detaching a subtree walks to its leftmost and rightmost node to fix the threads.
+     */
+    template<typename DataType>
+    class ThreadedBinaryExplicitHierarchy :
+            public BinaryHierarchy<ThreadedBinaryExplicitHierarchyBlock<DataType>>,
+            public ExplicitHierarchy<ThreadedBinaryExplicitHierarchyBlock<DataType>>
+    {
+    public:
+        using BlockType = ThreadedBinaryExplicitHierarchyBlock<DataType>;
+
+        ThreadedBinaryExplicitHierarchy();
+        ThreadedBinaryExplicitHierarchy(const ThreadedBinaryExplicitHierarchy& other);
+        ~ThreadedBinaryExplicitHierarchy() override;
+
+        size_t degree(const BlockType& node) const override;
+
+        BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
+
+        BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override;
+        void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
+        void removeSon(BlockType& parent, size_t sonOrder) override;
+
+        BlockType* accessInOrderPredecessor(const BlockType& node) const override;
+        BlockType* accessInOrderSuccessor(const BlockType& node) const override;
+
+        void processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const;
+
+        //----------
+
+        class ThreadedInOrderIterator
+        {
+        public:
+            ThreadedInOrderIterator(const ThreadedBinaryExplicitHierarchy<DataType>* hierarchy, BlockType* node);
+            ThreadedInOrderIterator& operator++();
+            bool operator==(const ThreadedInOrderIterator& other) const;
+            bool operator!=(const ThreadedInOrderIterator& other) const;
+            DataType& operator*();
+
+        private:
+            const ThreadedBinaryExplicitHierarchy<DataType>* hierarchy_;
+            BlockType* current_;
+            BlockType* last_;
+        };
+
+        using IteratorType = ThreadedInOrderIterator;
+
+        ThreadedInOrderIterator begin();
+        ThreadedInOrderIterator end();
+
+    private:
+        static BlockType* accessLeftmost(BlockType* node);
+        static BlockType* accessRightmost(BlockType* node);
+        static BlockType* accessNextInOrder(const BlockType& node);
+
+        void attachSon(BlockType& parent, size_t sonOrder, BlockType* son);
+        BlockType* detachSon(BlockType& parent, size_t sonOrder);
+    };
+
+    template<typename DataType>
+    using ThreadedBinaryEH = ThreadedBinaryExplicitHierarchy<DataType>;
+
+    //----------
+
     template<typename BlockType>
     ExplicitHierarchy<BlockType>::ExplicitHierarchy() :
-            root_(nullptr)
+            root_(nullptr),
+            modificationCount_(0)
+    {
+    }
+
+    template<typename BlockType>
+    ExplicitHierarchy<BlockType>::ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+            ExplicitAMS<BlockType>(memoryManager),
+            root_(nullptr),
+            modificationCount_(0)
     {
     }
 
@@ -236,6 +433,7 @@ namespace ds::amt {
     template<typename BlockType>
     void ExplicitHierarchy<BlockType>::clear()
     {
+        ++this->modificationCount_;
         Hierarchy<BlockType>::processPostOrder(root_, [&](BlockType* b)
         {
             AMS<BlockType>::memoryManager_->releaseMemory(b);
@@ -325,6 +523,7 @@ namespace ds::amt {
     template<typename BlockType>
     BlockType& ExplicitHierarchy<BlockType>::emplaceRoot()
     {
+        ++this->modificationCount_;
         root_ = AMS<BlockType>::memoryManager_->allocateMemory();
         return *root_;
     }
@@ -332,6 +531,7 @@ namespace ds::amt {
     template<typename BlockType>
     void ExplicitHierarchy<BlockType>::changeRoot(BlockType* newRoot)
     {
+        ++this->modificationCount_;
         if (newRoot != nullptr)
         {
             newRoot->parent_ = nullptr;
@@ -339,6 +539,144 @@ namespace ds::amt {
         root_ = newRoot;
     }
 
+    template<typename BlockType>
+    size_t ExplicitHierarchy<BlockType>::getModificationCount() const
+    {
+        return modificationCount_;
+    }
+
+    template<typename BlockType>
+    template<typename LinkFunction>
+    void ExplicitHierarchy<BlockType>::cloneFrom(const ExplicitHierarchy<BlockType>& other, LinkFunction linkSon, WorkStealingPool* pool, size_t cutoff)
+    {
+        using IndexType = std::uint32_t;
+
+        cutoff = std::max<size_t>(cutoff, 1);
+        auto* memoryManager = dynamic_cast<mm::PooledMemoryManager<BlockType>*>(AMS<BlockType>::memoryManager_);
+        if (memoryManager == nullptr || root_ != nullptr)
+        {
+            throw std::logic_error("Hierarchy must be empty and pooled to be cloned into!");
+        }
+
+        // Nodes are numbered in pre-order, so every subtree is a run of indices starting at its root.
+        struct Record
+        {
+            const BlockType* node_;
+            IndexType parent_;
+            IndexType size_;
+        };
+        std::vector<Record> records;
+        std::vector<std::pair<const BlockType*, IndexType>> stack;
+        if (other.root_ != nullptr)
+        {
+            stack.emplace_back(other.root_, 0);
+        }
+        while (!stack.empty())
+        {
+            if (records.size() == std::numeric_limits<IndexType>::max())
+            {
+                throw std::length_error("Hierarchy is too large to be cloned!");
+            }
+
+            const auto [node, parent] = stack.back();
+            stack.pop_back();
+            const IndexType index = static_cast<IndexType>(records.size());
+            records.push_back({ node, parent, 1 });
+
+            const size_t sonCount = other.degree(*node);
+            const size_t top = stack.size();
+            for (size_t sonOrder = 0, foundSonCount = 0; foundSonCount < sonCount; ++sonOrder)
+            {
+                if (const BlockType* son = other.accessSon(*node, sonOrder); son != nullptr)
+                {
+                    stack.emplace_back(son, index);
+                    ++foundSonCount;
+                }
+            }
+            std::reverse(stack.begin() + top, stack.end());
+        }
+        for (size_t i = records.size(); i-- > 1;)
+        {
+            records[records[i].parent_].size_ += records[i].size_;
+        }
+
+        const size_t count = records.size();
+        if (count == 0)
+        {
+            return;
+        }
+
+        ++this->modificationCount_;
+        BlockType* blocks = memoryManager->allocateMemoryRun(count);
+        auto cloneBlocks = [&](size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    const BlockType& otherBlock = *records[i].node_;
+                    BlockType& block = blocks[i];
+                    block.data_ = otherBlock.data_;
+                    block.parent_ = i != 0 ? blocks + records[i].parent_ : nullptr;
+
+                    const size_t sonCount = other.degree(otherBlock);
+                    size_t sonIndex = i + 1;
+                    for (size_t sonOrder = 0, linkedSonCount = 0; linkedSonCount < sonCount; ++sonOrder)
+                    {
+                        if (other.accessSon(otherBlock, sonOrder) != nullptr)
+                        {
+                            linkSon(block, sonOrder, blocks + sonIndex);
+                            sonIndex += records[sonIndex].size_;
+                            ++linkedSonCount;
+                        }
+                    }
+                }
+            };
+
+        try
+        {
+            if (pool == nullptr || count <= cutoff)
+            {
+                cloneBlocks(0, count);
+            }
+            else
+            {
+                WorkStealingPool::TaskGroup group;
+                try
+                {
+                    for (size_t first = 0; first < count; first += cutoff)
+                    {
+                        pool->fork(group, [&cloneBlocks, first, count, cutoff]()
+                            {
+                                cloneBlocks(first, std::min(first + cutoff, count));
+                            });
+                    }
+                }
+                catch (...)
+                {
+                    // Forked tasks refer to this frame, so they have to finish first.
+                    try
+                    {
+                        pool->wait(group);
+                    }
+                    catch (...)
+                    {
+                    }
+                    throw;
+                }
+                pool->wait(group);
+            }
+        }
+        catch (...)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                memoryManager->releaseMemory(blocks + i);
+            }
+            throw;
+        }
+
+        root_ = blocks;
+    }
+
     template<typename DataType>
     MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy() :
             ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>()
@@ -352,12 +690,33 @@ namespace ds::amt {
         this->assign(other);
     }
 
+    template<typename DataType>
+    MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other, WorkStealingPool* pool, size_t cutoff) :
+            ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>(new mm::PooledMemoryManager<BlockType>())
+    {
+        this->cloneFrom(other, [](BlockType& parent, size_t sonOrder, BlockType* son)
+            {
+                // Empty sons of the other hierarchy stay empty.
+                while (parent.sons_->size() < sonOrder)
+                {
+                    parent.sons_->insertLast().data_ = nullptr;
+                }
+                parent.sons_->insertLast().data_ = son;
+            }, pool, cutoff);
+    }
+
     template <typename DataType>
     MultiWayExplicitHierarchy<DataType>::~MultiWayExplicitHierarchy()
     {
         this->clear();
     }
 
+    template<typename DataType>
+    MultiWayExplicitHierarchy<DataType> MultiWayExplicitHierarchy<DataType>::clone(WorkStealingPool* pool, size_t cutoff) const
+    {
+        return MultiWayExplicitHierarchy<DataType>(*this, pool, cutoff);
+    }
+
     template<typename DataType>
     size_t MultiWayExplicitHierarchy<DataType>::degree(const BlockType& node) const
     {
@@ -375,6 +734,7 @@ namespace ds::amt {
     template<typename DataType>
     auto MultiWayExplicitHierarchy<DataType>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
     {
+        ++this->modificationCount_;
         BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
         parent.sons_->insert(sonOrder).data_ = newSon;
         newSon->parent_ = &parent;
@@ -384,6 +744,7 @@ namespace ds::amt {
     template<typename DataType>
     void MultiWayExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
     {
+        ++this->modificationCount_;
         MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
 
         BlockType* oldSon = sonBlock->data_;
@@ -396,6 +757,7 @@ namespace ds::amt {
     template<typename DataType>
     void MultiWayExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
     {
+        ++this->modificationCount_;
         MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
 
         BlockType* removedSon = sonBlock->data_;
@@ -408,6 +770,206 @@ namespace ds::amt {
         parent.sons_->remove(sonOrder);
     }
 
+    template<typename DataType>
+    LinkedMultiWayExplicitHierarchy<DataType>::LinkedMultiWayExplicitHierarchy() :
+            ExplicitHierarchy<LinkedMultiWayExplicitHierarchyBlock<DataType>>(new mm::PooledMemoryManager<BlockType>())
+    {
+    }
+
+    template<typename DataType>
+    LinkedMultiWayExplicitHierarchy<DataType>::LinkedMultiWayExplicitHierarchy(const LinkedMultiWayExplicitHierarchy& other) :
+            LinkedMultiWayExplicitHierarchy()
+    {
+        this->assign(other);
+    }
+
+    template<typename DataType>
+    LinkedMultiWayExplicitHierarchy<DataType>::~LinkedMultiWayExplicitHierarchy()
+    {
+        this->clear();
+    }
+
+    template<typename DataType>
+    AMT& LinkedMultiWayExplicitHierarchy<DataType>::assign(const AMT& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        const LinkedMultiWayExplicitHierarchy<DataType>& otherHierarchy = dynamic_cast<const LinkedMultiWayExplicitHierarchy<DataType>&>(other);
+
+        this->clear();
+        if (otherHierarchy.root_ == nullptr)
+        {
+            return *this;
+        }
+
+        // Copies are made in pre-order into a reserved run of the pool,
+        // so the copy is traversed in pre-order through contiguous memory.
+        // Sons are appended through the link past the last copied son, which keeps the copy O(n).
+        struct CopyFrame
+        {
+            BlockType* myNode_;
+            BlockType* otherSon_;
+            BlockType** mySonLink_;
+        };
+
+        AMS<BlockType>::memoryManager_->reserve(otherHierarchy.size());
+        this->emplaceRoot().data_ = otherHierarchy.root_->data_;
+
+        ImplicitSequence<CopyFrame> stack(Hierarchy<BlockType>::TRAVERSAL_INIT_CAPACITY, false);
+        stack.insertLast().data_ = { this->root_, otherHierarchy.root_->firstSon_, &this->root_->firstSon_ };
+        while (!stack.isEmpty())
+        {
+            CopyFrame& frame = stack.accessLast()->data_;
+            BlockType* otherSon = frame.otherSon_;
+            if (otherSon != nullptr)
+            {
+                BlockType* mySon = AMS<BlockType>::memoryManager_->allocateMemory();
+                mySon->data_ = otherSon->data_;
+                mySon->parent_ = frame.myNode_;
+                *frame.mySonLink_ = mySon;
+                frame.mySonLink_ = &mySon->nextBrother_;
+                frame.otherSon_ = otherSon->nextBrother_;
+                stack.insertLast().data_ = { mySon, otherSon->firstSon_, &mySon->firstSon_ };
+            }
+            else
+            {
+                stack.removeLast();
+            }
+        }
+
+        return *this;
+    }
+
+    template<typename DataType>
+    size_t LinkedMultiWayExplicitHierarchy<DataType>::degree(const BlockType& node) const
+    {
+        size_t result = 0;
+        for (const BlockType* son = node.firstSon_; son != nullptr; son = son->nextBrother_)
+        {
+            ++result;
+        }
+        return result;
+    }
+
+    template<typename DataType>
+    auto LinkedMultiWayExplicitHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+    {
+        BlockType* son = node.firstSon_;
+        while (son != nullptr && sonOrder > 0)
+        {
+            son = son->nextBrother_;
+            --sonOrder;
+        }
+        return son;
+    }
+
+    template<typename DataType>
+    auto LinkedMultiWayExplicitHierarchy<DataType>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
+    {
+        ++this->modificationCount_;
+        BlockType** link = accessSonLink(parent, sonOrder);
+        BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
+        newSon->nextBrother_ = *link;
+        newSon->parent_ = &parent;
+        *link = newSon;
+        return *newSon;
+    }
+
+    template<typename DataType>
+    void LinkedMultiWayExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+    {
+        ++this->modificationCount_;
+        BlockType** link = accessSonLink(parent, sonOrder);
+        BlockType* oldSon = *link;
+        if (oldSon == nullptr)
+        {
+            throw std::out_of_range("Invalid son order!");
+        }
+
+        // A null son cannot be linked, so changing a son to nullptr unlinks it.
+        if (newSon != nullptr)
+        {
+            newSon->nextBrother_ = oldSon->nextBrother_;
+            newSon->parent_ = &parent;
+            *link = newSon;
+        }
+        else
+        {
+            *link = oldSon->nextBrother_;
+        }
+
+        oldSon->nextBrother_ = nullptr;
+        oldSon->parent_ = nullptr;
+    }
+
+    template<typename DataType>
+    void LinkedMultiWayExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
+    {
+        ++this->modificationCount_;
+        BlockType** link = accessSonLink(parent, sonOrder);
+        BlockType* removedSon = *link;
+        if (removedSon == nullptr)
+        {
+            throw std::out_of_range("Invalid son order!");
+        }
+
+        *link = removedSon->nextBrother_;
+        removedSon->nextBrother_ = nullptr;
+
+        Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
+        {
+            AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(b);
+        });
+    }
+
+    template<typename DataType>
+    auto LinkedMultiWayExplicitHierarchy<DataType>::makeTraversalFrame(BlockType* node) const -> TraversalFrame
+    {
+        return { node, 0, 0, node->firstSon_ };
+    }
+
+    template<typename DataType>
+    auto LinkedMultiWayExplicitHierarchy<DataType>::accessNextSon(TraversalFrame& frame) const -> BlockType*
+    {
+        // The brother is read before the son is processed, so the son may be released by the traversal.
+        BlockType* son = frame.nextSon_;
+        if (son != nullptr)
+        {
+            frame.nextSon_ = son->nextBrother_;
+        }
+        return son;
+    }
+
+    template<typename DataType>
+    auto LinkedMultiWayExplicitHierarchy<DataType>::accessSonAfter(const BlockType& node, const BlockType* son, size_t& sonOrder, size_t) const -> BlockType*
+    {
+        BlockType* nextSon = son != nullptr ? son->nextBrother_ : node.firstSon_;
+        if (nextSon != nullptr)
+        {
+            ++sonOrder;
+        }
+        return nextSon;
+    }
+
+    template<typename DataType>
+    auto LinkedMultiWayExplicitHierarchy<DataType>::accessSonLink(BlockType& parent, size_t sonOrder) -> BlockType**
+    {
+        BlockType** link = &parent.firstSon_;
+        while (sonOrder > 0)
+        {
+            if (*link == nullptr)
+            {
+                throw std::out_of_range("Invalid son order!");
+            }
+            link = &(*link)->nextBrother_;
+            --sonOrder;
+        }
+        return link;
+    }
+
     template<typename DataType, size_t K>
     KWayExplicitHierarchy<DataType, K>::KWayExplicitHierarchy() :
             ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>()
@@ -451,6 +1013,7 @@ namespace ds::amt {
     template<typename DataType, size_t K>
     auto KWayExplicitHierarchy<DataType, K>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
     {
+        ++this->modificationCount_;
         BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
         parent.sons_->access(sonOrder)->data_ = newSon;
         newSon->parent_ = &parent;
@@ -460,6 +1023,7 @@ namespace ds::amt {
     template<typename DataType, size_t K>
     void KWayExplicitHierarchy<DataType, K>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
     {
+        ++this->modificationCount_;
         MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
 
         BlockType* oldSon = sonBlock->data_;
@@ -472,6 +1036,7 @@ namespace ds::amt {
     template<typename DataType, size_t K>
     void KWayExplicitHierarchy<DataType, K>::removeSon(BlockType& parent, size_t sonOrder)
     {
+        ++this->modificationCount_;
         MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
 
         BlockType* removedSon = sonBlock->data_;
@@ -497,12 +1062,28 @@ namespace ds::amt {
         this->assign(other);
     }
 
+    template<typename DataType>
+    BinaryExplicitHierarchy<DataType>::BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other, WorkStealingPool* pool, size_t cutoff) :
+            ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>(new mm::PooledMemoryManager<BlockType>())
+    {
+        this->cloneFrom(other, [](BlockType& parent, size_t sonOrder, BlockType* son)
+            {
+                (sonOrder == BinaryHierarchy<BlockType>::LEFT_SON_INDEX ? parent.left_ : parent.right_) = son;
+            }, pool, cutoff);
+    }
+
     template <typename DataType>
     BinaryExplicitHierarchy<DataType>::~BinaryExplicitHierarchy()
     {
         this->clear();
     }
 
+    template<typename DataType>
+    BinaryExplicitHierarchy<DataType> BinaryExplicitHierarchy<DataType>::clone(WorkStealingPool* pool, size_t cutoff) const
+    {
+        return BinaryExplicitHierarchy<DataType>(*this, pool, cutoff);
+    }
+
     template<typename DataType>
     size_t BinaryExplicitHierarchy<DataType>::degree(const BlockType& node) const
     {
@@ -604,6 +1185,7 @@ namespace ds::amt {
     template<typename DataType>
     auto BinaryExplicitHierarchy<DataType>::insertLeftSon(BlockType& parent) -> BlockType&
     {
+        ++this->modificationCount_;
         BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
         parent.left_ = newSon;
         newSon->parent_ = &parent;
@@ -613,6 +1195,7 @@ namespace ds::amt {
     template<typename DataType>
     auto BinaryExplicitHierarchy<DataType>::insertRightSon(BlockType& parent) -> BlockType&
     {
+        ++this->modificationCount_;
         BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
         parent.right_ = newSon;
         newSon->parent_ = &parent;
@@ -622,6 +1205,7 @@ namespace ds::amt {
     template<typename DataType>
     void BinaryExplicitHierarchy<DataType>::changeLeftSon(BlockType& parent, BlockType* newSon)
     {
+        ++this->modificationCount_;
         BlockType* oldSon = parent.left_;
         parent.left_ = newSon;
         if (oldSon != nullptr) { oldSon->parent_ = nullptr; }
@@ -631,6 +1215,7 @@ namespace ds::amt {
     template<typename DataType>
     void BinaryExplicitHierarchy<DataType>::changeRightSon(BlockType& parent, BlockType* newSon)
     {
+        ++this->modificationCount_;
         BlockType* oldSon = parent.right_;
         parent.right_ = newSon;
         if (oldSon != nullptr) { oldSon->parent_ = nullptr; }
@@ -640,6 +1225,7 @@ namespace ds::amt {
     template<typename DataType>
     void BinaryExplicitHierarchy<DataType>::removeLeftSon(BlockType& parent)
     {
+        ++this->modificationCount_;
         BlockType* removedSon = parent.left_;
 
         Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
@@ -653,6 +1239,7 @@ namespace ds::amt {
     template<typename DataType>
     void BinaryExplicitHierarchy<DataType>::removeRightSon(BlockType& parent)
     {
+        ++this->modificationCount_;
         BlockType* removedSon = parent.right_;
 
         Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
@@ -663,4 +1250,236 @@ namespace ds::amt {
         parent.right_ = nullptr;
     }
 
-}
\ No newline at end of file
+    template<typename DataType>
+    ThreadedBinaryExplicitHierarchy<DataType>::ThreadedBinaryExplicitHierarchy() :
+            ExplicitHierarchy<ThreadedBinaryExplicitHierarchyBlock<DataType>>()
+    {
+    }
+
+    template<typename DataType>
+    ThreadedBinaryExplicitHierarchy<DataType>::ThreadedBinaryExplicitHierarchy(const ThreadedBinaryExplicitHierarchy& other) :
+            ExplicitHierarchy<ThreadedBinaryExplicitHierarchyBlock<DataType>>()
+    {
+        this->assign(other);
+    }
+
+    template<typename DataType>
+    ThreadedBinaryExplicitHierarchy<DataType>::~ThreadedBinaryExplicitHierarchy()
+    {
+        this->clear();
+    }
+
+    template<typename DataType>
+    size_t ThreadedBinaryExplicitHierarchy<DataType>::degree(const BlockType& node) const
+    {
+        size_t result = 0;
+        if (!BlockType::isThread(node.left_)) ++result;
+        if (!BlockType::isThread(node.right_)) ++result;
+        return result;
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+    {
+        switch (sonOrder)
+        {
+            case BinaryHierarchy<BlockType>::LEFT_SON_INDEX:
+                return BlockType::isThread(node.left_) ? nullptr : BlockType::target(node.left_);
+            case BinaryHierarchy<BlockType>::RIGHT_SON_INDEX:
+                return BlockType::isThread(node.right_) ? nullptr : BlockType::target(node.right_);
+            default:
+                return nullptr;
+        }
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
+    {
+        ++this->modificationCount_;
+        // A new leaf inherits the thread of its parent on one side and threads to the parent on the other.
+        BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
+        if (sonOrder == BinaryHierarchy<BlockType>::LEFT_SON_INDEX)
+        {
+            newSon->left_ = parent.left_;
+            newSon->right_ = BlockType::threadLink(&parent);
+            parent.left_ = BlockType::sonLink(newSon);
+        }
+        else
+        {
+            newSon->left_ = BlockType::threadLink(&parent);
+            newSon->right_ = parent.right_;
+            parent.right_ = BlockType::sonLink(newSon);
+        }
+        newSon->parent_ = &parent;
+        return *newSon;
+    }
+
+    template<typename DataType>
+    void ThreadedBinaryExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+    {
+        ++this->modificationCount_;
+        BlockType* oldSon = this->detachSon(parent, sonOrder);
+        if (oldSon != nullptr) { oldSon->parent_ = nullptr; }
+        if (newSon != nullptr) { this->attachSon(parent, sonOrder, newSon); }
+    }
+
+    template<typename DataType>
+    void ThreadedBinaryExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
+    {
+        ++this->modificationCount_;
+        BlockType* removedSon = this->detachSon(parent, sonOrder);
+
+        Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
+        {
+            AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(b);
+        });
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::accessInOrderPredecessor(const BlockType& node) const -> BlockType*
+    {
+        return BlockType::isThread(node.left_) ? BlockType::target(node.left_) : accessRightmost(BlockType::target(node.left_));
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::accessInOrderSuccessor(const BlockType& node) const -> BlockType*
+    {
+        return accessNextInOrder(node);
+    }
+
+    template<typename DataType>
+    void ThreadedBinaryExplicitHierarchy<DataType>::processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
+    {
+        if (node == nullptr)
+        {
+            return;
+        }
+
+        const BlockType* last = accessRightmost(const_cast<BlockType*>(node));
+        const BlockType* current = accessLeftmost(const_cast<BlockType*>(node));
+        while (current != last)
+        {
+            operation(current);
+            current = accessNextInOrder(*current);
+        }
+        operation(last);
+    }
+
+    template<typename DataType>
+    typename ThreadedBinaryExplicitHierarchy<DataType>::ThreadedInOrderIterator ThreadedBinaryExplicitHierarchy<DataType>::begin()
+    {
+        return ThreadedInOrderIterator(this, this->accessRoot());
+    }
+
+    template<typename DataType>
+    typename ThreadedBinaryExplicitHierarchy<DataType>::ThreadedInOrderIterator ThreadedBinaryExplicitHierarchy<DataType>::end()
+    {
+        return ThreadedInOrderIterator(this, nullptr);
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::accessLeftmost(BlockType* node) -> BlockType*
+    {
+        while (!BlockType::isThread(node->left_))
+        {
+            node = BlockType::target(node->left_);
+        }
+        return node;
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::accessRightmost(BlockType* node) -> BlockType*
+    {
+        while (!BlockType::isThread(node->right_))
+        {
+            node = BlockType::target(node->right_);
+        }
+        return node;
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::accessNextInOrder(const BlockType& node) -> BlockType*
+    {
+        return BlockType::isThread(node.right_) ? BlockType::target(node.right_) : accessLeftmost(BlockType::target(node.right_));
+    }
+
+    template<typename DataType>
+    void ThreadedBinaryExplicitHierarchy<DataType>::attachSon(BlockType& parent, size_t sonOrder, BlockType* son)
+    {
+        // The subtree is placed between the parent and the neighbour the parent threads to on that side.
+        BlockType* leftmost = accessLeftmost(son);
+        BlockType* rightmost = accessRightmost(son);
+        if (sonOrder == BinaryHierarchy<BlockType>::LEFT_SON_INDEX)
+        {
+            leftmost->left_ = parent.left_;
+            rightmost->right_ = BlockType::threadLink(&parent);
+            parent.left_ = BlockType::sonLink(son);
+        }
+        else
+        {
+            leftmost->left_ = BlockType::threadLink(&parent);
+            rightmost->right_ = parent.right_;
+            parent.right_ = BlockType::sonLink(son);
+        }
+        son->parent_ = &parent;
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::detachSon(BlockType& parent, size_t sonOrder) -> BlockType*
+    {
+        // The parent takes over the outer thread of the subtree, the subtree keeps no threads out of itself.
+        BlockType* son = this->accessSon(parent, sonOrder);
+        if (son == nullptr)
+        {
+            return nullptr;
+        }
+
+        BlockType* leftmost = accessLeftmost(son);
+        BlockType* rightmost = accessRightmost(son);
+        if (sonOrder == BinaryHierarchy<BlockType>::LEFT_SON_INDEX)
+        {
+            parent.left_ = leftmost->left_;
+        }
+        else
+        {
+            parent.right_ = rightmost->right_;
+        }
+        leftmost->left_ = BlockType::THREAD_TAG;
+        rightmost->right_ = BlockType::THREAD_TAG;
+        return son;
+    }
+
+    template<typename DataType>
+    ThreadedBinaryExplicitHierarchy<DataType>::ThreadedInOrderIterator::ThreadedInOrderIterator(const ThreadedBinaryExplicitHierarchy<DataType>* hierarchy, BlockType* node) :
+            hierarchy_(hierarchy),
+            current_(node != nullptr ? accessLeftmost(node) : nullptr),
+            last_(node != nullptr ? accessRightmost(node) : nullptr)
+    {
+    }
+
+    template<typename DataType>
+    auto ThreadedBinaryExplicitHierarchy<DataType>::ThreadedInOrderIterator::operator++() -> ThreadedInOrderIterator&
+    {
+        current_ = current_ != last_ ? accessNextInOrder(*current_) : nullptr;
+        return *this;
+    }
+
+    template<typename DataType>
+    bool ThreadedBinaryExplicitHierarchy<DataType>::ThreadedInOrderIterator::operator==(const ThreadedInOrderIterator& other) const
+    {
+        return hierarchy_ == other.hierarchy_ && current_ == other.current_;
+    }
+
+    template<typename DataType>
+    bool ThreadedBinaryExplicitHierarchy<DataType>::ThreadedInOrderIterator::operator!=(const ThreadedInOrderIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template<typename DataType>
+    DataType& ThreadedBinaryExplicitHierarchy<DataType>::ThreadedInOrderIterator::operator*()
+    {
+        return current_->data_;
+    }
+
+}
@@ -4,7 +4,13 @@
 #include <libds/amt/network.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
+#include <libds/amt/csr_network.h>
 #include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ds::amt {
 
@@ -13,11 +19,14 @@ namespace ds::amt {
 		public MemoryBlock<DataType>
 	{
 		using RelationBlockType = typename ImplicitAMS<NetworkBlockImplicitRelations<DataType>*>::BlockType;
+		using LinkedGateBlockType = typename DoublyLS<NetworkBlockImplicitRelations<DataType>*>::BlockType;
 
-		NetworkBlockImplicitRelations() : relations_(new IS<NetworkBlockImplicitRelations<DataType>*>()) {}
+		NetworkBlockImplicitRelations() : relations_(new IS<NetworkBlockImplicitRelations<DataType>*>()), gateIndex_(0), gateBlock_(nullptr) {}
 		~NetworkBlockImplicitRelations() { delete relations_; relations_ = nullptr; }
 
 		IS<NetworkBlockImplicitRelations<DataType>*>* relations_;
+		size_t gateIndex_;
+		LinkedGateBlockType* gateBlock_;
 	};
 
 	template<typename DataType>
@@ -28,11 +37,14 @@ namespace ds::amt {
 		public MemoryBlock<DataType>
 	{
 		using RelationBlockType = typename DoublyLS<NetworkBlockExplicitRelations<DataType>*>::BlockType;
+		using LinkedGateBlockType = typename DoublyLS<NetworkBlockExplicitRelations<DataType>*>::BlockType;
 
-		NetworkBlockExplicitRelations() : relations_(new DoublyLS<NetworkBlockExplicitRelations<DataType>*>()) {}
+		NetworkBlockExplicitRelations() : relations_(new DoublyLS<NetworkBlockExplicitRelations<DataType>*>()), gateIndex_(0), gateBlock_(nullptr) {}
 		~NetworkBlockExplicitRelations() { delete relations_; relations_ = nullptr; }
 
 		DoublyLS<NetworkBlockExplicitRelations<DataType>*>* relations_;
+		size_t gateIndex_;
+		LinkedGateBlockType* gateBlock_;
 	};
 
 	template<typename DataType>
@@ -40,6 +52,14 @@ namespace ds::amt {
 
 	//----------
 
+	/**
+	 *  @brief Network whose nodes are reachable from a gate and keep their relations in sequences.
+	 *
+	 *  Every node keeps its index in the gate, so assign and freeze map nodes to indices in O(1).
+	 *  An implicit gate removes a node by moving the last node to its place, so the order of the gate changes.
+	 *  An explicit gate keeps its order, a node keeps its block of the gate and is unlinked from it in O(1).
+	 *  Indices of following nodes are then renumbered once by the next operation which reads them.
+	 */
 	template<typename BlockType, typename GateType>
 	class ExplicitNetwork :
 		public Network<BlockType>,
@@ -50,8 +70,9 @@ namespace ds::amt {
 		using GateBlockType = typename GateType::BlockType;
 		using IteratorType = typename GateType::IteratorType;
 
-		ExplicitNetwork() : gate_(new GateType()) {}
-		~ExplicitNetwork() override { delete gate_; gate_ = nullptr; }
+		ExplicitNetwork() : gate_(new GateType()), gateIndicesStale_(false) {}
+		ExplicitNetwork(const ExplicitNetwork& other) : ExplicitNetwork() { assign(other); }
+		~ExplicitNetwork() override { ExplicitNetwork<BlockType, GateType>::clear(); delete gate_; gate_ = nullptr; }
 
 		AMT& assign(const AMT& other) override;
 		void clear() override;
@@ -69,14 +90,31 @@ namespace ds::amt {
 		BlockType& insert() override;
 		void remove(BlockType* node) override;
 
+		// Index of the node in the gate, stored indices of nodes are valid until a node is removed from an explicit gate.
+		size_t gateIndexOf(const BlockType& node) const;
+
 		void connect(BlockType& nodeA, BlockType& nodeB) override;
 		void disconnect(BlockType& nodeA, BlockType& nodeB) override;
 
+		// Read-only snapshot with nodes in the order of the gate and relations in their current order.
+		CsrNetwork<typename BlockType::DataT> freeze() const; // throw(std::length_error)
+
+		// Calls operation(node, relatedNode) for relations of all nodes in the order of the gate, so every relation is processed from both of its nodes.
+		template<typename Operation>
+		void processRelations(Operation operation) const;
+
 		IteratorType begin();
 		IteratorType end();
 
 	protected:
+		void refreshGateIndices() const;
+
 		GateType* gate_;
+
+	private:
+		static constexpr bool IMPLICIT_GATE = std::is_base_of_v<IS<BlockType*>, GateType>;
+
+		mutable bool gateIndicesStale_;
 	};
 
 	template<typename DataType>
@@ -125,35 +163,32 @@ namespace ds::amt {
 			clear();
 
 			const ExplicitNetwork<BlockType, GateType>& otherExplicitNetwork = dynamic_cast<const  ExplicitNetwork<BlockType, GateType>&>(other);
+			otherExplicitNetwork.refreshGateIndices();
 
-			otherExplicitNetwork.gate_->processAllBlocksForward([&](GateBlockType* b) { insert().data_ = b->data_->data_; });
-
-			GateBlockType* myBlockFrom = gate_->accessFirst();
-			GateBlockType* otherBlockFrom = otherExplicitNetwork.gate_->accessFirst();
+			std::vector<BlockType*> nodes;
+			nodes.reserve(otherExplicitNetwork.size());
+			otherExplicitNetwork.gate_->processAllBlocksForward([&](GateBlockType* b)
+				{
+					nodes.push_back(&this->insert());
+					nodes.back()->data_ = b->data_->data_;
+				});
 
-			while (otherBlockFrom != nullptr)
-			{
-				otherBlockFrom->data_->relations_->processAllBlocksForward([&](RelationsBlockType* otherRelationsBlock)
+			// Relations are copied as they are stored, each of them was stored at both of its nodes.
+			otherExplicitNetwork.gate_->processAllBlocksForward([&](GateBlockType* b)
+				{
+					BlockType* node = nodes[b->data_->gateIndex_];
+					if constexpr (std::is_base_of_v<IS<BlockType*>, std::remove_pointer_t<decltype(node->relations_)>>)
 					{
-						size_t otherGateIndexTo = 0;
-						otherExplicitNetwork.gate_->findBlockWithProperty([&](GateBlockType* otherGateBlockIndexTo)->bool
-							{
-								if (otherGateBlockIndexTo->data_ == otherRelationsBlock->data_)
-								{
-									return true;
-								}
-								else {
-									otherGateIndexTo++;
-									return false;
-								}
-							});
-						GateBlockType* myBlockTo = gate_->access(otherGateIndexTo);
-						connect(*myBlockFrom->data_, *myBlockTo->data_);
-					});
-
-				myBlockFrom = gate_->accessNext(*myBlockFrom);
-				otherBlockFrom = otherExplicitNetwork.gate_->accessNext(*otherBlockFrom);
-			}
+						if (b->data_->relations_->size() > 0)
+						{
+							node->relations_->reserveCapacity(b->data_->relations_->size());
+						}
+					}
+					b->data_->relations_->processAllBlocksForward([&](RelationsBlockType* otherRelationsBlock)
+						{
+							node->relations_->insertLast().data_ = nodes[otherRelationsBlock->data_->gateIndex_];
+						});
+				});
 		}
 		return *this;
 	}
@@ -166,6 +201,7 @@ namespace ds::amt {
 			AMS<BlockType>::memoryManager_->releaseMemory(gate_->accessLast()->data_);
 			gate_->removeLast();
 		}
+		gateIndicesStale_ = false;
 	}
 
 	template<typename BlockType, typename GateType>
@@ -249,7 +285,13 @@ namespace ds::amt {
     BlockType& ExplicitNetwork<BlockType, GateType>::insert()
 	{
 		BlockType* newNode = AMS<BlockType>::memoryManager_->allocateMemory();
-		gate_->insertLast().data_ = newNode;
+		newNode->gateIndex_ = gate_->size();
+		GateBlockType& gateBlock = gate_->insertLast();
+		gateBlock.data_ = newNode;
+		if constexpr (!IMPLICIT_GATE)
+		{
+			newNode->gateBlock_ = &gateBlock;
+		}
 		return *newNode;
 	}
 
@@ -261,23 +303,38 @@ namespace ds::amt {
 			disconnect(*node, *node->relations_->accessLast()->data_);
 		}
 
-		GateBlockType* gateBlock = gate_->accessFirst();
-		if (gateBlock->data_ == node)
+		if constexpr (IMPLICIT_GATE)
 		{
-			gate_->removeFirst();
+			const size_t gateIndex = node->gateIndex_;
+			BlockType* lastNode = gate_->accessLast()->data_;
+			gate_->access(gateIndex)->data_ = lastNode;
+			lastNode->gateIndex_ = gateIndex;
+			gate_->removeLast();
 		}
 		else
 		{
-			GateBlockType* prevGateBlock = gate_->findPreviousToBlockWithProperty([&node](GateBlockType* b)->bool
-				{
-					return b->data_ == node;
-				});
-			gate_->removeNext(*prevGateBlock);
+			GateBlockType* previous = gate_->accessPrevious(*node->gateBlock_);
+			if (previous == nullptr)
+			{
+				gate_->removeFirst();
+			}
+			else
+			{
+				gate_->removeNext(*previous);
+			}
+			gateIndicesStale_ = gateIndicesStale_ || gate_->accessLast() != previous;
 		}
 
 		AMS<BlockType>::memoryManager_->releaseMemory(node);
 	}
 
+	template<typename BlockType, typename GateType>
+	size_t ExplicitNetwork<BlockType, GateType>::gateIndexOf(const BlockType& node) const
+	{
+		this->refreshGateIndices();
+		return node.gateIndex_;
+	}
+
 	template<typename BlockType, typename GateBlock>
     void ExplicitNetwork<BlockType, GateBlock>::connect(BlockType& nodeA, BlockType& nodeB)
 	{
@@ -310,6 +367,66 @@ namespace ds::amt {
 		disconnectRelation(nodeB, nodeA);
 	}
 
+	template<typename BlockType, typename GateType>
+    CsrNetwork<typename BlockType::DataT> ExplicitNetwork<BlockType, GateType>::freeze() const
+	{
+		using DataType = typename BlockType::DataT;
+		using IndexType = typename CsrNetwork<DataType>::IndexType;
+
+		const size_t nodeCount = gate_->size();
+		if (nodeCount >= std::numeric_limits<IndexType>::max())
+		{
+			throw std::length_error("Network is too large to be frozen!");
+		}
+
+		this->refreshGateIndices();
+		std::vector<DataType> data;
+		data.reserve(nodeCount);
+		gate_->processAllBlocksForward([&data](const GateBlockType* b) { data.push_back(b->data_->data_); });
+
+		std::vector<size_t> offsets;
+		offsets.reserve(nodeCount + 1);
+		offsets.push_back(0);
+		std::vector<IndexType> neighbours;
+		neighbours.reserve(this->relationCount());
+		gate_->processAllBlocksForward([&](const GateBlockType* b)
+			{
+				b->data_->relations_->processAllBlocksForward([&](const RelationsBlockType* r)
+					{
+						neighbours.push_back(static_cast<IndexType>(r->data_->gateIndex_));
+					});
+				offsets.push_back(neighbours.size());
+			});
+
+		return CsrNetwork<DataType>(std::move(data), std::move(offsets), std::move(neighbours));
+	}
+
+	template<typename BlockType, typename GateType>
+	template<typename Operation>
+	void ExplicitNetwork<BlockType, GateType>::processRelations(Operation operation) const
+	{
+		this->refreshGateIndices();
+		gate_->processAllBlocksForward([&operation](const GateBlockType* b)
+			{
+				const BlockType* node = b->data_;
+				node->relations_->processAllBlocksForward([&operation, node](const RelationsBlockType* r)
+					{
+						operation(node, static_cast<const BlockType*>(r->data_));
+					});
+			});
+	}
+
+	template<typename BlockType, typename GateType>
+	void ExplicitNetwork<BlockType, GateType>::refreshGateIndices() const
+	{
+		if (gateIndicesStale_)
+		{
+			size_t index = 0;
+			gate_->processAllBlocksForward([&index](const GateBlockType* b) { b->data_->gateIndex_ = index++; });
+			gateIndicesStale_ = false;
+		}
+	}
+
 	template<typename BlockType, typename GateType>
     typename ExplicitNetwork<BlockType, GateType>::IteratorType ExplicitNetwork<BlockType, GateType>::begin()
 	{
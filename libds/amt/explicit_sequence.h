@@ -2,6 +2,7 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/sequence.h>
+#include <utility>
 
 namespace ds::amt {
 
@@ -39,10 +40,30 @@ namespace ds::amt {
         void removeNext(const BlockType& block) override;
         void removePrevious(const BlockType& block) override;
 
+        // Reallocates the blocks one after another in logical order, invalidates pointers to blocks.
+        // If memoryManager is given, the sequence takes its ownership and moves the blocks into it.
+        // Only a mm::PooledMemoryManager places the blocks contiguously, the default manager leaves it to the heap.
+        // If an allocation or a copy throws, the sequence is left unchanged.
+        void compact(mm::MemoryManager<BlockType>* memoryManager = nullptr);
+
+        // Blocks are only relinked, never copied nor allocated.
+        void splice(BlockType* targetBlock, ExplicitSequence<BlockType>& other, BlockType& firstBlock, BlockType& lastBlock);
+        void splitAfter(BlockType& block, ExplicitSequence<BlockType>& target);
+        void concat(ExplicitSequence<BlockType>& other);
+
+        // Bottom-up merge sort that relinks the blocks in place.
+        void sortBlocks(std::function<bool(const BlockType&, const BlockType&)> compare);
+
     protected:
         virtual void connectBlocks(BlockType* previous, BlockType* next);
         virtual void disconnectBlock(BlockType* block);
 
+        void detachBlocks(BlockType& firstBlock, BlockType& lastBlock);
+        void attachBlocks(BlockType* targetBlock, BlockType& firstBlock, BlockType& lastBlock);
+
+        BlockType* cutAfter(BlockType* block, size_t blockCount);
+        BlockType* mergeBlocks(BlockType* tail, BlockType* left, BlockType* right, std::function<bool(const BlockType&, const BlockType&)>& compare);
+
         BlockType* first_;
         BlockType* last_;
 
@@ -447,6 +468,130 @@ namespace ds::amt {
         }
     }
 
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::compact(mm::MemoryManager<BlockType>* memoryManager)
+    {
+        mm::MemoryManager<BlockType>* oldManager = AMS<BlockType>::memoryManager_;
+        mm::MemoryManager<BlockType>* newManager = memoryManager != nullptr ? memoryManager : oldManager;
+
+        // All new blocks are allocated before the old ones are released, otherwise the allocator
+        // would hand the released addresses straight back.
+        newManager->reserve(this->size());
+        BlockType* newFirst = nullptr;
+        BlockType* newLast = nullptr;
+        try
+        {
+            for (BlockType* block = first_; block != nullptr; block = this->accessNext(*block))
+            {
+                BlockType* newBlock = newManager->allocateMemory();
+                if (newFirst == nullptr)
+                {
+                    newFirst = newBlock;
+                }
+                this->connectBlocks(newLast, newBlock);
+                newLast = newBlock;
+            }
+
+            // Data is moved only after every allocation succeeded, it is copied if moving could throw.
+            BlockType* newBlock = newFirst;
+            for (BlockType* block = first_; block != nullptr; block = this->accessNext(*block))
+            {
+                newBlock->data_ = std::move_if_noexcept(block->data_);
+                newBlock = this->accessNext(*newBlock);
+            }
+        }
+        catch (...)
+        {
+            // The sequence keeps its old blocks and the caller keeps the ownership of memoryManager.
+            while (newFirst != nullptr)
+            {
+                BlockType* nextBlock = this->accessNext(*newFirst);
+                newManager->releaseMemory(newFirst);
+                newFirst = nextBlock;
+            }
+            throw;
+        }
+
+        BlockType* oldBlock = first_;
+        first_ = newFirst;
+        last_ = newLast;
+        while (oldBlock != nullptr)
+        {
+            BlockType* nextBlock = this->accessNext(*oldBlock);
+            oldManager->releaseMemory(oldBlock);
+            oldBlock = nextBlock;
+        }
+
+        if (newManager != oldManager)
+        {
+            delete oldManager;
+            AMS<BlockType>::memoryManager_ = newManager;
+        }
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::splice(BlockType* targetBlock, ExplicitSequence<BlockType>& other, BlockType& firstBlock, BlockType& lastBlock)
+    {
+        if (&other != this)
+        {
+            size_t blockCount = 1;
+            for (BlockType* block = &firstBlock; block != &lastBlock; block = other.accessNext(*block))
+            {
+                ++blockCount;
+            }
+            other.memoryManager_->transferOwnership(*AMS<BlockType>::memoryManager_, blockCount);
+        }
+
+        other.detachBlocks(firstBlock, lastBlock);
+        this->attachBlocks(targetBlock, firstBlock, lastBlock);
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::splitAfter(BlockType& block, ExplicitSequence<BlockType>& target)
+    {
+        if (&block != last_)
+        {
+            target.splice(target.last_, *this, *this->accessNext(block), *last_);
+        }
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::concat(ExplicitSequence<BlockType>& other)
+    {
+        if (&other != this && !other.isEmpty())
+        {
+            other.memoryManager_->transferOwnership(*AMS<BlockType>::memoryManager_, other.size());
+
+            BlockType* otherFirst = other.first_;
+            BlockType* otherLast = other.last_;
+
+            other.first_ = other.last_ = nullptr;
+            this->attachBlocks(last_, *otherFirst, *otherLast);
+        }
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::sortBlocks(std::function<bool(const BlockType&, const BlockType&)> compare)
+    {
+        const size_t size = this->size();
+
+        for (size_t runLength = 1; runLength < size; runLength *= 2)
+        {
+            BlockType* remaining = first_;
+            BlockType* tail = nullptr;
+
+            while (remaining != nullptr)
+            {
+                BlockType* left = remaining;
+                BlockType* right = this->cutAfter(left, runLength);
+                remaining = this->cutAfter(right, runLength);
+                tail = this->mergeBlocks(tail, left, right, compare);
+            }
+
+            last_ = tail;
+        }
+    }
+
     template<typename BlockType>
     void ExplicitSequence<BlockType>::connectBlocks(BlockType* previous, BlockType* next)
     {
@@ -463,6 +608,99 @@ namespace ds::amt {
         block->next_ = nullptr;
     }
 
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::detachBlocks(BlockType& firstBlock, BlockType& lastBlock)
+    {
+        BlockType* previousBlock = &firstBlock == first_ ? nullptr : this->accessPrevious(firstBlock);
+        BlockType* nextBlock = this->accessNext(lastBlock);
+
+        this->connectBlocks(previousBlock, nextBlock);
+
+        if (previousBlock == nullptr)
+        {
+            first_ = nextBlock;
+        }
+        if (nextBlock == nullptr)
+        {
+            last_ = previousBlock;
+        }
+
+        this->connectBlocks(&lastBlock, nullptr);
+    }
+
+    template<typename BlockType>
+    BlockType* ExplicitSequence<BlockType>::cutAfter(BlockType* block, size_t blockCount)
+    {
+        for (size_t i = 1; block != nullptr && i < blockCount; ++i)
+        {
+            block = this->accessNext(*block);
+        }
+
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+
+        BlockType* rest = this->accessNext(*block);
+        block->next_ = nullptr;
+        return rest;
+    }
+
+    template<typename BlockType>
+    BlockType* ExplicitSequence<BlockType>::mergeBlocks(BlockType* tail, BlockType* left, BlockType* right, std::function<bool(const BlockType&, const BlockType&)>& compare)
+    {
+        auto append = [&](BlockType* block)
+        {
+            if (tail == nullptr)
+            {
+                first_ = block;
+            }
+            this->connectBlocks(tail, block);
+            tail = block;
+        };
+
+        while (left != nullptr && right != nullptr)
+        {
+            if (compare(*right, *left))
+            {
+                BlockType* block = right;
+                right = this->accessNext(*block);
+                append(block);
+            }
+            else
+            {
+                BlockType* block = left;
+                left = this->accessNext(*block);
+                append(block);
+            }
+        }
+
+        for (BlockType* block = left != nullptr ? left : right; block != nullptr; block = this->accessNext(*block))
+        {
+            append(block);
+        }
+
+        return tail;
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::attachBlocks(BlockType* targetBlock, BlockType& firstBlock, BlockType& lastBlock)
+    {
+        BlockType* nextBlock = targetBlock != nullptr ? this->accessNext(*targetBlock) : first_;
+
+        this->connectBlocks(targetBlock, &firstBlock);
+        this->connectBlocks(&lastBlock, nextBlock);
+
+        if (targetBlock == nullptr)
+        {
+            first_ = &firstBlock;
+        }
+        if (nextBlock == nullptr)
+        {
+            last_ = &lastBlock;
+        }
+    }
+
     template <typename BlockType>
     ExplicitSequence<BlockType>::ExplicitSequenceIterator::ExplicitSequenceIterator(BlockType* position) :
             position_(position)
@@ -2,7 +2,13 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/explicit_sequence.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <deque>
 #include <functional>
+#include <optional>
+#include <type_traits>
 
 namespace ds::amt {
 
@@ -36,64 +42,120 @@ namespace ds::amt {
         void processPostOrder(BlockType* node, std::function<void(BlockType*)> operation) const;
         void processLevelOrder(BlockType* node, std::function<void(BlockType*)> operation) const;
 
+        template<typename LeafFunction>
+        using FoldResult = std::decay_t<std::invoke_result_t<LeafFunction&, const BlockType*>>;
+
+        /**
+         *  @brief Folds the sub-hierarchy of the node on the pool.
+         *  leafFn maps every node to a value, combineFn merges two values. Nodes are not folded
+         *  in any particular order, so combineFn must be associative and commutative.
+         *  A task forks the oldest unvisited son on its path after every cutoff nodes it visits,
+         *  so a sub-hierarchy smaller than the cutoff is never split. Results of forked sub-hierarchies
+         *  are combined bottom-up into the task that forked them.
+         *  Returns a value-initialized result for nullptr.
+         */
+        template<typename LeafFunction, typename CombineFunction>
+        FoldResult<LeafFunction> parallelFold(const BlockType* node, LeafFunction leafFn, CombineFunction combineFn,
+                                              WorkStealingPool& pool, size_t cutoff = PARALLEL_CUTOFF) const;
+
+        /**
+         *  @brief Calls the operation for every node of the sub-hierarchy of the node on the pool.
+         *  Nodes are split among tasks as in parallelFold, the operation may run concurrently
+         *  for different nodes and must not change the structure of the hierarchy.
+         */
+        template<typename Operation>
+        void parallelForEach(BlockType* node, Operation operation, WorkStealingPool& pool, size_t cutoff = PARALLEL_CUTOFF) const;
+
+        static const size_t PARALLEL_CUTOFF = 4096;
+
     protected:
         using DataType = typename BlockType::DataT;
 
+        /**
+         *  @brief Position of an iterative traversal in a single node.
+         *  Remembers the next son order to probe and how many sons are left,
+         *  so every son of the node is found exactly once.
+         *  Hierarchies with linked sons keep the next son instead.
+         */
+        struct TraversalFrame
+        {
+            BlockType* node_;
+            size_t nextSonOrder_;
+            size_t sonsLeft_;
+            BlockType* nextSon_;
+        };
+
+        static const size_t TRAVERSAL_INIT_CAPACITY = 64;
+
+        virtual TraversalFrame makeTraversalFrame(BlockType* node) const;
+        virtual BlockType* accessNextSon(TraversalFrame& frame) const;
+
+        /**
+         *  @brief Returns the son of the node following the son at sonOrder, or nullptr after the last son.
+         *  The son is nullptr and sonOrder is INVALID_INDEX before the first son, visitedSonCount counts
+         *  the sons returned so far. On success sonOrder is moved to the order of the returned son.
+         *  The default looks the sons up by order, overrides may continue from the son instead.
+         */
+        virtual BlockType* accessSonAfter(const BlockType& node, const BlockType* son, size_t& sonOrder, size_t visitedSonCount) const;
+
+        template<typename ResultType, typename LeafFunction, typename CombineFunction>
+        ResultType foldInTask(BlockType* node, const LeafFunction& leafFn, const CombineFunction& combineFn,
+                              WorkStealingPool& pool, size_t cutoff) const;
+
         class DepthFirstIterator
         {
         protected:
             struct DepthFirstIteratorPosition
             {
-                DepthFirstIteratorPosition(BlockType* currentNode, DepthFirstIteratorPosition* previousPosition) :
+                DepthFirstIteratorPosition() :
+                        DepthFirstIteratorPosition(nullptr)
+                {}
+
+                explicit DepthFirstIteratorPosition(BlockType* currentNode) :
                         currentNode_(currentNode),
                         currentSon_(nullptr),
                         currentSonOrder_(INVALID_INDEX),
                         visitedSonCount_(0),
-                        currentNodeProcessed_(false),
-                        previousPosition_(previousPosition)
-                {}
-
-                DepthFirstIteratorPosition(const DepthFirstIteratorPosition& other) :
-                        currentNode_(other.currentNode_),
-                        currentSon_(other.currentSon_),
-                        currentSonOrder_(other.currentSonOrder_),
-                        visitedSonCount_(other.visitedSonCount_),
-                        currentNodeProcessed_(other.currentNodeProcessed_),
-                        previousPosition_(other.previousPosition_)
+                        currentNodeProcessed_(false)
                 {}
 
-                ~DepthFirstIteratorPosition() {
-                    currentNode_ = nullptr;
-                    currentSon_ = nullptr;
-                    currentSonOrder_ = 0;
-                    visitedSonCount_ = 0;
-                    currentNodeProcessed_ = false;
-                    previousPosition_ = nullptr;
-                }
-
                 BlockType* currentNode_;
                 BlockType* currentSon_;
                 size_t currentSonOrder_;
                 size_t visitedSonCount_;
                 bool currentNodeProcessed_;
-                DepthFirstIteratorPosition* previousPosition_;
             };
 
         public:
             DepthFirstIterator(Hierarchy<BlockType>* hierarchy);
             DepthFirstIterator(const DepthFirstIterator& other);
             ~DepthFirstIterator();
+            DepthFirstIterator& operator=(const DepthFirstIterator& other);
             bool operator==(const DepthFirstIterator& other) const;
             bool operator!=(const DepthFirstIterator& other) const;
             DataType& operator*();
 
         protected:
+            /**
+             *  Positions on the path from the starting node are kept in an inline
+             *  array, which is replaced by a heap array only for deeper paths.
+             */
+            static const size_t INLINE_PATH_CAPACITY = 16;
+
             void savePosition(BlockType* currentNode);
             void removePosition();
             bool tryFindNextSonInCurrentPosition();
 
             Hierarchy<BlockType>* hierarchy_;
             DepthFirstIteratorPosition* currentPosition_;
+
+        private:
+            void reservePath(size_t capacity);
+
+            DepthFirstIteratorPosition inlinePath_[INLINE_PATH_CAPACITY];
+            DepthFirstIteratorPosition* path_;
+            size_t pathCapacity_;
+            size_t pathSize_;
         };
 
     public:
@@ -103,6 +165,7 @@ namespace ds::amt {
         public:
             PreOrderHierarchyIterator(Hierarchy<BlockType>* hierarchy, BlockType* node);
             PreOrderHierarchyIterator(const PreOrderHierarchyIterator& other);
+            PreOrderHierarchyIterator& operator=(const PreOrderHierarchyIterator& other);
             PreOrderHierarchyIterator& operator++();
         };
 
@@ -163,6 +226,10 @@ namespace ds::amt {
         void removeLeftSon(BlockType& parent);
         void removeRightSon(BlockType& parent);
 
+        // In-order neighbours, found by following parent links without any extra memory.
+        virtual BlockType* accessInOrderPredecessor(const BlockType& node) const;
+        virtual BlockType* accessInOrderSuccessor(const BlockType& node) const;
+
         void processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const;
 
         //----------
@@ -254,20 +321,21 @@ namespace ds::amt {
     {
         if (node != nullptr)
         {
+            ImplicitSequence<TraversalFrame> stack(TRAVERSAL_INIT_CAPACITY, false);
             operation(node);
-
-            size_t deg = this->degree(*node);
-            size_t sonsProcessed = 0;
-            size_t n = 0;
-            while (sonsProcessed < deg)
+            stack.insertLast().data_ = this->makeTraversalFrame(const_cast<BlockType*>(node));
+            while (!stack.isEmpty())
             {
-                BlockType* son = this->accessSon(*node, n);
+                BlockType* son = this->accessNextSon(stack.accessLast()->data_);
                 if (son != nullptr)
                 {
-                    this->processPreOrder(son, operation);
-                    ++sonsProcessed;
+                    operation(son);
+                    stack.insertLast().data_ = this->makeTraversalFrame(son);
+                }
+                else
+                {
+                    stack.removeLast();
                 }
-                ++n;
             }
         }
     }
@@ -277,21 +345,23 @@ namespace ds::amt {
     {
         if (node != nullptr)
         {
-            size_t deg = this->degree(*node);
-            size_t sonsProcessed = 0;
-            size_t n = 0;
-            while (sonsProcessed < deg)
+            ImplicitSequence<TraversalFrame> stack(TRAVERSAL_INIT_CAPACITY, false);
+            stack.insertLast().data_ = this->makeTraversalFrame(node);
+            while (!stack.isEmpty())
             {
-                BlockType* son = this->accessSon(*node, n);
+                TraversalFrame& frame = stack.accessLast()->data_;
+                BlockType* son = this->accessNextSon(frame);
                 if (son != nullptr)
                 {
-                    this->processPostOrder(son, operation);
-                    ++sonsProcessed;
+                    stack.insertLast().data_ = this->makeTraversalFrame(son);
+                }
+                else
+                {
+                    BlockType* current = frame.node_;
+                    stack.removeLast();
+                    operation(current);
                 }
-                ++n;
             }
-
-            operation(node);
         }
     }
 
@@ -300,90 +370,291 @@ namespace ds::amt {
     {
         if (node != nullptr)
         {
-            SinglyLS<BlockType*> sequence;
-            sequence.insertFirst().data_ = node;
-            while (!sequence.isEmpty())
+            ImplicitSequence<BlockType*> first(TRAVERSAL_INIT_CAPACITY, false);
+            ImplicitSequence<BlockType*> second(TRAVERSAL_INIT_CAPACITY, false);
+            ImplicitSequence<BlockType*>* level = &first;
+            ImplicitSequence<BlockType*>* nextLevel = &second;
+            level->insertLast().data_ = node;
+            while (!level->isEmpty())
             {
-                BlockType* current = sequence.accessFirst()->data_;
-                sequence.removeFirst();
-                if (current != nullptr)
+                const size_t levelSize = level->size();
+                for (size_t i = 0; i < levelSize; ++i)
                 {
+                    BlockType* current = level->access(i)->data_;
                     operation(current);
-                    size_t nodeDegree = this->degree(*current);
-                    size_t n = 0;
-                    size_t sonsProcessed = 0;
-                    while (sonsProcessed < nodeDegree)
+                    TraversalFrame frame = this->makeTraversalFrame(current);
+                    BlockType* son = this->accessNextSon(frame);
+                    while (son != nullptr)
                     {
-                        BlockType* son = this->accessSon(*current, n);
-                        if (son != nullptr)
-                        {
-                            sequence.insertLast().data_ = son;
-                            ++sonsProcessed;
-                        }
-                        ++n;
+                        nextLevel->insertLast().data_ = son;
+                        son = this->accessNextSon(frame);
                     }
                 }
+                level->clear();
+                std::swap(level, nextLevel);
             }
         }
     }
 
     template<typename BlockType>
-    void BinaryHierarchy<BlockType>::processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
+    template<typename LeafFunction, typename CombineFunction>
+    auto Hierarchy<BlockType>::parallelFold(const BlockType* node, LeafFunction leafFn, CombineFunction combineFn,
+                                            WorkStealingPool& pool, size_t cutoff) const -> FoldResult<LeafFunction>
     {
-        if (node != nullptr)
+        using ResultType = FoldResult<LeafFunction>;
+        if (node == nullptr)
         {
-            this->processInOrder(this->accessLeftSon(*node), operation);
-            operation(node);
-            this->processInOrder(this->accessRightSon(*node), operation);
+            return ResultType();
         }
+
+        auto leaf = [&leafFn](BlockType* b) -> ResultType
+        {
+            return leafFn(static_cast<const BlockType*>(b));
+        };
+        return this->foldInTask<ResultType>(const_cast<BlockType*>(node), leaf, combineFn, pool, std::max<size_t>(cutoff, 1));
     }
 
     template<typename BlockType>
-    Hierarchy<BlockType>::DepthFirstIterator::DepthFirstIterator(Hierarchy<BlockType>* hierarchy) :
-            hierarchy_(hierarchy),
-            currentPosition_(nullptr)
+    template<typename Operation>
+    void Hierarchy<BlockType>::parallelForEach(BlockType* node, Operation operation, WorkStealingPool& pool, size_t cutoff) const
     {
+        struct Nothing {};
+        if (node != nullptr)
+        {
+            auto leaf = [&operation](BlockType* b) -> Nothing
+            {
+                operation(b);
+                return {};
+            };
+            auto combine = [](Nothing, Nothing) -> Nothing { return {}; };
+            this->foldInTask<Nothing>(node, leaf, combine, pool, std::max<size_t>(cutoff, 1));
+        }
     }
 
     template<typename BlockType>
-    Hierarchy<BlockType>::DepthFirstIterator::DepthFirstIterator(const DepthFirstIterator& other):
-            DepthFirstIterator(other.hierarchy_)
+    template<typename ResultType, typename LeafFunction, typename CombineFunction>
+    ResultType Hierarchy<BlockType>::foldInTask(BlockType* node, const LeafFunction& leafFn, const CombineFunction& combineFn,
+                                                WorkStealingPool& pool, size_t cutoff) const
     {
-        DepthFirstIteratorPosition* myPosition = nullptr;
-        for (DepthFirstIteratorPosition* otherPosition = other.currentPosition_;
-             otherPosition != nullptr;
-             otherPosition = otherPosition->previousPosition_)
+        WorkStealingPool::TaskGroup group;
+        // Deque keeps the addresses of the results stable while they are written by the forked tasks.
+        std::deque<std::optional<ResultType>> forkedResults;
+
+        ResultType result = leafFn(node);
+        try
         {
-            if (currentPosition_ == nullptr)
-            {
-                currentPosition_ = new DepthFirstIteratorPosition(*otherPosition);
-                myPosition = currentPosition_;
-            }
-            else
+            ImplicitSequence<TraversalFrame> stack(TRAVERSAL_INIT_CAPACITY, false);
+            stack.insertLast().data_ = this->makeTraversalFrame(node);
+            // Frames below the split frame have no unvisited sons left.
+            size_t splitFrame = 0;
+            size_t budget = cutoff;
+            while (!stack.isEmpty())
             {
-                if (myPosition != nullptr)
+                BlockType* son = this->accessNextSon(stack.accessLast()->data_);
+                if (son != nullptr)
                 {
-                    myPosition->previousPosition_ = new DepthFirstIteratorPosition(*otherPosition);
-                    myPosition = myPosition->previousPosition_;
+                    result = combineFn(std::move(result), leafFn(son));
+                    stack.insertLast().data_ = this->makeTraversalFrame(son);
+                    if (--budget == 0)
+                    {
+                        budget = cutoff;
+                        // The oldest son is the root of the largest unvisited sub-hierarchy we can hand off.
+                        while (splitFrame < stack.size())
+                        {
+                            BlockType* forkedSon = this->accessNextSon(stack.access(splitFrame)->data_);
+                            if (forkedSon != nullptr)
+                            {
+                                std::optional<ResultType>& slot = forkedResults.emplace_back();
+                                pool.fork(group, [this, forkedSon, &slot, &leafFn, &combineFn, &pool, cutoff]()
+                                    {
+                                        slot = this->foldInTask<ResultType>(forkedSon, leafFn, combineFn, pool, cutoff);
+                                    });
+                                break;
+                            }
+                            ++splitFrame;
+                        }
+                    }
                 }
                 else
                 {
-                    throw std::logic_error("Invalid DFS copy init");
+                    stack.removeLast();
+                    splitFrame = std::min(splitFrame, stack.size());
                 }
             }
         }
+        catch (...)
+        {
+            // Forked tasks refer to this frame, so they have to finish first.
+            try
+            {
+                pool.wait(group);
+            }
+            catch (...)
+            {
+            }
+            throw;
+        }
+
+        pool.wait(group);
+        for (std::optional<ResultType>& forkedResult : forkedResults)
+        {
+            result = combineFn(std::move(result), std::move(*forkedResult));
+        }
+        return result;
+    }
+
+    template<typename BlockType>
+    auto Hierarchy<BlockType>::makeTraversalFrame(BlockType* node) const -> TraversalFrame
+    {
+        return { node, 0, this->degree(*node), nullptr };
+    }
+
+    template<typename BlockType>
+    BlockType* Hierarchy<BlockType>::accessNextSon(TraversalFrame& frame) const
+    {
+        if (frame.sonsLeft_ == 0)
+        {
+            return nullptr;
+        }
+
+        BlockType* son = this->accessSon(*frame.node_, frame.nextSonOrder_++);
+        while (son == nullptr)
+        {
+            son = this->accessSon(*frame.node_, frame.nextSonOrder_++);
+        }
+        --frame.sonsLeft_;
+        return son;
+    }
+
+    template<typename BlockType>
+    BlockType* Hierarchy<BlockType>::accessSonAfter(const BlockType& node, const BlockType*, size_t& sonOrder, size_t visitedSonCount) const
+    {
+        if (visitedSonCount >= this->degree(node))
+        {
+            return nullptr;
+        }
+
+        BlockType* nextSon;
+        do
+        {
+            nextSon = this->accessSon(node, ++sonOrder);
+        } while (nextSon == nullptr);
+        return nextSon;
+    }
+
+    template<typename BlockType>
+    BlockType* BinaryHierarchy<BlockType>::accessInOrderPredecessor(const BlockType& node) const
+    {
+        BlockType* son = this->accessLeftSon(node);
+        if (son != nullptr)
+        {
+            BlockType* rightSon = this->accessRightSon(*son);
+            while (rightSon != nullptr)
+            {
+                son = rightSon;
+                rightSon = this->accessRightSon(*son);
+            }
+            return son;
+        }
+
+        const BlockType* current = &node;
+        BlockType* parent = this->accessParent(*current);
+        while (parent != nullptr && this->accessLeftSon(*parent) == current)
+        {
+            current = parent;
+            parent = this->accessParent(*current);
+        }
+        return parent;
+    }
+
+    template<typename BlockType>
+    BlockType* BinaryHierarchy<BlockType>::accessInOrderSuccessor(const BlockType& node) const
+    {
+        BlockType* son = this->accessRightSon(node);
+        if (son != nullptr)
+        {
+            BlockType* leftSon = this->accessLeftSon(*son);
+            while (leftSon != nullptr)
+            {
+                son = leftSon;
+                leftSon = this->accessLeftSon(*son);
+            }
+            return son;
+        }
+
+        const BlockType* current = &node;
+        BlockType* parent = this->accessParent(*current);
+        while (parent != nullptr && this->accessRightSon(*parent) == current)
+        {
+            current = parent;
+            parent = this->accessParent(*current);
+        }
+        return parent;
+    }
+
+    template<typename BlockType>
+    void BinaryHierarchy<BlockType>::processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
+    {
+        ImplicitSequence<const BlockType*> stack(Hierarchy<BlockType>::TRAVERSAL_INIT_CAPACITY, false);
+        while (node != nullptr || !stack.isEmpty())
+        {
+            while (node != nullptr)
+            {
+                stack.insertLast().data_ = node;
+                node = this->accessLeftSon(*node);
+            }
+            node = stack.accessLast()->data_;
+            stack.removeLast();
+            operation(node);
+            node = this->accessRightSon(*node);
+        }
+    }
+
+    template<typename BlockType>
+    Hierarchy<BlockType>::DepthFirstIterator::DepthFirstIterator(Hierarchy<BlockType>* hierarchy) :
+            hierarchy_(hierarchy),
+            currentPosition_(nullptr),
+            path_(inlinePath_),
+            pathCapacity_(INLINE_PATH_CAPACITY),
+            pathSize_(0)
+    {
+    }
+
+    template<typename BlockType>
+    Hierarchy<BlockType>::DepthFirstIterator::DepthFirstIterator(const DepthFirstIterator& other):
+            DepthFirstIterator(other.hierarchy_)
+    {
+        *this = other;
     }
 
     template<typename BlockType>
     Hierarchy<BlockType>::DepthFirstIterator::~DepthFirstIterator()
     {
-        while (currentPosition_ != nullptr)
+        if (path_ != inlinePath_)
         {
-            this->removePosition();
+            delete[] path_;
         }
 
         hierarchy_ = nullptr;
         currentPosition_ = nullptr;
+        path_ = nullptr;
+        pathCapacity_ = 0;
+        pathSize_ = 0;
+    }
+
+    template<typename BlockType>
+    auto Hierarchy<BlockType>::DepthFirstIterator::operator=(const DepthFirstIterator& other) -> DepthFirstIterator&
+    {
+        if (this != &other)
+        {
+            hierarchy_ = other.hierarchy_;
+            this->reservePath(other.pathSize_);
+            std::copy(other.path_, other.path_ + other.pathSize_, path_);
+            pathSize_ = other.pathSize_;
+            currentPosition_ = pathSize_ > 0 ? &path_[pathSize_ - 1] : nullptr;
+        }
+
+        return *this;
     }
 
     template<typename BlockType>
@@ -424,30 +695,49 @@ namespace ds::amt {
     template<typename BlockType>
     void Hierarchy<BlockType>::DepthFirstIterator::savePosition(BlockType* currentNode)
     {
-        currentPosition_ = new DepthFirstIteratorPosition(currentNode, currentPosition_);
+        if (pathSize_ == pathCapacity_)
+        {
+            this->reservePath(2 * pathCapacity_);
+        }
+
+        path_[pathSize_] = DepthFirstIteratorPosition(currentNode);
+        currentPosition_ = &path_[pathSize_];
+        ++pathSize_;
     }
 
     template<typename BlockType>
     void Hierarchy<BlockType>::DepthFirstIterator::removePosition()
     {
-        DepthFirstIteratorPosition* positionToRemove = currentPosition_;
-        currentPosition_ = currentPosition_->previousPosition_;
-        delete positionToRemove;
+        --pathSize_;
+        currentPosition_ = pathSize_ > 0 ? &path_[pathSize_ - 1] : nullptr;
     }
 
     template<typename BlockType>
-    bool Hierarchy<BlockType>::DepthFirstIterator::tryFindNextSonInCurrentPosition()
+    void Hierarchy<BlockType>::DepthFirstIterator::reservePath(size_t capacity)
     {
-        ++currentPosition_->visitedSonCount_;
-
-        size_t currentDegree = hierarchy_->degree(*currentPosition_->currentNode_);
-        if (currentPosition_->visitedSonCount_ <= currentDegree)
+        if (capacity > pathCapacity_)
         {
-            do
+            DepthFirstIteratorPosition* newPath = new DepthFirstIteratorPosition[capacity];
+            std::copy(path_, path_ + pathSize_, newPath);
+            if (path_ != inlinePath_)
             {
-                ++currentPosition_->currentSonOrder_;
-                currentPosition_->currentSon_ = hierarchy_->accessSon(*currentPosition_->currentNode_, currentPosition_->currentSonOrder_);
-            } while (currentPosition_->currentSon_ == nullptr);
+                delete[] path_;
+            }
+            path_ = newPath;
+            pathCapacity_ = capacity;
+            currentPosition_ = pathSize_ > 0 ? &path_[pathSize_ - 1] : nullptr;
+        }
+    }
+
+    template<typename BlockType>
+    bool Hierarchy<BlockType>::DepthFirstIterator::tryFindNextSonInCurrentPosition()
+    {
+        currentPosition_->currentSon_ = hierarchy_->accessSonAfter(
+            *currentPosition_->currentNode_, currentPosition_->currentSon_,
+            currentPosition_->currentSonOrder_, currentPosition_->visitedSonCount_);
+        if (currentPosition_->currentSon_ != nullptr)
+        {
+            ++currentPosition_->visitedSonCount_;
             return true;
         }
         else
@@ -474,20 +764,25 @@ namespace ds::amt {
     {
     }
 
+    template<typename BlockType>
+    typename Hierarchy<BlockType>::PreOrderHierarchyIterator& Hierarchy<BlockType>::PreOrderHierarchyIterator::operator=(const PreOrderHierarchyIterator& other)
+    {
+        DepthFirstIterator::operator=(other);
+        return *this;
+    }
+
     template<typename BlockType>
     typename Hierarchy<BlockType>::PreOrderHierarchyIterator& Hierarchy<BlockType>::PreOrderHierarchyIterator::operator++()
     {
-        if (this->tryFindNextSonInCurrentPosition())
+        while (this->currentPosition_ != nullptr)
         {
-            this->savePosition(this->currentPosition_->currentSon_);
-        }
-        else
-        {
-            this->removePosition();
-            if (this->currentPosition_ != nullptr)
+            if (this->tryFindNextSonInCurrentPosition())
             {
-                ++(*this);
+                this->savePosition(this->currentPosition_->currentSon_);
+                break;
             }
+
+            this->removePosition();
         }
 
         return *this;
@@ -513,20 +808,19 @@ namespace ds::amt {
     template<typename BlockType>
     typename Hierarchy<BlockType>::PostOrderHierarchyIterator& Hierarchy<BlockType>::PostOrderHierarchyIterator::operator++()
     {
-        if (!this->currentPosition_->currentNodeProcessed_ && this->tryFindNextSonInCurrentPosition())
+        while (this->currentPosition_ != nullptr)
         {
-            this->savePosition(this->currentPosition_->currentSon_);
-            ++(*this);
-        }
-        else
-        {
-            if (this->currentPosition_->currentNodeProcessed_)
+            if (!this->currentPosition_->currentNodeProcessed_)
             {
-                this->removePosition();
-                if (this->currentPosition_ != nullptr)
+                if (!this->tryFindNextSonInCurrentPosition())
                 {
-                    ++(*this);
+                    break;
                 }
+                this->savePosition(this->currentPosition_->currentSon_);
+            }
+            else
+            {
+                this->removePosition();
             }
         }
 
@@ -661,28 +955,23 @@ namespace ds::amt {
     template<typename BlockType>
     typename BinaryHierarchy<BlockType>::InOrderHierarchyIterator& BinaryHierarchy<BlockType>::InOrderHierarchyIterator::operator++()
     {
-        if (!this->currentPosition_->currentNodeProcessed_)
+        while (this->currentPosition_ != nullptr)
         {
-            if (this->currentPosition_->currentSonOrder_ != LEFT_SON_INDEX && this->tryToGoToLeftSonInCurrentPosition())
+            if (!this->currentPosition_->currentNodeProcessed_)
             {
+                if (this->currentPosition_->currentSonOrder_ == LEFT_SON_INDEX || !this->tryToGoToLeftSonInCurrentPosition())
+                {
+                    break;
+                }
                 this->savePosition(this->currentPosition_->currentSon_);
-                ++(*this);
             }
-        }
-        else
-        {
-            if (this->currentPosition_->currentSonOrder_ != RIGHT_SON_INDEX && this->tryToGoToRightSonInCurrentPosition())
+            else if (this->currentPosition_->currentSonOrder_ != RIGHT_SON_INDEX && this->tryToGoToRightSonInCurrentPosition())
             {
                 this->savePosition(this->currentPosition_->currentSon_);
-                ++(*this);
             }
             else
             {
                 this->removePosition();
-                if (this->currentPosition_ != nullptr)
-                {
-                    ++(*this);
-                }
             }
         }
 
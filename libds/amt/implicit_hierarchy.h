@@ -2,7 +2,8 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/hierarchy.h>
-#include <cmath>
+#include <libds/simd.h>
+#include <algorithm>
 
 namespace ds::amt {
 
@@ -16,7 +17,7 @@ namespace ds::amt {
         ~ImplicitHierarchy() override;
 
         size_t level(const MemoryBlock<DataType>& node) const override;
-        size_t level(size_t index) const;
+        static constexpr size_t level(size_t index);
         size_t degree(const MemoryBlock<DataType>& node) const override;
         size_t degree(size_t index) const;
         // Overload with one parameter hides overload with no parameter. We need to explicitly 'include' it.
@@ -39,9 +40,12 @@ namespace ds::amt {
         void removeLastLeaf();
 
         size_t indexOfParent(const MemoryBlock<DataType>& node) const;
-        size_t indexOfParent(size_t index) const;
+        static constexpr size_t indexOfParent(size_t index);
         size_t indexOfSon(const MemoryBlock<DataType>& node, size_t sonOrder) const;
-        size_t indexOfSon(size_t indexOfParent, size_t sonOrder) const;
+        static constexpr size_t indexOfSon(size_t indexOfParent, size_t sonOrder);
+
+    private:
+        static constexpr bool IS_POWER_OF_TWO = (K & (K - 1)) == 0;
     };
 
     template<typename DataType, size_t K>
@@ -78,9 +82,30 @@ namespace ds::amt {
     }
 
     template<typename DataType, size_t K>
-    size_t ImplicitHierarchy<DataType, K>::level(size_t index) const
+    constexpr size_t ImplicitHierarchy<DataType, K>::level(size_t index)
     {
-        return static_cast<size_t>(std::floor(std::log((K - 1) * (index + 1)) / std::log(K)));
+        // Level L starts at index (K^L - 1) / (K - 1), so it is the largest L with K^L <= (K - 1) * index + 1.
+        if constexpr (K == 1)
+        {
+            return index;
+        }
+        else if constexpr (IS_POWER_OF_TWO)
+        {
+            return simd::scalar::floorLog2((K - 1) * index + 1) / simd::scalar::floorLog2(K);
+        }
+        else
+        {
+            size_t result = 0;
+            size_t levelSize = 1;
+            size_t levelEnd = 1;
+            while (index >= levelEnd)
+            {
+                levelSize *= K;
+                levelEnd += levelSize;
+                ++result;
+            }
+            return result;
+        }
     }
 
     template<typename DataType, size_t K>
@@ -92,34 +117,9 @@ namespace ds::amt {
     template<typename DataType, size_t K>
     size_t ImplicitHierarchy<DataType, K>::degree(size_t index) const
     {
-        const size_t currentLevel = this->level(index);
-        const size_t indexOfLast = this->size() - 1;
-        const size_t depth = this->level(indexOfLast);
-
-        if (currentLevel == depth)
-        {
-            return 0;
-        }
-        else if (currentLevel == depth - 1)
-        {
-            const size_t indexOfLastsParent = indexOfParent(indexOfLast);
-            if (index < indexOfLastsParent)
-            {
-                return K;
-            }
-            else if (index > indexOfLastsParent)
-            {
-                return 0;
-            }
-            else {
-                const size_t mod = (this->size() - 1) % K;
-                return mod == 0 ? K : mod;
-            }
-        }
-        else
-        {
-            return K;
-        }
+        const size_t size = this->size();
+        const size_t indexOfFirstSon = indexOfSon(index, 0);
+        return indexOfFirstSon < size ? (std::min)(K, size - indexOfFirstSon) : 0;
     }
 
     template<typename DataType, size_t K>
@@ -134,7 +134,7 @@ namespace ds::amt {
     MemoryBlock<DataType>* ImplicitHierarchy<DataType, K>::accessRoot() const
     {
         return this->size() > 0
-               ? &this->getMemoryManager()->getBlockAt(0)
+               ? this->accessBlockAt(0)
                : nullptr;
     }
 
@@ -143,7 +143,7 @@ namespace ds::amt {
     {
         const size_t index = this->indexOfParent(node);
         return INVALID_INDEX != index
-               ? &this->getMemoryManager()->getBlockAt(index)
+               ? this->accessBlockAt(index)
                : nullptr;
     }
 
@@ -152,7 +152,7 @@ namespace ds::amt {
     {
         const size_t index = this->indexOfSon(node, sonOrder);
         return index < this->size()
-               ? &this->getMemoryManager()->getBlockAt(index)
+               ? this->accessBlockAt(index)
                : nullptr;
     }
 
@@ -161,7 +161,7 @@ namespace ds::amt {
     {
         const size_t size = this->size();
         return size != 0
-               ? &this->getMemoryManager()->getBlockAt(size - 1)
+               ? this->accessBlockAt(size - 1)
                : nullptr;
     }
 
@@ -214,7 +214,7 @@ namespace ds::amt {
     }
 
     template<typename DataType, size_t K>
-    size_t ImplicitHierarchy<DataType, K>::indexOfParent(size_t index) const
+    constexpr size_t ImplicitHierarchy<DataType, K>::indexOfParent(size_t index)
     {
         return 0 == index ? INVALID_INDEX : (index - 1) / K;
     }
@@ -226,7 +226,7 @@ namespace ds::amt {
     }
 
     template<typename DataType, size_t K>
-    size_t ImplicitHierarchy<DataType, K>::indexOfSon(size_t indexOfParent, size_t sonOrder) const
+    constexpr size_t ImplicitHierarchy<DataType, K>::indexOfSon(size_t indexOfParent, size_t sonOrder)
     {
         return K * indexOfParent + sonOrder + 1;
     }
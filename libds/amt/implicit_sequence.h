@@ -2,6 +2,12 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/sequence.h>
+#include <libds/simd.h>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ds::amt {
 
@@ -19,6 +25,10 @@ namespace ds::amt {
         ImplicitSequence(const ImplicitSequence<DataType>& other);
         ~ImplicitSequence() override = default;
 
+        AMT& assign(const AMT& other) override;
+        void clear() override;
+        bool equals(const AMT& other) override;
+
         size_t calculateIndex(BlockType& block) override;
 
         BlockType* accessFirst() const override;
@@ -27,6 +37,9 @@ namespace ds::amt {
         BlockType* accessNext(const BlockType& block) const override;
         BlockType* accessPrevious(const BlockType& block) const override;
 
+        // Read-only access that does not copy a buffer shared by copy-on-write, access copies it.
+        const BlockType* read(size_t index) const;
+
         BlockType& insertFirst() override;
         BlockType& insertLast() override;
         BlockType& insert(size_t index) override;
@@ -41,9 +54,46 @@ namespace ds::amt {
 
         void reserveCapacity(size_t capacity);
 
+        // Deferred removal: the block stays in place as a tombstone skipped by access to neighbours
+        // and by iteration, access to its index returns nullptr. Indices and size() keep counting tombstones,
+        // so indices held by the caller stay valid until compact() or compactIfSparse() is called,
+        // which the caller does once at the end of a pass. liveCount() excludes tombstones.
+        void markRemoved(size_t index);
+        bool isRemoved(size_t index) const;
+        size_t getRemovedCount() const;
+        size_t liveCount() const;
+        void setCompactionThreshold(double deadRatio);
+        void compact();
+        // Compacts if the dead ratio exceeds the compaction threshold, returns whether it did.
+        bool compactIfSparse();
+
+        // Removes all blocks satisfying the predicate (and all tombstones) in a single pass.
+        size_t removeIf(std::function<bool(BlockType*)> predicate);
+
+        // Search and reductions for arithmetic data, vectorized where the platform allows.
+        size_t find(DataType value) const;
+        size_t count(DataType value) const;
+        DataType minimum() const;
+        DataType maximum() const;
+        auto sum() const;
+        bool containsAny(const std::vector<DataType>& values) const;
+
         virtual size_t indexOfNext(size_t currentIndex) const;
         virtual size_t indexOfPrevious(size_t currentIndex) const;
 
+        static constexpr double DEFAULT_COMPACTION_THRESHOLD = 0.25;
+
+    private:
+        // Calls operation(first, count) for each run of blocks without tombstones until it returns false.
+        void processLiveRuns(std::function<bool(const DataType*, size_t)> operation) const;
+        size_t skipRemoved(size_t index, bool forward) const;
+        void onInserted(size_t index);
+        void onReleased(size_t index);
+
+        std::vector<bool> removed_;
+        size_t removedCount_ = 0;
+        double compactionThreshold_ = DEFAULT_COMPACTION_THRESHOLD;
+
     public:
         class ImplicitSequenceIterator
         {
@@ -61,10 +111,30 @@ namespace ds::amt {
             size_t position_;
         };
 
+        // Read-only iteration that does not copy a buffer shared by copy-on-write.
+        class ImplicitSequenceConstIterator
+        {
+        public:
+            ImplicitSequenceConstIterator(const ImplicitSequence<DataType>* sequence, size_t index);
+            ImplicitSequenceConstIterator(const ImplicitSequenceConstIterator& other);
+            ImplicitSequenceConstIterator& operator++();
+            ImplicitSequenceConstIterator operator++(int);
+            bool operator==(const ImplicitSequenceConstIterator& other) const;
+            bool operator!=(const ImplicitSequenceConstIterator& other) const;
+            const DataType& operator*() const;
+
+        private:
+            const ImplicitSequence<DataType>* sequence_;
+            size_t position_;
+        };
+
         using IteratorType = ImplicitSequenceIterator;
+        using ConstIteratorType = ImplicitSequenceConstIterator;
 
         IteratorType begin();
         IteratorType end();
+        ConstIteratorType begin() const;
+        ConstIteratorType end() const;
     };
 
     template<typename DataType>
@@ -96,8 +166,63 @@ namespace ds::amt {
 
     template<typename DataType>
     ImplicitSequence<DataType>::ImplicitSequence(const ImplicitSequence<DataType>& other):
-            ImplicitAMS<DataType>::ImplicitAbstractMemoryStructure(other)
+            ImplicitAMS<DataType>::ImplicitAbstractMemoryStructure(other),
+            removed_(other.removed_),
+            removedCount_(other.removedCount_),
+            compactionThreshold_(other.compactionThreshold_)
+    {
+    }
+
+    template<typename DataType>
+    AMT& ImplicitSequence<DataType>::assign(const AMT& other)
+    {
+        if (this != &other)
+        {
+            ImplicitAMS<DataType>::assign(other);
+
+            const ImplicitSequence<DataType>* otherSequence = dynamic_cast<const ImplicitSequence<DataType>*>(&other);
+            removed_ = otherSequence != nullptr ? otherSequence->removed_ : std::vector<bool>();
+            removedCount_ = otherSequence != nullptr ? otherSequence->removedCount_ : 0;
+        }
+
+        return *this;
+    }
+
+    template<typename DataType>
+    void ImplicitSequence<DataType>::clear()
     {
+        ImplicitAMS<DataType>::clear();
+        removed_.clear();
+        removedCount_ = 0;
+    }
+
+    template<typename DataType>
+    bool ImplicitSequence<DataType>::equals(const AMT& other)
+    {
+        const ImplicitSequence<DataType>* otherSequence = dynamic_cast<const ImplicitSequence<DataType>*>(&other);
+        if (otherSequence == nullptr || (removedCount_ == 0 && otherSequence->removedCount_ == 0))
+        {
+            return ImplicitAMS<DataType>::equals(other);
+        }
+
+        if (this->liveCount() != otherSequence->liveCount())
+        {
+            return false;
+        }
+
+        size_t index = this->skipRemoved(0, true);
+        size_t otherIndex = otherSequence->skipRemoved(0, true);
+        while (index < this->size())
+        {
+            if (std::memcmp(this->read(index), otherSequence->read(otherIndex), sizeof(BlockType)) != 0)
+            {
+                return false;
+            }
+            index = this->skipRemoved(index + 1, true);
+            otherIndex = otherSequence->skipRemoved(otherIndex + 1, true);
+        }
+
+        return true;
     }
 
     template<typename DataType>
@@ -109,53 +234,65 @@ namespace ds::amt {
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType* ImplicitSequence<DataType>::accessFirst() const
     {
-        return this->size() > 0 ? &this->getMemoryManager()->getBlockAt(0) : nullptr;
+        const size_t index = this->skipRemoved(0, true);
+        return index < this->size() ? this->accessBlockAt(index) : nullptr;
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType* ImplicitSequence<DataType>::accessLast() const
     {
-        const size_t size = this->size();
-        return size > 0 ? &this->getMemoryManager()->getBlockAt(size - 1) : nullptr;
+        const size_t slotCount = this->size();
+        const size_t index = slotCount > 0 ? this->skipRemoved(slotCount - 1, false) : INVALID_INDEX;
+        return index < slotCount ? this->accessBlockAt(index) : nullptr;
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType* ImplicitSequence<DataType>::access(size_t index) const
     {
-        return index < this->size() ? &this->getMemoryManager()->getBlockAt(index): nullptr;
+        return index < this->size() && !this->isRemoved(index) ? this->accessBlockAt(index) : nullptr;
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType* ImplicitSequence<DataType>::accessNext(const BlockType& block) const
     {
         MemoryManagerType* memManager = this->getMemoryManager();
-        const size_t index = this->indexOfNext(memManager->calculateIndex(block));
-        return index < this->size() ? &memManager->getBlockAt(index) : nullptr;
+        const size_t index = this->skipRemoved(this->indexOfNext(memManager->calculateIndex(block)), true);
+        return index < this->size() ? this->accessBlockAt(index) : nullptr;
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType* ImplicitSequence<DataType>::accessPrevious(const BlockType& block) const
     {
         MemoryManagerType* memManager = this->getMemoryManager();
-        const size_t index = this->indexOfPrevious(memManager->calculateIndex(block));
-        return index != INVALID_INDEX ? &memManager->getBlockAt(index) : nullptr;
+        const size_t index = this->skipRemoved(this->indexOfPrevious(memManager->calculateIndex(block)), false);
+        return index != INVALID_INDEX ? this->accessBlockAt(index) : nullptr;
+    }
+
+    template<typename DataType>
+    const typename ImplicitSequence<DataType>::BlockType* ImplicitSequence<DataType>::read(size_t index) const
+    {
+        const MemoryManagerType* memManager = this->getMemoryManager();
+        return index < this->size() ? &memManager->getBlockAt(index) : nullptr;
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::insertFirst()
     {
+        this->onInserted(0);
         return *this->getMemoryManager()->allocateMemoryAt(0);
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::insertLast()
     {
+        this->onInserted(this->size());
         return *this->getMemoryManager()->allocateMemory();
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::insert(size_t index)
     {
+        this->onInserted(index);
         return *this->getMemoryManager()->allocateMemoryAt(index);
     }
 
@@ -163,32 +300,47 @@ namespace ds::amt {
     typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::insertAfter(BlockType& block)
     {
         MemoryManagerType* memManager = this->getMemoryManager();
-        return *memManager->allocateMemoryAt(memManager->calculateIndex(block) + 1);
+        const size_t index = memManager->calculateIndex(block) + 1;
+        this->onInserted(index);
+        return *memManager->allocateMemoryAt(index);
     }
 
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::insertBefore(BlockType& block)
     {
         MemoryManagerType* memManager = this->getMemoryManager();
-        return *memManager->allocateMemoryAt(memManager->calculateIndex(block));
-
+        const size_t index = memManager->calculateIndex(block);
+        this->onInserted(index);
+        return *memManager->allocateMemoryAt(index);
     }
 
     template<typename DataType>
     void ImplicitSequence<DataType>::removeFirst()
     {
-        this->getMemoryManager()->releaseMemoryAt(0);
+        const size_t index = this->skipRemoved(0, true);
+        this->onReleased(index);
+        this->getMemoryManager()->releaseMemoryAt(index);
     }
 
     template<typename DataType>
     void ImplicitSequence<DataType>::removeLast()
     {
-        this->getMemoryManager()->releaseMemory();
+        const size_t index = this->skipRemoved(this->size() - 1, false);
+        this->onReleased(index);
+        if (index == this->size() - 1)
+        {
+            this->getMemoryManager()->releaseMemory();
+        }
+        else
+        {
+            this->getMemoryManager()->releaseMemoryAt(index);
+        }
     }
 
     template<typename DataType>
     void ImplicitSequence<DataType>::remove(size_t index)
     {
+        this->onReleased(index);
         this->getMemoryManager()->releaseMemoryAt(index);
     }
 
@@ -196,14 +348,18 @@ namespace ds::amt {
     void ImplicitSequence<DataType>::removeNext(const BlockType& block)
     {
         MemoryManagerType* memManager = this->getMemoryManager();
-        memManager->releaseMemoryAt(this->indexOfNext(memManager->calculateIndex(block)));
+        const size_t index = this->skipRemoved(this->indexOfNext(memManager->calculateIndex(block)), true);
+        this->onReleased(index);
+        memManager->releaseMemoryAt(index);
     }
 
     template<typename DataType>
     void ImplicitSequence<DataType>::removePrevious(const BlockType& block)
     {
         MemoryManagerType* memManager = this->getMemoryManager();
-        memManager->releaseMemoryAt(this->indexOfPrevious(memManager->calculateIndex(block)));
+        const size_t index = this->skipRemoved(this->indexOfPrevious(memManager->calculateIndex(block)), false);
+        this->onReleased(index);
+        memManager->releaseMemoryAt(index);
     }
 
     template<typename DataType>
@@ -212,6 +368,116 @@ namespace ds::amt {
         this->getMemoryManager()->changeCapacity(capacity);
     }
 
+    template<typename DataType>
+    void ImplicitSequence<DataType>::markRemoved(size_t index)
+    {
+        if (index >= this->size())
+        {
+            throw std::out_of_range("Invalid index!");
+        }
+
+        if (removed_.empty())
+        {
+            removed_.assign(this->size(), false);
+        }
+
+        if (!removed_[index])
+        {
+            removed_[index] = true;
+            ++removedCount_;
+        }
+    }
+
+    template<typename DataType>
+    bool ImplicitSequence<DataType>::isRemoved(size_t index) const
+    {
+        return removedCount_ > 0 && removed_[index];
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::getRemovedCount() const
+    {
+        return removedCount_;
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::liveCount() const
+    {
+        return this->size() - removedCount_;
+    }
+
+    template<typename DataType>
+    void ImplicitSequence<DataType>::setCompactionThreshold(double deadRatio)
+    {
+        if (deadRatio < 0.0 || deadRatio >= 1.0)
+        {
+            throw std::invalid_argument("Dead ratio must be in [0, 1)!");
+        }
+
+        compactionThreshold_ = deadRatio;
+    }
+
+    template<typename DataType>
+    void ImplicitSequence<DataType>::compact()
+    {
+        if (removedCount_ > 0)
+        {
+            this->removeIf([](BlockType*) { return false; });
+        }
+    }
+
+    template<typename DataType>
+    bool ImplicitSequence<DataType>::compactIfSparse()
+    {
+        if (static_cast<double>(removedCount_) > compactionThreshold_ * static_cast<double>(this->size()))
+        {
+            this->compact();
+            return true;
+        }
+
+        return false;
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::removeIf(std::function<bool(BlockType*)> predicate)
+    {
+        MemoryManagerType* memManager = this->getMemoryManager();
+        const size_t size = this->size();
+        size_t removedByPredicate = 0;
+        size_t target = 0;
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            BlockType& block = memManager->getBlockAt(index);
+            if (this->isRemoved(index))
+            {
+                continue;
+            }
+
+            if (predicate(&block))
+            {
+                ++removedByPredicate;
+                continue;
+            }
+
+            if (target != index)
+            {
+                memManager->getBlockAt(target).data_ = std::move(block.data_);
+            }
+            ++target;
+        }
+
+        if (target < size)
+        {
+            memManager->releaseMemory(&memManager->getBlockAt(target));
+        }
+
+        removed_.clear();
+        removedCount_ = 0;
+
+        return removedByPredicate;
+    }
+
     template<typename DataType>
     size_t ImplicitSequence<DataType>::indexOfNext(size_t currentIndex) const
     {
@@ -224,6 +490,179 @@ namespace ds::amt {
         return currentIndex <= 0 ? INVALID_INDEX : currentIndex - 1;
     }
 
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::find(DataType value) const
+    {
+        size_t result = INVALID_INDEX;
+        this->processLiveRuns([&](const DataType* first, size_t count)
+            {
+                const size_t index = simd::find(first, count, value);
+                if (index != INVALID_INDEX)
+                {
+                    result = static_cast<size_t>(first - &this->read(0)->data_) + index;
+                }
+                return index == INVALID_INDEX;
+            });
+        return result;
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::count(DataType value) const
+    {
+        size_t result = 0;
+        this->processLiveRuns([&](const DataType* first, size_t count)
+            {
+                result += simd::count(first, count, value);
+                return true;
+            });
+        return result;
+    }
+
+    template<typename DataType>
+    DataType ImplicitSequence<DataType>::minimum() const
+    {
+        if (this->liveCount() == 0)
+        {
+            throw std::out_of_range("Sequence is empty!");
+        }
+
+        bool found = false;
+        DataType value{};
+        this->processLiveRuns([&](const DataType* first, size_t count)
+            {
+                const DataType runMinimum = simd::minimum(first, count);
+                value = !found || runMinimum < value ? runMinimum : value;
+                found = true;
+                return true;
+            });
+        return value;
+    }
+
+    template<typename DataType>
+    DataType ImplicitSequence<DataType>::maximum() const
+    {
+        if (this->liveCount() == 0)
+        {
+            throw std::out_of_range("Sequence is empty!");
+        }
+
+        bool found = false;
+        DataType value{};
+        this->processLiveRuns([&](const DataType* first, size_t count)
+            {
+                const DataType runMaximum = simd::maximum(first, count);
+                value = !found || value < runMaximum ? runMaximum : value;
+                found = true;
+                return true;
+            });
+        return value;
+    }
+
+    template<typename DataType>
+    auto ImplicitSequence<DataType>::sum() const
+    {
+        simd::SumType<DataType> result = 0;
+        this->processLiveRuns([&](const DataType* first, size_t count)
+            {
+                result += simd::sum(first, count);
+                return true;
+            });
+        return result;
+    }
+
+    template<typename DataType>
+    bool ImplicitSequence<DataType>::containsAny(const std::vector<DataType>& values) const
+    {
+        bool result = false;
+        this->processLiveRuns([&](const DataType* first, size_t count)
+            {
+                result = simd::containsAny(first, count, values.data(), values.size());
+                return !result;
+            });
+        return result;
+    }
+
+    template<typename DataType>
+    void ImplicitSequence<DataType>::processLiveRuns(std::function<bool(const DataType*, size_t)> operation) const
+    {
+        static_assert(std::is_arithmetic_v<DataType>, "Kernels are available only for arithmetic data.");
+        static_assert(sizeof(BlockType) == sizeof(DataType), "Blocks must form a plain array of data.");
+
+        const size_t size = this->size();
+        if (size == 0)
+        {
+            return;
+        }
+
+        const DataType* data = &this->read(0)->data_;
+        if (removedCount_ == 0)
+        {
+            operation(data, size);
+            return;
+        }
+
+        size_t first = 0;
+        while (first < size)
+        {
+            first = this->skipRemoved(first, true);
+            if (first >= size)
+            {
+                return;
+            }
+
+            size_t last = first;
+            while (last < size && !removed_[last])
+            {
+                ++last;
+            }
+
+            if (!operation(data + first, last - first))
+            {
+                return;
+            }
+            first = last;
+        }
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::skipRemoved(size_t index, bool forward) const
+    {
+        // The step count bounds the walk around a cyclic sequence.
+        for (size_t steps = 0; removedCount_ > 0 && index < this->size() && removed_[index]; ++steps)
+        {
+            index = steps < this->size() ? (forward ? this->indexOfNext(index) : this->indexOfPrevious(index)) : INVALID_INDEX;
+        }
+
+        return index;
+    }
+
+    template<typename DataType>
+    void ImplicitSequence<DataType>::onInserted(size_t index)
+    {
+        if (removedCount_ > 0)
+        {
+            removed_.insert(removed_.begin() + static_cast<std::ptrdiff_t>(index), false);
+        }
+    }
+
+    template<typename DataType>
+    void ImplicitSequence<DataType>::onReleased(size_t index)
+    {
+        if (removedCount_ > 0)
+        {
+            if (removed_[index])
+            {
+                --removedCount_;
+            }
+
+            removed_.erase(removed_.begin() + static_cast<std::ptrdiff_t>(index));
+            if (removedCount_ == 0)
+            {
+                removed_.clear();
+            }
+        }
+    }
+
     template <typename DataType>
     ImplicitSequence<DataType>::ImplicitSequenceIterator::ImplicitSequenceIterator
             (ImplicitSequence<DataType>* sequence, size_t index) :
@@ -242,7 +681,12 @@ namespace ds::amt {
     template <typename DataType>
     typename ImplicitSequence<DataType>::ImplicitSequenceIterator& ImplicitSequence<DataType>::ImplicitSequenceIterator::operator++()
     {
-        ++position_;
+        do
+        {
+            ++position_;
+        }
+        while (position_ < sequence_->size() && sequence_->isRemoved(position_));
+
         return *this;
     }
 
@@ -275,7 +719,8 @@ namespace ds::amt {
     template <typename DataType>
     typename ImplicitSequence<DataType>::ImplicitSequenceIterator ImplicitSequence<DataType>::begin()
     {
-        return ImplicitSequenceIterator(this, 0);
+        const size_t first = this->skipRemoved(0, true);
+        return ImplicitSequenceIterator(this, first < this->size() ? first : this->size());
     }
 
     template <typename DataType>
@@ -284,6 +729,72 @@ namespace ds::amt {
         return ImplicitSequenceIterator(this, this->size());
     }
 
+    template <typename DataType>
+    ImplicitSequence<DataType>::ImplicitSequenceConstIterator::ImplicitSequenceConstIterator
+            (const ImplicitSequence<DataType>* sequence, size_t index) :
+            sequence_(sequence),
+            position_(index)
+    {
+    }
+
+    template <typename DataType>
+    ImplicitSequence<DataType>::ImplicitSequenceConstIterator::ImplicitSequenceConstIterator
+            (const ImplicitSequenceConstIterator& other) :
+            sequence_(other.sequence_), position_(other.position_)
+    {
+    }
+
+    template <typename DataType>
+    typename ImplicitSequence<DataType>::ImplicitSequenceConstIterator& ImplicitSequence<DataType>::ImplicitSequenceConstIterator::operator++()
+    {
+        do
+        {
+            ++position_;
+        }
+        while (position_ < sequence_->size() && sequence_->isRemoved(position_));
+
+        return *this;
+    }
+
+    template <typename DataType>
+    typename ImplicitSequence<DataType>::ImplicitSequenceConstIterator ImplicitSequence<DataType>::ImplicitSequenceConstIterator::operator++(int)
+    {
+        ImplicitSequenceConstIterator tmp(*this);
+        this->operator++();
+        return tmp;
+    }
+
+    template <typename DataType>
+    bool ImplicitSequence<DataType>::ImplicitSequenceConstIterator::operator==(const ImplicitSequenceConstIterator& other) const
+    {
+        return sequence_ == other.sequence_ && position_ == other.position_;
+    }
+
+    template <typename DataType>
+    bool ImplicitSequence<DataType>::ImplicitSequenceConstIterator::operator!=(const ImplicitSequenceConstIterator& other) const
+    {
+        return sequence_ != other.sequence_ || position_ != other.position_;
+    }
+
+    template <typename DataType>
+    const DataType& ImplicitSequence<DataType>::ImplicitSequenceConstIterator::operator*() const
+    {
+        return sequence_->read(position_)->data_;
+    }
+
+    template <typename DataType>
+    typename ImplicitSequence<DataType>::ImplicitSequenceConstIterator ImplicitSequence<DataType>::begin() const
+    {
+        const size_t first = this->skipRemoved(0, true);
+        return ImplicitSequenceConstIterator(this, first < this->size() ? first : this->size());
+    }
+
+    template <typename DataType>
+    typename ImplicitSequence<DataType>::ImplicitSequenceConstIterator ImplicitSequence<DataType>::end() const
+    {
+        return ImplicitSequenceConstIterator(this, this->size());
+    }
+
     template<typename DataType>
     CyclicImplicitSequence<DataType>::CyclicImplicitSequence():
             IS<DataType>()
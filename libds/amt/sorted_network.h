@@ -0,0 +1,350 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/amt/implicit_sequence.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ds::amt {
+
+	namespace details
+	{
+		/**
+		 *  @brief Open addressing set of pointers with linear probing, at most half full.
+		 *  Removal shifts the following blocks of a probe sequence back, so there are no tombstones.
+		 */
+		template<typename PointerType>
+		class PointerHashSet
+		{
+		public:
+			explicit PointerHashSet(size_t expectedSize);
+
+			size_t size() const;
+			bool contains(PointerType pointer) const;
+			bool insert(PointerType pointer);
+			bool remove(PointerType pointer);
+
+		private:
+			size_t homeOf(PointerType pointer) const;
+			size_t slotOf(PointerType pointer) const;
+			void rehash(size_t bits);
+
+			std::vector<PointerType> slots_;
+			size_t bits_;
+			size_t size_;
+		};
+	}
+
+	template<typename DataType>
+	struct NetworkBlockSortedRelations :
+		public MemoryBlock<DataType>
+	{
+		using RelationBlockType = typename ImplicitAMS<NetworkBlockSortedRelations<DataType>*>::BlockType;
+
+		NetworkBlockSortedRelations() : relations_(new IS<NetworkBlockSortedRelations<DataType>*>()), hashedRelations_(nullptr), gateIndex_(0) {}
+		~NetworkBlockSortedRelations() { delete relations_; relations_ = nullptr; delete hashedRelations_; hashedRelations_ = nullptr; }
+
+		IS<NetworkBlockSortedRelations<DataType>*>* relations_;
+		// Present only while the node has many relations.
+		details::PointerHashSet<const NetworkBlockSortedRelations<DataType>*>* hashedRelations_;
+		size_t gateIndex_;
+	};
+
+	template<typename DataType>
+	using SRNetworkBlock = NetworkBlockSortedRelations<DataType>;
+
+	//----------
+
+	/**
+	 *  @brief Network with an implicit gate whose relations of every node are sorted by addresses of the related nodes.
+	 *
+	 *  Relations form sets, so connecting related nodes again does nothing. Relations are found by binary search,
+	 *  nodes with at least HASH_THRESHOLD relations also keep them in a hash set, so relationExists takes O(1)
+	 *  if one of the nodes is such a node and O(log d) otherwise. connect and disconnect shift O(d) pointers
+	 *  of the sorted relations. The hash set is dropped when the degree falls below half of the threshold.
+	 */
+	template<typename DataType>
+	class ImplicitGateSortedRelationsNetwork :
+		public ExplicitNetwork<SRNetworkBlock<DataType>, IS<SRNetworkBlock<DataType>*>>
+	{
+	public:
+		using BlockType = SRNetworkBlock<DataType>;
+
+		static const size_t HASH_THRESHOLD = 64;
+
+		ImplicitGateSortedRelationsNetwork() = default;
+		ImplicitGateSortedRelationsNetwork(const ImplicitGateSortedRelationsNetwork<DataType>& other);
+
+		AMT& assign(const AMT& other) override;
+
+		bool relationExists(const BlockType& nodeA, const BlockType& nodeB) const override;
+
+		void connect(BlockType& nodeA, BlockType& nodeB) override;
+		void disconnect(BlockType& nodeA, BlockType& nodeB) override;
+
+	private:
+		// Position of the first relation of the node not ordered before the related node.
+		static size_t lowerBound(const BlockType& node, const BlockType* relatedNode);
+		static bool containsRelation(const BlockType& node, const BlockType* relatedNode);
+		static void insertRelation(BlockType& node, BlockType* relatedNode);
+		static void removeRelation(BlockType& node, BlockType* relatedNode);
+	};
+
+	template<typename DataType>
+	using IGSRNetwork = ImplicitGateSortedRelationsNetwork<DataType>;
+
+	//----------
+
+	namespace details
+	{
+		template<typename PointerType>
+		PointerHashSet<PointerType>::PointerHashSet(size_t expectedSize) :
+			slots_(),
+			bits_(1),
+			size_(0)
+		{
+			while ((size_t{ 1 } << bits_) < 2 * expectedSize)
+			{
+				++bits_;
+			}
+			slots_.assign(size_t{ 1 } << bits_, nullptr);
+		}
+
+		template<typename PointerType>
+		size_t PointerHashSet<PointerType>::size() const
+		{
+			return size_;
+		}
+
+		template<typename PointerType>
+		bool PointerHashSet<PointerType>::contains(PointerType pointer) const
+		{
+			return slots_[this->slotOf(pointer)] != nullptr;
+		}
+
+		template<typename PointerType>
+		bool PointerHashSet<PointerType>::insert(PointerType pointer)
+		{
+			if (2 * (size_ + 1) > slots_.size())
+			{
+				this->rehash(bits_ + 1);
+			}
+
+			const size_t slot = this->slotOf(pointer);
+			if (slots_[slot] != nullptr)
+			{
+				return false;
+			}
+
+			slots_[slot] = pointer;
+			++size_;
+			return true;
+		}
+
+		template<typename PointerType>
+		bool PointerHashSet<PointerType>::remove(PointerType pointer)
+		{
+			const size_t mask = slots_.size() - 1;
+			size_t hole = this->slotOf(pointer);
+			if (slots_[hole] == nullptr)
+			{
+				return false;
+			}
+
+			// A following pointer moves to the hole unless its home lies cyclically in (hole, slot].
+			for (size_t slot = (hole + 1) & mask; slots_[slot] != nullptr; slot = (slot + 1) & mask)
+			{
+				const size_t home = this->homeOf(slots_[slot]);
+				if (((slot - home) & mask) >= ((slot - hole) & mask))
+				{
+					slots_[hole] = slots_[slot];
+					hole = slot;
+				}
+			}
+			slots_[hole] = nullptr;
+			--size_;
+			return true;
+		}
+
+		template<typename PointerType>
+		size_t PointerHashSet<PointerType>::homeOf(PointerType pointer) const
+		{
+			return static_cast<size_t>((reinterpret_cast<std::uint64_t>(pointer) * 0x9E3779B97F4A7C15ull) >> (64 - bits_));
+		}
+
+		template<typename PointerType>
+		size_t PointerHashSet<PointerType>::slotOf(PointerType pointer) const
+		{
+			const size_t mask = slots_.size() - 1;
+			size_t slot = this->homeOf(pointer);
+			while (slots_[slot] != nullptr && slots_[slot] != pointer)
+			{
+				slot = (slot + 1) & mask;
+			}
+			return slot;
+		}
+
+		template<typename PointerType>
+		void PointerHashSet<PointerType>::rehash(size_t bits)
+		{
+			std::vector<PointerType> slots(size_t{ 1 } << bits, nullptr);
+			slots_.swap(slots);
+			bits_ = bits;
+			for (PointerType pointer : slots)
+			{
+				if (pointer != nullptr)
+				{
+					slots_[this->slotOf(pointer)] = pointer;
+				}
+			}
+		}
+	}
+
+	//----------
+
+	template<typename DataType>
+	ImplicitGateSortedRelationsNetwork<DataType>::ImplicitGateSortedRelationsNetwork(const ImplicitGateSortedRelationsNetwork<DataType>& other) :
+		ExplicitNetwork<SRNetworkBlock<DataType>, IS<SRNetworkBlock<DataType>*>>()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType>
+	AMT& ImplicitGateSortedRelationsNetwork<DataType>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+
+			// New nodes have differently ordered addresses, so relations are connected again instead of copied.
+			const ImplicitGateSortedRelationsNetwork<DataType>& otherNetwork = dynamic_cast<const ImplicitGateSortedRelationsNetwork<DataType>&>(other);
+			std::vector<BlockType*> nodes;
+			nodes.reserve(otherNetwork.size());
+			for (size_t i = 0; i < otherNetwork.size(); ++i)
+			{
+				nodes.push_back(&this->insert());
+				nodes.back()->data_ = otherNetwork.accessNodeFromGate(i)->data_;
+			}
+			for (size_t i = 0; i < otherNetwork.size(); ++i)
+			{
+				otherNetwork.accessNodeFromGate(i)->relations_->processAllBlocksForward([&](const typename BlockType::RelationBlockType* b)
+					{
+						if (i <= b->data_->gateIndex_)
+						{
+							this->connect(*nodes[i], *nodes[b->data_->gateIndex_]);
+						}
+					});
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename DataType>
+	bool ImplicitGateSortedRelationsNetwork<DataType>::relationExists(const BlockType& nodeA, const BlockType& nodeB) const
+	{
+		if (nodeA.hashedRelations_ != nullptr)
+		{
+			return nodeA.hashedRelations_->contains(&nodeB);
+		}
+		if (nodeB.hashedRelations_ != nullptr)
+		{
+			return nodeB.hashedRelations_->contains(&nodeA);
+		}
+
+		return this->degree(nodeA) <= this->degree(nodeB) ? containsRelation(nodeA, &nodeB) : containsRelation(nodeB, &nodeA);
+	}
+
+	template<typename DataType>
+	void ImplicitGateSortedRelationsNetwork<DataType>::connect(BlockType& nodeA, BlockType& nodeB)
+	{
+		if (!this->relationExists(nodeA, nodeB))
+		{
+			insertRelation(nodeA, &nodeB);
+			if (&nodeA != &nodeB)
+			{
+				insertRelation(nodeB, &nodeA);
+			}
+		}
+	}
+
+	template<typename DataType>
+	void ImplicitGateSortedRelationsNetwork<DataType>::disconnect(BlockType& nodeA, BlockType& nodeB)
+	{
+		if (this->relationExists(nodeA, nodeB))
+		{
+			removeRelation(nodeA, &nodeB);
+			if (&nodeA != &nodeB)
+			{
+				removeRelation(nodeB, &nodeA);
+			}
+		}
+	}
+
+	template<typename DataType>
+	size_t ImplicitGateSortedRelationsNetwork<DataType>::lowerBound(const BlockType& node, const BlockType* relatedNode)
+	{
+		const std::less<const BlockType*> less;
+		size_t first = 0;
+		size_t count = node.relations_->size();
+		while (count > 0)
+		{
+			const size_t half = count / 2;
+			if (less(node.relations_->read(first + half)->data_, relatedNode))
+			{
+				first += half + 1;
+				count -= half + 1;
+			}
+			else
+			{
+				count = half;
+			}
+		}
+		return first;
+	}
+
+	template<typename DataType>
+	bool ImplicitGateSortedRelationsNetwork<DataType>::containsRelation(const BlockType& node, const BlockType* relatedNode)
+	{
+		const size_t position = lowerBound(node, relatedNode);
+		return position < node.relations_->size() && node.relations_->read(position)->data_ == relatedNode;
+	}
+
+	template<typename DataType>
+	void ImplicitGateSortedRelationsNetwork<DataType>::insertRelation(BlockType& node, BlockType* relatedNode)
+	{
+		node.relations_->insert(lowerBound(node, relatedNode)).data_ = relatedNode;
+		if (node.hashedRelations_ != nullptr)
+		{
+			node.hashedRelations_->insert(relatedNode);
+		}
+		else if (node.relations_->size() >= HASH_THRESHOLD)
+		{
+			node.hashedRelations_ = new details::PointerHashSet<const BlockType*>(node.relations_->size());
+			node.relations_->processAllBlocksForward([&node](const typename BlockType::RelationBlockType* b)
+				{
+					node.hashedRelations_->insert(b->data_);
+				});
+		}
+	}
+
+	template<typename DataType>
+	void ImplicitGateSortedRelationsNetwork<DataType>::removeRelation(BlockType& node, BlockType* relatedNode)
+	{
+		node.relations_->remove(lowerBound(node, relatedNode));
+		if (node.hashedRelations_ != nullptr)
+		{
+			if (node.relations_->size() < HASH_THRESHOLD / 2)
+			{
+				delete node.hashedRelations_;
+				node.hashedRelations_ = nullptr;
+			}
+			else
+			{
+				node.hashedRelations_->remove(relatedNode);
+			}
+		}
+	}
+}
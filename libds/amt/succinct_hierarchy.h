@@ -0,0 +1,909 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/hierarchy.h>
+#include <libds/simd.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ds::amt {
+
+    namespace details
+    {
+        /**
+         *  @brief Excess profile of one byte of balanced parentheses, bits read from the lowest one.
+         *  minExcess_ is the minimum of the excess after each of the eight bits, minCount_ counts its occurrences.
+         */
+        struct ParenthesesByte
+        {
+            std::int8_t total_;
+            std::int8_t minExcess_;
+            std::uint8_t minCount_;
+        };
+
+        constexpr std::array<ParenthesesByte, 256> makeParenthesesBytes()
+        {
+            std::array<ParenthesesByte, 256> bytes {};
+            for (size_t value = 0; value < 256; ++value)
+            {
+                int excess = 0;
+                int minExcess = 9;
+                int minCount = 0;
+                for (size_t bit = 0; bit < 8; ++bit)
+                {
+                    excess += ((value >> bit) & 1) != 0 ? 1 : -1;
+                    if (excess < minExcess)
+                    {
+                        minExcess = excess;
+                        minCount = 1;
+                    }
+                    else if (excess == minExcess)
+                    {
+                        ++minCount;
+                    }
+                }
+                bytes[value] = {
+                    static_cast<std::int8_t>(excess),
+                    static_cast<std::int8_t>(minExcess),
+                    static_cast<std::uint8_t>(minCount)
+                };
+            }
+            return bytes;
+        }
+
+        inline constexpr std::array<ParenthesesByte, 256> PARENTHESES_BYTES = makeParenthesesBytes();
+    }
+
+    /**
+     *  @brief Read-only hierarchy storing its shape as balanced parentheses and its data in pre-order.
+     *
+     *  Every node is an opening parenthesis (bit 1) followed by its sons and a closing parenthesis (bit 0).
+     *  The i-th node in pre-order is the i-th block of the data array and the i-th opening parenthesis,
+     *  so nodes are mapped to positions by select and back by rank. The excess (opened minus closed
+     *  parentheses) is O(1) from rank; the closing parenthesis of a node and the opening parenthesis
+     *  of its parent are found by a range min-max tree over blocks of 512 bits, which also counts the sons.
+     *  Parent, degree and nodeCount(node) take O(log n), the k-th son O(k log n), a traversal O(n log n).
+     *
+     *  The shape takes 2n bits, the rank directory and the min-max tree add about n bits more.
+     *  Everything, data included, lies in one flat image without pointers, which may be written out
+     *  and later used in place, e.g. from a memory-mapped file. DataType must thus be trivially copyable.
+     *  Data of a mapped image may be changed through the hierarchy only if the image is writable.
+     */
+    template<typename DataType>
+    class SuccinctHierarchy :
+            virtual public Hierarchy<MemoryBlock<DataType>>
+    {
+    public:
+        using BlockType = MemoryBlock<DataType>;
+
+        SuccinctHierarchy();
+        template<typename SourceBlockType>
+        explicit SuccinctHierarchy(const Hierarchy<SourceBlockType>& source);
+        // Uses the image in place, it must stay valid and 8-byte aligned during the life of the hierarchy.
+        // The header, the parentheses and the directory are checked in O(n), the data is used as it is.
+        // An image written with another byte order fails the check of its magic number.
+        SuccinctHierarchy(void* image, size_t imageSize); // throw(std::invalid_argument)
+        SuccinctHierarchy(const SuccinctHierarchy<DataType>& other);
+
+        AMT& assign(const AMT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+        bool equals(const AMT& other) override;
+
+        size_t level(const BlockType& node) const override;
+        size_t degree(const BlockType& node) const override;
+        size_t nodeCount() const override;
+        size_t nodeCount(const BlockType& node) const override;
+        bool isLeaf(const BlockType& node) const override;
+
+        BlockType* accessRoot() const override;
+        BlockType* accessParent(const BlockType& node) const override;
+        BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
+
+        BlockType& emplaceRoot() override; // throw(unavailable_function_call)
+        void changeRoot(BlockType* newRoot) override; // throw(unavailable_function_call)
+
+        BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override; // throw(unavailable_function_call)
+        void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override; // throw(unavailable_function_call)
+        void removeSon(BlockType& parent, size_t sonOrder) override; // throw(unavailable_function_call)
+
+        const void* getImage() const;
+        size_t getImageSize() const;
+        void writeImage(std::ostream& output) const;
+        bool ownsImage() const;
+
+    protected:
+        using TraversalFrame = typename Hierarchy<BlockType>::TraversalFrame;
+
+        // The frame keeps the position of the next son in nextSonOrder_.
+        TraversalFrame makeTraversalFrame(BlockType* node) const override;
+        BlockType* accessNextSon(TraversalFrame& frame) const override;
+        BlockType* accessSonAfter(const BlockType& node, const BlockType* son, size_t& sonOrder, size_t visitedSonCount) const override;
+
+    private:
+        static_assert(std::is_trivially_copyable_v<DataType>, "Data of a succinct hierarchy must be trivially copyable!");
+        static_assert(alignof(BlockType) <= alignof(std::uint64_t), "Data of a succinct hierarchy must be at most 8-byte aligned!");
+
+        /**
+         *  @brief Offsets of the parts of an image in 64-bit words.
+         *  The min-max tree is a complete binary tree with leafCount_ leaves stored from index 1,
+         *  minimal excesses are relative to the excess before the first position of a tree node.
+         */
+        struct Layout
+        {
+            size_t bitWordCount_;
+            size_t blockCount_;
+            size_t leafCount_;
+            size_t ranksOffset_;
+            size_t minExcessesOffset_;
+            size_t minCountsOffset_;
+            size_t dataOffset_;
+            size_t wordCount_;
+        };
+
+        static Layout makeLayout(size_t count);
+
+        void build(const std::vector<std::uint64_t>& bits, const std::vector<DataType>& data);
+        void attach(std::uint64_t* image);
+        // Writes the rank directory and the min-max tree of the attached parentheses, zeroed words are expected.
+        void computeDirectory(std::uint64_t* directory) const;
+        // Whether the attached parentheses enclose a single tree and the bits after them are zero.
+        bool hasValidShape() const;
+
+        size_t positionOf(const BlockType& node) const;
+        BlockType* blockAt(size_t position) const;
+
+        bool isOpen(size_t position) const;
+        unsigned byteAt(size_t position) const;
+        size_t rank(size_t end) const;
+        size_t select(size_t index) const;
+        long long excessBefore(size_t position) const;
+        size_t firstPositionOf(size_t treeNode) const;
+        bool reaches(size_t treeNode, long long target) const;
+
+        size_t findClose(size_t position) const;
+        size_t forwardSearch(size_t position, long long target) const;
+        size_t backwardSearch(size_t position, long long target) const;
+        bool scanForward(size_t& position, size_t end, long long& excess, long long target) const;
+        bool scanBackward(size_t& position, size_t start, long long& excess, long long target) const;
+        size_t countMinima(size_t first, size_t end, long long minimum) const;
+        void profile(size_t first, size_t end, long long& total, long long& minExcess, size_t& minCount) const;
+
+        static const std::uint64_t IMAGE_MAGIC = 0x31485053'50424453ULL;
+        static const size_t HEADER_WORDS = 4;
+        static const size_t BLOCK_BITS = 512;
+        static const size_t BLOCK_WORDS = BLOCK_BITS / 64;
+        static const size_t MAX_COUNT = static_cast<size_t>(1) << 30;
+
+        // Owned image, empty for an image used in place.
+        std::vector<std::uint64_t> storage_;
+        std::uint64_t* image_;
+        size_t imageWordCount_;
+
+        size_t count_;
+        size_t bitCount_;
+        size_t blockCount_;
+        size_t leafCount_;
+        size_t leafLevel_;
+        const std::uint64_t* bits_;
+        const std::uint64_t* ranks_;
+        const std::int32_t* minExcesses_;
+        const std::uint32_t* minCounts_;
+        BlockType* data_;
+    };
+
+    template<typename DataType>
+    using SuccinctH = SuccinctHierarchy<DataType>;
+
+    //----------
+
+    template<typename DataType>
+    SuccinctHierarchy<DataType>::SuccinctHierarchy()
+    {
+        this->build({}, {});
+    }
+
+    template<typename DataType>
+    template<typename SourceBlockType>
+    SuccinctHierarchy<DataType>::SuccinctHierarchy(const Hierarchy<SourceBlockType>& source)
+    {
+        std::vector<std::uint64_t> bits;
+        std::vector<DataType> data;
+        size_t bitCount = 0;
+        auto push = [&bits, &bitCount](bool open)
+            {
+                if (bitCount % 64 == 0)
+                {
+                    bits.push_back(0);
+                }
+                if (open)
+                {
+                    bits.back() |= static_cast<std::uint64_t>(1) << (bitCount % 64);
+                }
+                ++bitCount;
+            };
+
+        // Sub-hierarchies left since the previous node are closed before the node is opened.
+        std::vector<const SourceBlockType*> path;
+        source.processPreOrder(source.accessRoot(), [&](const SourceBlockType* b)
+            {
+                if (data.size() == MAX_COUNT)
+                {
+                    throw std::length_error("Hierarchy is too large for a succinct hierarchy!");
+                }
+
+                const SourceBlockType* parent = source.accessParent(*b);
+                while (!path.empty() && path.back() != parent)
+                {
+                    path.pop_back();
+                    push(false);
+                }
+                push(true);
+                path.push_back(b);
+                data.push_back(b->data_);
+            });
+        for (; !path.empty(); path.pop_back())
+        {
+            push(false);
+        }
+
+        this->build(bits, data);
+    }
+
+    template<typename DataType>
+    SuccinctHierarchy<DataType>::SuccinctHierarchy(void* image, size_t imageSize)
+    {
+        std::uint64_t* words = static_cast<std::uint64_t*>(image);
+        if (image == nullptr || reinterpret_cast<std::uintptr_t>(image) % alignof(std::uint64_t) != 0 ||
+            imageSize < HEADER_WORDS * sizeof(std::uint64_t) ||
+            words[0] != IMAGE_MAGIC || words[1] > MAX_COUNT || words[2] != sizeof(BlockType) || words[3] != 0 ||
+            makeLayout(words[1]).wordCount_ * sizeof(std::uint64_t) > imageSize)
+        {
+            throw std::invalid_argument("Invalid succinct hierarchy image!");
+        }
+
+        this->attach(words);
+        const Layout layout = makeLayout(count_);
+        std::vector<std::uint64_t> directory(layout.dataOffset_ - layout.ranksOffset_, 0);
+        this->computeDirectory(directory.data());
+        if (!this->hasValidShape() || !std::equal(directory.begin(), directory.end(), words + layout.ranksOffset_))
+        {
+            throw std::invalid_argument("Invalid succinct hierarchy image!");
+        }
+    }
+
+    template<typename DataType>
+    SuccinctHierarchy<DataType>::SuccinctHierarchy(const SuccinctHierarchy<DataType>& other) :
+            storage_(other.image_, other.image_ + other.imageWordCount_)
+    {
+        this->attach(storage_.data());
+    }
+
+    template<typename DataType>
+    AMT& SuccinctHierarchy<DataType>::assign(const AMT& other)
+    {
+        if (this != &other)
+        {
+            const SuccinctHierarchy<DataType>& otherHierarchy = dynamic_cast<const SuccinctHierarchy<DataType>&>(other);
+            storage_.assign(otherHierarchy.image_, otherHierarchy.image_ + otherHierarchy.imageWordCount_);
+            this->attach(storage_.data());
+        }
+
+        return *this;
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::clear()
+    {
+        this->build({}, {});
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::size() const
+    {
+        return count_;
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::isEmpty() const
+    {
+        return count_ == 0;
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::equals(const AMT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const SuccinctHierarchy<DataType>* otherHierarchy = dynamic_cast<const SuccinctHierarchy<DataType>*>(&other);
+        return otherHierarchy != nullptr && count_ == otherHierarchy->count_ &&
+               std::memcmp(bits_, otherHierarchy->bits_, makeLayout(count_).bitWordCount_ * sizeof(std::uint64_t)) == 0 &&
+               std::memcmp(data_, otherHierarchy->data_, count_ * sizeof(BlockType)) == 0;
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::level(const BlockType& node) const
+    {
+        return static_cast<size_t>(this->excessBefore(this->positionOf(node)));
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::degree(const BlockType& node) const
+    {
+        const size_t position = this->positionOf(node);
+        if (!this->isOpen(position + 1))
+        {
+            return 0;
+        }
+
+        // Every son ends with a closing parenthesis returning the excess to the one after the opening of the node,
+        // which is the minimum between the opening and the closing of the node.
+        return this->countMinima(position + 1, this->findClose(position), this->excessBefore(position) + 1);
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::nodeCount() const
+    {
+        return count_;
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::nodeCount(const BlockType& node) const
+    {
+        const size_t position = this->positionOf(node);
+        return (this->findClose(position) - position + 1) / 2;
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::isLeaf(const BlockType& node) const
+    {
+        return !this->isOpen(this->positionOf(node) + 1);
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::accessRoot() const -> BlockType*
+    {
+        return count_ > 0 ? data_ : nullptr;
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::accessParent(const BlockType& node) const -> BlockType*
+    {
+        const size_t position = this->positionOf(node);
+        if (position == 0)
+        {
+            return nullptr;
+        }
+
+        // The parent is opened right after the last position with the excess one below the level of the node.
+        return this->blockAt(this->backwardSearch(position, this->excessBefore(position) - 1));
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+    {
+        size_t position = this->positionOf(node) + 1;
+        for (; sonOrder > 0; --sonOrder)
+        {
+            if (!this->isOpen(position))
+            {
+                return nullptr;
+            }
+            position = this->findClose(position) + 1;
+        }
+        return this->isOpen(position) ? this->blockAt(position) : nullptr;
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::emplaceRoot() -> BlockType&
+    {
+        throw unavailable_function_call("Method emplaceRoot() unavailable in succinct hierarchies!");
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::changeRoot(BlockType*)
+    {
+        throw unavailable_function_call("Method changeRoot() unavailable in succinct hierarchies!");
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::emplaceSon(BlockType&, size_t) -> BlockType&
+    {
+        throw unavailable_function_call("Method emplaceSon() unavailable in succinct hierarchies!");
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::changeSon(BlockType&, size_t, BlockType*)
+    {
+        throw unavailable_function_call("Method changeSon() unavailable in succinct hierarchies!");
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::removeSon(BlockType&, size_t)
+    {
+        throw unavailable_function_call("Method removeSon() unavailable in succinct hierarchies!");
+    }
+
+    template<typename DataType>
+    const void* SuccinctHierarchy<DataType>::getImage() const
+    {
+        return image_;
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::getImageSize() const
+    {
+        return imageWordCount_ * sizeof(std::uint64_t);
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::writeImage(std::ostream& output) const
+    {
+        output.write(reinterpret_cast<const char*>(image_), static_cast<std::streamsize>(this->getImageSize()));
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::ownsImage() const
+    {
+        return image_ == storage_.data();
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::makeTraversalFrame(BlockType* node) const -> TraversalFrame
+    {
+        const size_t firstSon = this->positionOf(*node) + 1;
+        return { node, this->isOpen(firstSon) ? firstSon : INVALID_INDEX, 0, nullptr };
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::accessNextSon(TraversalFrame& frame) const -> BlockType*
+    {
+        const size_t position = frame.nextSonOrder_;
+        if (position == INVALID_INDEX)
+        {
+            return nullptr;
+        }
+
+        const size_t nextPosition = this->findClose(position) + 1;
+        frame.nextSonOrder_ = this->isOpen(nextPosition) ? nextPosition : INVALID_INDEX;
+        return this->blockAt(position);
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::accessSonAfter(const BlockType& node, const BlockType* son, size_t& sonOrder, size_t) const -> BlockType*
+    {
+        const size_t position = son != nullptr
+            ? this->findClose(this->positionOf(*son)) + 1
+            : this->positionOf(node) + 1;
+        if (!this->isOpen(position))
+        {
+            return nullptr;
+        }
+
+        ++sonOrder;
+        return this->blockAt(position);
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::makeLayout(size_t count) -> Layout
+    {
+        Layout layout;
+        layout.bitWordCount_ = (2 * count + 63) / 64;
+        layout.blockCount_ = (layout.bitWordCount_ + BLOCK_WORDS - 1) / BLOCK_WORDS;
+        layout.leafCount_ = 1;
+        while (layout.leafCount_ < layout.blockCount_)
+        {
+            layout.leafCount_ *= 2;
+        }
+        // Both arrays of the min-max tree hold 2 * leafCount_ 32-bit values.
+        layout.ranksOffset_ = HEADER_WORDS + layout.bitWordCount_;
+        layout.minExcessesOffset_ = layout.ranksOffset_ + layout.blockCount_ + 1;
+        layout.minCountsOffset_ = layout.minExcessesOffset_ + layout.leafCount_;
+        layout.dataOffset_ = layout.minCountsOffset_ + layout.leafCount_;
+        layout.wordCount_ = layout.dataOffset_ + (count * sizeof(BlockType) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+        return layout;
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::build(const std::vector<std::uint64_t>& bits, const std::vector<DataType>& data)
+    {
+        const size_t count = data.size();
+        const Layout layout = makeLayout(count);
+        storage_.assign(layout.wordCount_, 0);
+        storage_[0] = IMAGE_MAGIC;
+        storage_[1] = count;
+        storage_[2] = sizeof(BlockType);
+        std::copy(bits.begin(), bits.end(), storage_.begin() + HEADER_WORDS);
+
+        BlockType* blocks = reinterpret_cast<BlockType*>(storage_.data() + layout.dataOffset_);
+        for (size_t i = 0; i < count; ++i)
+        {
+            new (blocks + i) BlockType { data[i] };
+        }
+
+        this->attach(storage_.data());
+        this->computeDirectory(storage_.data() + layout.ranksOffset_);
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::attach(std::uint64_t* image)
+    {
+        const Layout layout = makeLayout(image[1]);
+        image_ = image;
+        imageWordCount_ = layout.wordCount_;
+        count_ = image[1];
+        bitCount_ = 2 * count_;
+        blockCount_ = layout.blockCount_;
+        leafCount_ = layout.leafCount_;
+        leafLevel_ = simd::scalar::floorLog2(leafCount_);
+        bits_ = image + HEADER_WORDS;
+        ranks_ = image + layout.ranksOffset_;
+        minExcesses_ = reinterpret_cast<const std::int32_t*>(image + layout.minExcessesOffset_);
+        minCounts_ = reinterpret_cast<const std::uint32_t*>(image + layout.minCountsOffset_);
+        data_ = reinterpret_cast<BlockType*>(image + layout.dataOffset_);
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::computeDirectory(std::uint64_t* directory) const
+    {
+        std::uint64_t* ranks = directory;
+        for (size_t block = 0; block < blockCount_; ++block)
+        {
+            ranks[block + 1] = ranks[block];
+            for (size_t word = block * BLOCK_WORDS; word < std::min((block + 1) * BLOCK_WORDS, (bitCount_ + 63) / 64); ++word)
+            {
+                ranks[block + 1] += simd::scalar::popcount(bits_[word]);
+            }
+        }
+
+        // Profiles of the blocks are merged bottom-up, leaves beyond the last block never reach any excess.
+        const long long unreachable = std::numeric_limits<std::int32_t>::max();
+        std::vector<long long> totals(2 * leafCount_, 0);
+        std::vector<long long> minExcesses(2 * leafCount_, unreachable);
+        std::vector<size_t> minCounts(2 * leafCount_, 0);
+        for (size_t block = 0; block < blockCount_; ++block)
+        {
+            const size_t node = leafCount_ + block;
+            this->profile(block * BLOCK_BITS, std::min((block + 1) * BLOCK_BITS, bitCount_), totals[node], minExcesses[node], minCounts[node]);
+        }
+        for (size_t node = leafCount_ - 1; node > 0; --node)
+        {
+            const size_t left = 2 * node;
+            const size_t right = left + 1;
+            const long long rightMinExcess = minExcesses[right] == unreachable ? unreachable : totals[left] + minExcesses[right];
+            totals[node] = totals[left] + totals[right];
+            minExcesses[node] = std::min(minExcesses[left], rightMinExcess);
+            minCounts[node] = (minExcesses[left] == minExcesses[node] ? minCounts[left] : 0) +
+                              (rightMinExcess == minExcesses[node] ? minCounts[right] : 0);
+        }
+
+        std::int32_t* treeMinExcesses = reinterpret_cast<std::int32_t*>(directory + blockCount_ + 1);
+        std::uint32_t* treeMinCounts = reinterpret_cast<std::uint32_t*>(directory + blockCount_ + 1 + leafCount_);
+        for (size_t node = 1; node < 2 * leafCount_; ++node)
+        {
+            treeMinExcesses[node] = static_cast<std::int32_t>(minExcesses[node]);
+            treeMinCounts[node] = static_cast<std::uint32_t>(minCounts[node]);
+        }
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::hasValidShape() const
+    {
+        // Only the closing parenthesis of the root returns the excess to zero.
+        long long excess = 0;
+        for (size_t position = 0; position < bitCount_; ++position)
+        {
+            excess += this->isOpen(position) ? 1 : -1;
+            if (excess < (position + 1 < bitCount_ ? 1 : 0))
+            {
+                return false;
+            }
+        }
+
+        return excess == 0 && (bitCount_ % 64 == 0 || (bits_[bitCount_ / 64] >> (bitCount_ % 64)) == 0);
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::positionOf(const BlockType& node) const
+    {
+        return this->select(static_cast<size_t>(&node - data_));
+    }
+
+    template<typename DataType>
+    auto SuccinctHierarchy<DataType>::blockAt(size_t position) const -> BlockType*
+    {
+        return data_ + this->rank(position);
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::isOpen(size_t position) const
+    {
+        return position < bitCount_ && ((bits_[position / 64] >> (position % 64)) & 1) != 0;
+    }
+
+    template<typename DataType>
+    unsigned SuccinctHierarchy<DataType>::byteAt(size_t position) const
+    {
+        return static_cast<unsigned>((bits_[position / 64] >> (position % 64)) & 0xFF);
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::rank(size_t end) const
+    {
+        const size_t lastWord = end / 64;
+        size_t result = ranks_[end / BLOCK_BITS];
+        for (size_t word = end / BLOCK_BITS * BLOCK_WORDS; word < lastWord; ++word)
+        {
+            result += simd::scalar::popcount(bits_[word]);
+        }
+        if (end % 64 != 0)
+        {
+            result += simd::scalar::popcount(bits_[lastWord] & ((static_cast<std::uint64_t>(1) << (end % 64)) - 1));
+        }
+        return result;
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::select(size_t index) const
+    {
+        // The last block with at most index opening parentheses before it contains the wanted one.
+        const size_t block = static_cast<size_t>(std::upper_bound(ranks_, ranks_ + blockCount_, index) - ranks_) - 1;
+        size_t remaining = index - ranks_[block];
+        size_t word = block * BLOCK_WORDS;
+        for (size_t wordCount = simd::scalar::popcount(bits_[word]); remaining >= wordCount; wordCount = simd::scalar::popcount(bits_[word]))
+        {
+            remaining -= wordCount;
+            ++word;
+        }
+
+        std::uint64_t bits = bits_[word];
+        for (; remaining > 0; --remaining)
+        {
+            bits &= bits - 1;
+        }
+        return word * 64 + simd::scalar::countTrailingZeros(bits);
+    }
+
+    template<typename DataType>
+    long long SuccinctHierarchy<DataType>::excessBefore(size_t position) const
+    {
+        return 2 * static_cast<long long>(this->rank(position)) - static_cast<long long>(position);
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::firstPositionOf(size_t treeNode) const
+    {
+        return ((treeNode << (leafLevel_ - simd::scalar::floorLog2(treeNode))) - leafCount_) * BLOCK_BITS;
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::reaches(size_t treeNode, long long target) const
+    {
+        const size_t first = this->firstPositionOf(treeNode);
+        return first < bitCount_ && this->excessBefore(first) + minExcesses_[treeNode] <= target;
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::findClose(size_t position) const
+    {
+        return this->forwardSearch(position, this->excessBefore(position));
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::forwardSearch(size_t position, long long target) const
+    {
+        // Returns the first position after the given one with the excess (after it) equal to the target,
+        // which is below the excess after the given position, or INVALID_INDEX.
+        const size_t startBlock = position / BLOCK_BITS;
+        long long excess = this->excessBefore(position + 1);
+        ++position;
+        if (this->scanForward(position, std::min((startBlock + 1) * BLOCK_BITS, bitCount_), excess, target))
+        {
+            return position;
+        }
+
+        // Climbs to the nearest following tree node reaching the target, then descends to its first block reaching it.
+        size_t node = leafCount_ + startBlock;
+        for (; node != 1 && (node % 2 == 1 || !this->reaches(node + 1, target)); node /= 2)
+        {
+        }
+        if (node == 1)
+        {
+            return INVALID_INDEX;
+        }
+        for (++node; node < leafCount_; node = this->reaches(2 * node, target) ? 2 * node : 2 * node + 1)
+        {
+        }
+
+        position = (node - leafCount_) * BLOCK_BITS;
+        excess = this->excessBefore(position);
+        this->scanForward(position, std::min(position + BLOCK_BITS, bitCount_), excess, target);
+        return position;
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::backwardSearch(size_t position, long long target) const
+    {
+        // Returns the position after the last position before the given one with the excess (after it) equal to the target,
+        // which is below the excess before the given position, or INVALID_INDEX. The excess before position 0 is 0.
+        const size_t startBlock = (position - 1) / BLOCK_BITS;
+        long long excess = this->excessBefore(position);
+        if (this->scanBackward(position, startBlock * BLOCK_BITS, excess, target))
+        {
+            return position;
+        }
+
+        // Climbs to the nearest preceding tree node reaching the target, then descends to its last block reaching it.
+        size_t node = leafCount_ + startBlock;
+        for (; node != 1 && (node % 2 == 0 || !this->reaches(node - 1, target)); node /= 2)
+        {
+        }
+        if (node == 1)
+        {
+            return target == 0 ? 0 : INVALID_INDEX;
+        }
+        for (--node; node < leafCount_; node = this->reaches(2 * node + 1, target) ? 2 * node + 1 : 2 * node)
+        {
+        }
+
+        const size_t start = (node - leafCount_) * BLOCK_BITS;
+        position = std::min(start + BLOCK_BITS, bitCount_);
+        excess = this->excessBefore(position);
+        this->scanBackward(position, start, excess, target);
+        return position;
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::scanForward(size_t& position, size_t end, long long& excess, long long target) const
+    {
+        // The excess is the one before the position and moves by one, so it hits the target before it gets below it.
+        while (position < end)
+        {
+            if (position % 8 == 0 && position + 8 <= end)
+            {
+                const details::ParenthesesByte& byte = details::PARENTHESES_BYTES[this->byteAt(position)];
+                if (excess + byte.minExcess_ > target)
+                {
+                    excess += byte.total_;
+                    position += 8;
+                    continue;
+                }
+            }
+
+            excess += this->isOpen(position) ? 1 : -1;
+            if (excess == target)
+            {
+                return true;
+            }
+            ++position;
+        }
+        return false;
+    }
+
+    template<typename DataType>
+    bool SuccinctHierarchy<DataType>::scanBackward(size_t& position, size_t start, long long& excess, long long target) const
+    {
+        // The excess is the one before the position, i.e. after the candidate position - 1.
+        while (position > start)
+        {
+            if (position % 8 == 0 && position - 8 >= start)
+            {
+                const details::ParenthesesByte& byte = details::PARENTHESES_BYTES[this->byteAt(position - 8)];
+                const long long excessBeforeByte = excess - byte.total_;
+                if (excessBeforeByte + byte.minExcess_ > target)
+                {
+                    excess = excessBeforeByte;
+                    position -= 8;
+                    continue;
+                }
+            }
+
+            if (excess == target)
+            {
+                return true;
+            }
+            excess -= this->isOpen(position - 1) ? 1 : -1;
+            --position;
+        }
+        return false;
+    }
+
+    template<typename DataType>
+    size_t SuccinctHierarchy<DataType>::countMinima(size_t first, size_t end, long long minimum) const
+    {
+        // Counts positions in [first, end) with the excess equal to the minimum of the range.
+        // Partial blocks at both ends are profiled, whole blocks between them are covered by tree nodes.
+        size_t result = 0;
+        auto countProfile = [this, minimum, &result](size_t from, size_t to)
+            {
+                if (from < to)
+                {
+                    long long total;
+                    long long minExcess;
+                    size_t minCount;
+                    this->profile(from, to, total, minExcess, minCount);
+                    result += this->excessBefore(from) + minExcess == minimum ? minCount : 0;
+                }
+            };
+
+        const size_t firstBlock = (first + BLOCK_BITS - 1) / BLOCK_BITS;
+        const size_t endBlock = end / BLOCK_BITS;
+        if (firstBlock >= endBlock)
+        {
+            countProfile(first, end);
+            return result;
+        }
+
+        auto countNode = [this, minimum, &result](size_t node)
+            {
+                if (this->excessBefore(this->firstPositionOf(node)) + minExcesses_[node] == minimum)
+                {
+                    result += minCounts_[node];
+                }
+            };
+
+        countProfile(first, firstBlock * BLOCK_BITS);
+        for (size_t left = leafCount_ + firstBlock, right = leafCount_ + endBlock; left < right; left /= 2, right /= 2)
+        {
+            if (left % 2 == 1)
+            {
+                countNode(left++);
+            }
+            if (right % 2 == 1)
+            {
+                countNode(--right);
+            }
+        }
+        countProfile(endBlock * BLOCK_BITS, end);
+        return result;
+    }
+
+    template<typename DataType>
+    void SuccinctHierarchy<DataType>::profile(size_t first, size_t end, long long& total, long long& minExcess, size_t& minCount) const
+    {
+        total = 0;
+        minExcess = std::numeric_limits<std::int32_t>::max();
+        minCount = 0;
+        auto merge = [&minExcess, &minCount](long long excess, size_t count)
+            {
+                if (excess < minExcess)
+                {
+                    minExcess = excess;
+                    minCount = count;
+                }
+                else if (excess == minExcess)
+                {
+                    minCount += count;
+                }
+            };
+
+        for (size_t position = first; position < end;)
+        {
+            if (position % 8 == 0 && position + 8 <= end)
+            {
+                const details::ParenthesesByte& byte = details::PARENTHESES_BYTES[this->byteAt(position)];
+                merge(total + byte.minExcess_, byte.minCount_);
+                total += byte.total_;
+                position += 8;
+            }
+            else
+            {
+                total += this->isOpen(position) ? 1 : -1;
+                merge(total, 1);
+                ++position;
+            }
+        }
+    }
+}
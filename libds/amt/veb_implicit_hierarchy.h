@@ -0,0 +1,526 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/hierarchy.h>
+#include <libds/amt/implicit_hierarchy.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace ds::amt {
+
+    namespace details
+    {
+        /**
+         *  @brief Split of a complete binary tree of a given height into the top tree and the bottom trees.
+         */
+        struct VebSplit
+        {
+            size_t topHeight_;
+            size_t topSize_;
+            size_t bottomSize_;
+        };
+
+        const size_t VEB_MAX_HEIGHT = 63;
+
+        constexpr std::array<VebSplit, VEB_MAX_HEIGHT + 1> makeVebSplits()
+        {
+            std::array<VebSplit, VEB_MAX_HEIGHT + 1> splits {};
+            for (size_t height = 2; height <= VEB_MAX_HEIGHT; ++height)
+            {
+                const size_t topHeight = height / 2;
+                const size_t bottomHeight = height - topHeight;
+                splits[height] = {
+                    topHeight,
+                    (static_cast<size_t>(1) << topHeight) - 1,
+                    (static_cast<size_t>(1) << bottomHeight) - 1
+                };
+            }
+            return splits;
+        }
+
+        inline constexpr std::array<VebSplit, VEB_MAX_HEIGHT + 1> VEB_SPLITS = makeVebSplits();
+
+        /**
+         *  @brief Placement of the nodes of one depth relative to the top tree above them.
+         *  A node at this depth is the root of a bottom tree; the enclosing top tree is rooted
+         *  at topRootDepth_, has topSize_ nodes, and is followed by bottom trees of bottomSize_ nodes.
+         */
+        struct VebLevel
+        {
+            size_t topRootDepth_;
+            size_t topSize_;
+            size_t bottomSize_;
+        };
+    }
+
+    /**
+     *  @brief Complete binary hierarchy stored in the van Emde Boas layout.
+     *
+     *  Nodes are identified by their breadth-first (BFS) index, exactly as in ImplicitHierarchy<DataType, 2>,
+     *  but they are stored recursively: the top half of the levels first, then every bottom subtree
+     *  as one contiguous block. A root-to-leaf walk thus touches O(log_B n) cache lines for any block size B.
+     *  Positions are computed from per-depth tables: a PathWalker descending from the root
+     *  finds the position of a son in O(1), while random access by BFS index or by node
+     *  takes one step per recursion level, i.e. at most six steps for any addressable tree.
+     *  The layout is rebuilt when the height of the hierarchy changes, which happens
+     *  when the size doubles or drops below a quarter.
+     */
+    template<typename DataType>
+    class VebImplicitHierarchy :
+            virtual public KWayHierarchy<MemoryBlock<DataType>, 2>,
+            public ImplicitAMS<DataType>
+    {
+    public:
+        VebImplicitHierarchy();
+        VebImplicitHierarchy(const VebImplicitHierarchy<DataType>& other);
+        ~VebImplicitHierarchy() override;
+
+        AMT& assign(const AMT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+        bool equals(const AMT& other) override;
+
+        size_t level(const MemoryBlock<DataType>& node) const override;
+        size_t degree(const MemoryBlock<DataType>& node) const override;
+        size_t degree(size_t index) const;
+        using Hierarchy<MemoryBlock<DataType>>::nodeCount;
+        size_t nodeCount(const MemoryBlock<DataType>& node) const override;
+
+        MemoryBlock<DataType>* accessRoot() const override;
+        MemoryBlock<DataType>* accessParent(const MemoryBlock<DataType>& node) const override;
+        MemoryBlock<DataType>* accessSon(const MemoryBlock<DataType>& node, size_t sonOrder) const override;
+        MemoryBlock<DataType>* accessLastLeaf() const;
+        MemoryBlock<DataType>* access(size_t index) const;
+
+        MemoryBlock<DataType>& emplaceRoot() override; // throw(unavailable_function_call)
+        void changeRoot(MemoryBlock<DataType>* newRoot) override; // throw(unavailable_function_call)
+
+        MemoryBlock<DataType>& emplaceSon(MemoryBlock<DataType>& parent, size_t sonOrder) override; // throw(unavailable_function_call)
+        void changeSon(MemoryBlock<DataType>& parent, size_t sonOrder, MemoryBlock<DataType>* newSon) override; // throw(unavailable_function_call)
+        void removeSon(MemoryBlock<DataType>& parent, size_t sonOrder) override; // throw(unavailable_function_call)
+
+        MemoryBlock<DataType>& insertLastLeaf();
+        void removeLastLeaf();
+
+        size_t indexOf(const MemoryBlock<DataType>& node) const;
+        size_t positionOf(size_t index) const;
+        size_t getHeight() const;
+
+        /**
+         *  @brief Cursor moving along a path from the root, remembering positions of all ancestors.
+         *  It must not be used after the hierarchy changes its height.
+         */
+        class PathWalker
+        {
+        public:
+            explicit PathWalker(const VebImplicitHierarchy<DataType>& hierarchy);
+
+            MemoryBlock<DataType>* accessCurrent() const;
+            size_t getIndex() const;
+            size_t getLevel() const;
+
+            bool goToSon(size_t sonOrder);
+            bool goToParent();
+
+        private:
+            const VebImplicitHierarchy<DataType>* hierarchy_;
+            size_t heapIndex_;
+            size_t depth_;
+            std::array<size_t, details::VEB_MAX_HEIGHT> positions_;
+        };
+
+    private:
+        void relayout(size_t height);
+        void buildLevels(size_t rootDepth, size_t height);
+
+        static size_t heightFor(size_t count);
+        static size_t layoutSize(size_t height);
+
+        size_t count_;
+        size_t height_;
+        std::array<details::VebLevel, details::VEB_MAX_HEIGHT> levels_;
+    };
+
+    template<typename DataType>
+    using VebIH = VebImplicitHierarchy<DataType>;
+
+    //----------
+
+    template<typename DataType>
+    VebImplicitHierarchy<DataType>::VebImplicitHierarchy() :
+            count_(0),
+            height_(0),
+            levels_()
+    {
+    }
+
+    template<typename DataType>
+    VebImplicitHierarchy<DataType>::VebImplicitHierarchy(const VebImplicitHierarchy<DataType>& other) :
+            ImplicitAMS<DataType>(other),
+            count_(other.count_),
+            height_(other.height_),
+            levels_(other.levels_)
+    {
+    }
+
+    template<typename DataType>
+    VebImplicitHierarchy<DataType>::~VebImplicitHierarchy()
+    {
+        count_ = 0;
+        height_ = 0;
+    }
+
+    template<typename DataType>
+    AMT& VebImplicitHierarchy<DataType>::assign(const AMT& other)
+    {
+        if (this != &other)
+        {
+            const VebImplicitHierarchy<DataType>& otherHierarchy = dynamic_cast<const VebImplicitHierarchy<DataType>&>(other);
+            ImplicitAMS<DataType>::assign(otherHierarchy);
+            count_ = otherHierarchy.count_;
+            height_ = otherHierarchy.height_;
+            levels_ = otherHierarchy.levels_;
+        }
+
+        return *this;
+    }
+
+    template<typename DataType>
+    void VebImplicitHierarchy<DataType>::clear()
+    {
+        ImplicitAMS<DataType>::clear();
+        count_ = 0;
+        height_ = 0;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::size() const
+    {
+        return count_;
+    }
+
+    template<typename DataType>
+    bool VebImplicitHierarchy<DataType>::isEmpty() const
+    {
+        return count_ == 0;
+    }
+
+    template<typename DataType>
+    bool VebImplicitHierarchy<DataType>::equals(const AMT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const VebImplicitHierarchy<DataType>* otherHierarchy = dynamic_cast<const VebImplicitHierarchy<DataType>*>(&other);
+        if (otherHierarchy == nullptr || count_ != otherHierarchy->count_)
+        {
+            return false;
+        }
+
+        for (size_t index = 0; index < count_; ++index)
+        {
+            if (std::memcmp(this->access(index), otherHierarchy->access(index), sizeof(MemoryBlock<DataType>)) != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::level(const MemoryBlock<DataType>& node) const
+    {
+        return ImplicitHierarchy<DataType, 2>::level(this->indexOf(node));
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::degree(const MemoryBlock<DataType>& node) const
+    {
+        return this->degree(this->indexOf(node));
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::degree(size_t index) const
+    {
+        const size_t indexOfFirstSon = ImplicitHierarchy<DataType, 2>::indexOfSon(index, 0);
+        return indexOfFirstSon < count_ ? (std::min)(static_cast<size_t>(2), count_ - indexOfFirstSon) : 0;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::nodeCount(const MemoryBlock<DataType>& node) const
+    {
+        return this->indexOf(node) == 0
+               ? count_
+               : Hierarchy<MemoryBlock<DataType>>::nodeCount(node);
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>* VebImplicitHierarchy<DataType>::accessRoot() const
+    {
+        return count_ > 0 ? this->accessBlockAt(0) : nullptr;
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>* VebImplicitHierarchy<DataType>::accessParent(const MemoryBlock<DataType>& node) const
+    {
+        const size_t index = ImplicitHierarchy<DataType, 2>::indexOfParent(this->indexOf(node));
+        return index != INVALID_INDEX ? this->access(index) : nullptr;
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>* VebImplicitHierarchy<DataType>::accessSon(const MemoryBlock<DataType>& node, size_t sonOrder) const
+    {
+        return sonOrder < 2
+               ? this->access(ImplicitHierarchy<DataType, 2>::indexOfSon(this->indexOf(node), sonOrder))
+               : nullptr;
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>* VebImplicitHierarchy<DataType>::accessLastLeaf() const
+    {
+        return count_ > 0 ? this->access(count_ - 1) : nullptr;
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>* VebImplicitHierarchy<DataType>::access(size_t index) const
+    {
+        return index < count_ ? this->accessBlockAt(this->positionOf(index)) : nullptr;
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>& VebImplicitHierarchy<DataType>::emplaceRoot()
+    {
+        throw unavailable_function_call("Method emplace_root() unavailable in implicit hierarchies!");
+    }
+
+    template<typename DataType>
+    void VebImplicitHierarchy<DataType>::changeRoot(MemoryBlock<DataType>*)
+    {
+        throw unavailable_function_call("Method changeRoot() unavailable in implicit hierarchies!");
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>& VebImplicitHierarchy<DataType>::emplaceSon(MemoryBlock<DataType>&, size_t)
+    {
+        throw unavailable_function_call("Method emplaceSon() unavailable in implicit hierarchies!");
+    }
+
+    template<typename DataType>
+    void VebImplicitHierarchy<DataType>::changeSon(MemoryBlock<DataType>&, size_t, MemoryBlock<DataType>*)
+    {
+        throw unavailable_function_call("Method changeSon() unavailable in implicit hierarchies!");
+    }
+
+    template<typename DataType>
+    void VebImplicitHierarchy<DataType>::removeSon(MemoryBlock<DataType>&, size_t)
+    {
+        throw unavailable_function_call("Method removeSon() unavailable in implicit hierarchies!");
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>& VebImplicitHierarchy<DataType>::insertLastLeaf()
+    {
+        if (count_ == layoutSize(height_))
+        {
+            this->relayout(height_ + 1);
+        }
+
+        ++count_;
+        return *this->access(count_ - 1);
+    }
+
+    template<typename DataType>
+    void VebImplicitHierarchy<DataType>::removeLastLeaf()
+    {
+        if (count_ == 0)
+        {
+            throw std::out_of_range("Hierarchy is empty!");
+        }
+
+        --count_;
+        if (height_ > 2 && count_ <= layoutSize(height_ - 2))
+        {
+            this->relayout(heightFor(count_));
+        }
+        else if (count_ == 0)
+        {
+            this->clear();
+        }
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::indexOf(const MemoryBlock<DataType>& node) const
+    {
+        size_t position = this->getMemoryManager()->calculateIndex(node);
+        size_t index = 1;
+        size_t height = height_;
+        while (height > 1)
+        {
+            const details::VebSplit& split = details::VEB_SPLITS[height];
+            if (position < split.topSize_)
+            {
+                height = split.topHeight_;
+            }
+            else
+            {
+                position -= split.topSize_;
+                const size_t bottomTree = position / split.bottomSize_;
+                position -= bottomTree * split.bottomSize_;
+                index = (index << split.topHeight_) + bottomTree;
+                height -= split.topHeight_;
+            }
+        }
+        return index - 1;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::positionOf(size_t index) const
+    {
+        const size_t heapIndex = index + 1;
+        const size_t depth = ImplicitHierarchy<DataType, 2>::level(index);
+        size_t position = 0;
+        size_t levelDepth = depth;
+        while (levelDepth > 0)
+        {
+            const details::VebLevel& level = levels_[levelDepth];
+            position += level.topSize_ + ((heapIndex >> (depth - levelDepth)) & level.topSize_) * level.bottomSize_;
+            levelDepth = level.topRootDepth_;
+        }
+        return position;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::getHeight() const
+    {
+        return height_;
+    }
+
+    template<typename DataType>
+    void VebImplicitHierarchy<DataType>::relayout(size_t height)
+    {
+        if (height > details::VEB_MAX_HEIGHT)
+        {
+            throw std::bad_alloc();
+        }
+
+        std::vector<DataType> data;
+        data.reserve(count_);
+        for (size_t index = 0; index < count_; ++index)
+        {
+            data.push_back(std::move(this->access(index)->data_));
+        }
+
+        typename ImplicitAMS<DataType>::MemoryManagerType* memoryManager = this->getMemoryManager();
+        const size_t newSize = layoutSize(height);
+        if (memoryManager->getCapacity() < newSize)
+        {
+            memoryManager->changeCapacity(newSize);
+        }
+        while (memoryManager->getAllocatedBlockCount() < newSize)
+        {
+            memoryManager->allocateMemory();
+        }
+        while (memoryManager->getAllocatedBlockCount() > newSize)
+        {
+            memoryManager->releaseMemory();
+        }
+        memoryManager->shrinkMemory();
+
+        height_ = height;
+        this->buildLevels(0, height_);
+        for (size_t index = 0; index < data.size(); ++index)
+        {
+            this->access(index)->data_ = std::move(data[index]);
+        }
+    }
+
+    template<typename DataType>
+    void VebImplicitHierarchy<DataType>::buildLevels(size_t rootDepth, size_t height)
+    {
+        if (height > 1)
+        {
+            const details::VebSplit& split = details::VEB_SPLITS[height];
+            const size_t bottomRootDepth = rootDepth + split.topHeight_;
+            levels_[bottomRootDepth] = { rootDepth, split.topSize_, split.bottomSize_ };
+            this->buildLevels(rootDepth, split.topHeight_);
+            this->buildLevels(bottomRootDepth, height - split.topHeight_);
+        }
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::heightFor(size_t count)
+    {
+        return count == 0 ? 0 : ImplicitHierarchy<DataType, 2>::level(count - 1) + 1;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::layoutSize(size_t height)
+    {
+        return (static_cast<size_t>(1) << height) - 1;
+    }
+
+    template<typename DataType>
+    VebImplicitHierarchy<DataType>::PathWalker::PathWalker(const VebImplicitHierarchy<DataType>& hierarchy) :
+            hierarchy_(&hierarchy),
+            heapIndex_(1),
+            depth_(0),
+            positions_()
+    {
+    }
+
+    template<typename DataType>
+    MemoryBlock<DataType>* VebImplicitHierarchy<DataType>::PathWalker::accessCurrent() const
+    {
+        return this->getIndex() < hierarchy_->count_
+               ? hierarchy_->accessBlockAt(positions_[depth_])
+               : nullptr;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::PathWalker::getIndex() const
+    {
+        return heapIndex_ - 1;
+    }
+
+    template<typename DataType>
+    size_t VebImplicitHierarchy<DataType>::PathWalker::getLevel() const
+    {
+        return depth_;
+    }
+
+    template<typename DataType>
+    bool VebImplicitHierarchy<DataType>::PathWalker::goToSon(size_t sonOrder)
+    {
+        const size_t sonHeapIndex = 2 * heapIndex_ + sonOrder;
+        if (sonOrder >= 2 || sonHeapIndex > hierarchy_->count_)
+        {
+            return false;
+        }
+
+        const details::VebLevel& level = hierarchy_->levels_[depth_ + 1];
+        positions_[depth_ + 1] = positions_[level.topRootDepth_] + level.topSize_ + (sonHeapIndex & level.topSize_) * level.bottomSize_;
+        heapIndex_ = sonHeapIndex;
+        ++depth_;
+        return true;
+    }
+
+    template<typename DataType>
+    bool VebImplicitHierarchy<DataType>::PathWalker::goToParent()
+    {
+        if (depth_ == 0)
+        {
+            return false;
+        }
+
+        heapIndex_ >>= 1;
+        --depth_;
+        return true;
+    }
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ds::graph
+{
+    /**
+     * @brief Min-heap of node indices in the range [0, capacity) that knows the position of every index.
+     *
+     * Every index is present at most once, its priority may be decreased in O(log n) without searching the heap.
+     * The heap is 4-ary and keeps priorities next to the indices, so a sift compares priorities of a cache line
+     * of sons instead of following their indices. Positions are kept in an array of the capacity, which is
+     * allocated once and reused, clear takes time proportional to the number of indices in the heap.
+     */
+    template<typename PriorityType>
+    class AddressableHeap
+    {
+    public:
+        using IndexType = std::uint32_t;
+
+        explicit AddressableHeap(size_t capacity = 0); // throw(std::length_error)
+
+        // Empties the heap and makes indices up to the capacity valid.
+        void reset(size_t capacity); // throw(std::length_error)
+        void clear();
+        size_t size() const;
+        bool isEmpty() const;
+        size_t capacity() const;
+
+        bool contains(size_t index) const;
+        PriorityType priority(size_t index) const; // throw(std::out_of_range)
+
+        void push(size_t index, PriorityType priority); // throw(std::out_of_range, std::logic_error)
+        // Inserts the index or lowers its priority, returns whether the heap changed.
+        bool pushOrDecrease(size_t index, PriorityType priority); // throw(std::out_of_range)
+        // Index with the lowest priority.
+        size_t peek() const; // throw(std::out_of_range)
+        size_t pop(); // throw(std::out_of_range)
+
+    private:
+        struct Item
+        {
+            PriorityType priority_;
+            IndexType index_;
+        };
+
+        static constexpr size_t ARITY = 4;
+        static constexpr IndexType ABSENT = std::numeric_limits<IndexType>::max();
+
+        void checkIndex(size_t index) const;
+        void siftUp(size_t position);
+        void siftDown(size_t position);
+        void place(size_t position, const Item& item);
+
+        std::vector<Item> items_;
+        std::vector<IndexType> positions_;
+    };
+
+    //----------
+
+    template<typename PriorityType>
+    AddressableHeap<PriorityType>::AddressableHeap(size_t capacity) :
+        items_(),
+        positions_()
+    {
+        this->reset(capacity);
+    }
+
+    template<typename PriorityType>
+    void AddressableHeap<PriorityType>::reset(size_t capacity)
+    {
+        if (capacity >= ABSENT)
+        {
+            throw std::length_error("Capacity of the heap exceeds the index type!");
+        }
+
+        if (capacity == positions_.size())
+        {
+            this->clear();
+        }
+        else
+        {
+            items_.clear();
+            positions_.assign(capacity, ABSENT);
+        }
+    }
+
+    template<typename PriorityType>
+    void AddressableHeap<PriorityType>::clear()
+    {
+        for (const Item& item : items_)
+        {
+            positions_[item.index_] = ABSENT;
+        }
+        items_.clear();
+    }
+
+    template<typename PriorityType>
+    size_t AddressableHeap<PriorityType>::size() const
+    {
+        return items_.size();
+    }
+
+    template<typename PriorityType>
+    bool AddressableHeap<PriorityType>::isEmpty() const
+    {
+        return items_.empty();
+    }
+
+    template<typename PriorityType>
+    size_t AddressableHeap<PriorityType>::capacity() const
+    {
+        return positions_.size();
+    }
+
+    template<typename PriorityType>
+    bool AddressableHeap<PriorityType>::contains(size_t index) const
+    {
+        return index < positions_.size() && positions_[index] != ABSENT;
+    }
+
+    template<typename PriorityType>
+    PriorityType AddressableHeap<PriorityType>::priority(size_t index) const
+    {
+        if (!this->contains(index))
+        {
+            throw std::out_of_range("Index is not in the heap!");
+        }
+
+        return items_[positions_[index]].priority_;
+    }
+
+    template<typename PriorityType>
+    void AddressableHeap<PriorityType>::push(size_t index, PriorityType priority)
+    {
+        this->checkIndex(index);
+        if (positions_[index] != ABSENT)
+        {
+            throw std::logic_error("Index is already in the heap!");
+        }
+
+        items_.push_back(Item{ priority, static_cast<IndexType>(index) });
+        positions_[index] = static_cast<IndexType>(items_.size() - 1);
+        this->siftUp(items_.size() - 1);
+    }
+
+    template<typename PriorityType>
+    bool AddressableHeap<PriorityType>::pushOrDecrease(size_t index, PriorityType priority)
+    {
+        this->checkIndex(index);
+        const IndexType position = positions_[index];
+        if (position == ABSENT)
+        {
+            this->push(index, priority);
+            return true;
+        }
+        if (priority < items_[position].priority_)
+        {
+            items_[position].priority_ = priority;
+            this->siftUp(position);
+            return true;
+        }
+
+        return false;
+    }
+
+    template<typename PriorityType>
+    size_t AddressableHeap<PriorityType>::peek() const
+    {
+        if (items_.empty())
+        {
+            throw std::out_of_range("Heap is empty!");
+        }
+
+        return items_.front().index_;
+    }
+
+    template<typename PriorityType>
+    size_t AddressableHeap<PriorityType>::pop()
+    {
+        const size_t index = this->peek();
+        positions_[index] = ABSENT;
+        const Item last = items_.back();
+        items_.pop_back();
+        if (!items_.empty())
+        {
+            this->place(0, last);
+            this->siftDown(0);
+        }
+
+        return index;
+    }
+
+    template<typename PriorityType>
+    void AddressableHeap<PriorityType>::checkIndex(size_t index) const
+    {
+        if (index >= positions_.size())
+        {
+            throw std::out_of_range("Invalid heap index!");
+        }
+    }
+
+    template<typename PriorityType>
+    void AddressableHeap<PriorityType>::siftUp(size_t position)
+    {
+        // The moving item is kept aside and written once, parents move down into the hole.
+        const Item item = items_[position];
+        while (position > 0)
+        {
+            const size_t parent = (position - 1) / ARITY;
+            if (!(item.priority_ < items_[parent].priority_))
+            {
+                break;
+            }
+            this->place(position, items_[parent]);
+            position = parent;
+        }
+        this->place(position, item);
+    }
+
+    template<typename PriorityType>
+    void AddressableHeap<PriorityType>::siftDown(size_t position)
+    {
+        const Item item = items_[position];
+        const size_t count = items_.size();
+        while (true)
+        {
+            const size_t firstSon = position * ARITY + 1;
+            if (firstSon >= count)
+            {
+                break;
+            }
+
+            const size_t lastSon = firstSon + ARITY < count ? firstSon + ARITY : count;
+            size_t bestSon = firstSon;
+            for (size_t son = firstSon + 1; son < lastSon; ++son)
+            {
+                if (items_[son].priority_ < items_[bestSon].priority_)
+                {
+                    bestSon = son;
+                }
+            }
+            if (!(items_[bestSon].priority_ < item.priority_))
+            {
+                break;
+            }
+            this->place(position, items_[bestSon]);
+            position = bestSon;
+        }
+        this->place(position, item);
+    }
+
+    template<typename PriorityType>
+    void AddressableHeap<PriorityType>::place(size_t position, const Item& item)
+    {
+        items_[position] = item;
+        positions_[item.index_] = static_cast<IndexType>(position);
+    }
+}
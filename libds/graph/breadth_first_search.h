@@ -0,0 +1,432 @@
+#pragma once
+
+#include <libds/amt/csr_network.h>
+#include <libds/graph/chunks.h>
+#include <libds/simd.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ds::graph
+{
+    /**
+     * @brief Direction-optimizing breadth-first search over a compressed sparse row network.
+     *
+     * A level is expanded top-down, from the frontier to its unvisited neighbours, while the frontier is small.
+     * Once relations of the frontier exceed 1/ALPHA of relations of unvisited nodes, levels are expanded bottom-up:
+     * every unvisited node scans its relations until it finds a parent in the frontier, which skips most relations
+     * of large frontiers. Bottom-up levels keep the frontier in a bitmap, top-down levels in a queue, the search
+     * returns to top-down once the frontier has less than 1/BETA of all nodes.
+     * Distances, parents and bitmaps are allocated by the first search and reused by the following ones.
+     * With a pool, every level is split into chunks: top-down chunks claim nodes by an atomic or on the visited
+     * bitmap, bottom-up chunks own whole words of the bitmaps, so they need no synchronization.
+     * An explicit network is searched through its snapshot, which the caller freezes once and reuses until it changes.
+     * Any other network is searched top-down by a function which lists the related nodes of a node.
+     */
+    class BreadthFirstSearch
+    {
+    public:
+        using IndexType = std::uint32_t;
+
+        static constexpr IndexType UNREACHED = std::numeric_limits<IndexType>::max();
+        static constexpr size_t ALPHA = 14;
+        static constexpr size_t BETA = 24;
+
+        BreadthFirstSearch();
+        BreadthFirstSearch(const BreadthFirstSearch& other) = delete;
+
+        BreadthFirstSearch& operator=(const BreadthFirstSearch& other) = delete;
+
+        template<typename DataType>
+        void run(const amt::CsrNetwork<DataType>& network, size_t source, WorkStealingPool* pool = nullptr); // throw(std::out_of_range)
+        // neighbours(node, visit) calls visit(relatedNode) for indices of all nodes related to the node.
+        template<typename NeighboursFunction>
+        void run(size_t nodeCount, size_t source, NeighboursFunction neighbours); // throw(std::out_of_range)
+
+        size_t nodeCount() const;
+        size_t reachedCount() const;
+        // Number of levels of the last search, the source is level 0.
+        size_t levelCount() const;
+        size_t bottomUpLevelCount() const;
+
+        // Number of relations on the shortest path from the source, UNREACHED if there is none.
+        IndexType distance(size_t node) const; // throw(std::out_of_range)
+        // Previous node on a shortest path, the source is its own parent.
+        IndexType parent(size_t node) const; // throw(std::out_of_range)
+
+    private:
+        using WordType = std::uint64_t;
+
+        static constexpr size_t WORD_BITS = 64;
+        // Frontier nodes or bitmap words processed by one chunk at least.
+        static constexpr size_t GRAIN = 1024;
+
+        struct Chunk
+        {
+            std::vector<IndexType> queue_;
+            size_t nodeCount_;
+            size_t relationCount_;
+        };
+
+        void prepare(size_t nodeCount, WorkStealingPool* pool);
+        void checkNode(size_t node) const;
+        bool isVisited(IndexType node) const;
+        // Marks the node visited, returns false if it was visited before.
+        bool claim(IndexType node, bool concurrent);
+
+        template<typename DataType>
+        void expandTopDown(const amt::CsrNetwork<DataType>& network, IndexType level, WorkStealingPool* pool);
+        template<typename DataType>
+        void expandBottomUp(const amt::CsrNetwork<DataType>& network, IndexType level, WorkStealingPool* pool);
+        void queueToBitmap();
+        void bitmapToQueue();
+
+        size_t nodeCount_;
+        size_t reachedCount_;
+        size_t levelCount_;
+        size_t bottomUpLevelCount_;
+        // Relations of the frontier and of unvisited nodes, they decide the direction of the next level.
+        size_t frontierRelations_;
+        size_t unvisitedRelations_;
+
+        std::vector<IndexType> distances_;
+        std::vector<IndexType> parents_;
+        std::unique_ptr<std::atomic<WordType>[]> visited_;
+        size_t wordCount_;
+        std::vector<WordType> frontierBits_;
+        std::vector<WordType> nextBits_;
+        std::vector<IndexType> queue_;
+        std::vector<Chunk> chunks_;
+    };
+
+    //----------
+
+    inline BreadthFirstSearch::BreadthFirstSearch() :
+        nodeCount_(0),
+        reachedCount_(0),
+        levelCount_(0),
+        bottomUpLevelCount_(0),
+        frontierRelations_(0),
+        unvisitedRelations_(0),
+        distances_(),
+        parents_(),
+        visited_(),
+        wordCount_(0),
+        frontierBits_(),
+        nextBits_(),
+        queue_(),
+        chunks_()
+    {
+    }
+
+    template<typename DataType>
+    void BreadthFirstSearch::run(const amt::CsrNetwork<DataType>& network, size_t source, WorkStealingPool* pool)
+    {
+        if (source >= network.size())
+        {
+            throw std::out_of_range("Invalid source node!");
+        }
+
+        this->prepare(network.size(), pool);
+
+        const auto& sourceNode = *network.accessNodeFromGate(source);
+        const IndexType sourceIndex = static_cast<IndexType>(source);
+        this->claim(sourceIndex, false);
+        distances_[source] = 0;
+        parents_[source] = sourceIndex;
+        queue_.push_back(sourceIndex);
+        reachedCount_ = 1;
+        frontierRelations_ = network.degree(sourceNode);
+        unvisitedRelations_ = network.relationCount() - frontierRelations_;
+
+        bool bottomUp = false;
+        size_t frontierCount = 1;
+        IndexType level = 0;
+        while (frontierCount > 0)
+        {
+            if (!bottomUp && frontierRelations_ > unvisitedRelations_ / ALPHA)
+            {
+                this->queueToBitmap();
+                bottomUp = true;
+            }
+            else if (bottomUp && frontierCount < nodeCount_ / BETA)
+            {
+                this->bitmapToQueue();
+                bottomUp = false;
+            }
+
+            ++levelCount_;
+            if (bottomUp)
+            {
+                ++bottomUpLevelCount_;
+                this->expandBottomUp(network, level, pool);
+            }
+            else
+            {
+                this->expandTopDown(network, level, pool);
+            }
+
+            frontierCount = 0;
+            frontierRelations_ = 0;
+            for (const Chunk& chunk : chunks_)
+            {
+                frontierCount += chunk.nodeCount_;
+                frontierRelations_ += chunk.relationCount_;
+            }
+            reachedCount_ += frontierCount;
+            unvisitedRelations_ -= frontierRelations_;
+            ++level;
+        }
+    }
+
+    template<typename NeighboursFunction>
+    void BreadthFirstSearch::run(size_t nodeCount, size_t source, NeighboursFunction neighbours)
+    {
+        if (source >= nodeCount)
+        {
+            throw std::out_of_range("Invalid source node!");
+        }
+
+        this->prepare(nodeCount, nullptr);
+
+        const IndexType sourceIndex = static_cast<IndexType>(source);
+        this->claim(sourceIndex, false);
+        distances_[source] = 0;
+        parents_[source] = sourceIndex;
+        queue_.push_back(sourceIndex);
+
+        // The queue keeps all reached nodes, a level ends with the last node queued by the previous one.
+        size_t levelEnd = 0;
+        for (size_t head = 0; head < queue_.size(); ++head)
+        {
+            if (head == levelEnd)
+            {
+                ++levelCount_;
+                levelEnd = queue_.size();
+            }
+
+            const IndexType node = queue_[head];
+            neighbours(static_cast<size_t>(node), [this, node](size_t relatedNode)
+                {
+                    const IndexType related = static_cast<IndexType>(relatedNode);
+                    if (this->claim(related, false))
+                    {
+                        distances_[related] = distances_[node] + 1;
+                        parents_[related] = node;
+                        queue_.push_back(related);
+                    }
+                });
+        }
+        reachedCount_ = queue_.size();
+    }
+
+    inline size_t BreadthFirstSearch::nodeCount() const
+    {
+        return nodeCount_;
+    }
+
+    inline size_t BreadthFirstSearch::reachedCount() const
+    {
+        return reachedCount_;
+    }
+
+    inline size_t BreadthFirstSearch::levelCount() const
+    {
+        return levelCount_;
+    }
+
+    inline size_t BreadthFirstSearch::bottomUpLevelCount() const
+    {
+        return bottomUpLevelCount_;
+    }
+
+    inline auto BreadthFirstSearch::distance(size_t node) const -> IndexType
+    {
+        this->checkNode(node);
+        return distances_[node];
+    }
+
+    inline auto BreadthFirstSearch::parent(size_t node) const -> IndexType
+    {
+        this->checkNode(node);
+        return parents_[node];
+    }
+
+    inline void BreadthFirstSearch::prepare(size_t nodeCount, WorkStealingPool* pool)
+    {
+        if (nodeCount >= UNREACHED)
+        {
+            throw std::length_error("Network has too many nodes to search!");
+        }
+
+        const size_t wordCount = (nodeCount + WORD_BITS - 1) / WORD_BITS;
+        if (wordCount > wordCount_)
+        {
+            visited_ = std::make_unique<std::atomic<WordType>[]>(wordCount);
+            wordCount_ = wordCount;
+        }
+        for (size_t i = 0; i < wordCount; ++i)
+        {
+            visited_[i].store(0, std::memory_order_relaxed);
+        }
+
+        nodeCount_ = nodeCount;
+        reachedCount_ = 0;
+        levelCount_ = 0;
+        bottomUpLevelCount_ = 0;
+        distances_.assign(nodeCount, UNREACHED);
+        parents_.assign(nodeCount, UNREACHED);
+        frontierBits_.assign(wordCount, 0);
+        nextBits_.assign(wordCount, 0);
+        queue_.clear();
+        queue_.reserve(nodeCount);
+        chunks_.resize(std::max<size_t>(details::chunkCount(pool, nodeCount, GRAIN), 1));
+    }
+
+    inline void BreadthFirstSearch::checkNode(size_t node) const
+    {
+        if (node >= nodeCount_)
+        {
+            throw std::out_of_range("Invalid node index!");
+        }
+    }
+
+    inline bool BreadthFirstSearch::isVisited(IndexType node) const
+    {
+        return (visited_[node / WORD_BITS].load(std::memory_order_relaxed) >> (node % WORD_BITS)) & 1;
+    }
+
+    inline bool BreadthFirstSearch::claim(IndexType node, bool concurrent)
+    {
+        std::atomic<WordType>& word = visited_[node / WORD_BITS];
+        const WordType bit = WordType{ 1 } << (node % WORD_BITS);
+        if (!concurrent)
+        {
+            const WordType value = word.load(std::memory_order_relaxed);
+            word.store(value | bit, std::memory_order_relaxed);
+            return (value & bit) == 0;
+        }
+
+        return (word.fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+    }
+
+    template<typename DataType>
+    void BreadthFirstSearch::expandTopDown(const amt::CsrNetwork<DataType>& network, IndexType level, WorkStealingPool* pool)
+    {
+        const auto* nodes = network.accessNodeFromGate(0);
+        const size_t chunkCount = std::min(details::chunkCount(pool, queue_.size(), GRAIN), chunks_.size());
+        const bool concurrent = chunkCount > 1;
+        for (Chunk& chunk : chunks_)
+        {
+            chunk.queue_.clear();
+            chunk.nodeCount_ = 0;
+            chunk.relationCount_ = 0;
+        }
+
+        details::processChunks(pool, queue_.size(), chunkCount, [&](size_t chunkIndex, size_t begin, size_t end)
+            {
+                Chunk& chunk = chunks_[chunkIndex];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const IndexType node = queue_[i];
+                    const IndexType* last = network.endNeighbours(nodes[node]);
+                    for (const IndexType* neighbour = network.beginNeighbours(nodes[node]); neighbour != last; ++neighbour)
+                    {
+                        if (!this->isVisited(*neighbour) && this->claim(*neighbour, concurrent))
+                        {
+                            distances_[*neighbour] = level + 1;
+                            parents_[*neighbour] = node;
+                            chunk.queue_.push_back(*neighbour);
+                            chunk.relationCount_ += network.degree(nodes[*neighbour]);
+                        }
+                    }
+                }
+                chunk.nodeCount_ = chunk.queue_.size();
+            });
+
+        queue_.clear();
+        for (const Chunk& chunk : chunks_)
+        {
+            queue_.insert(queue_.end(), chunk.queue_.begin(), chunk.queue_.end());
+        }
+    }
+
+    template<typename DataType>
+    void BreadthFirstSearch::expandBottomUp(const amt::CsrNetwork<DataType>& network, IndexType level, WorkStealingPool* pool)
+    {
+        const auto* nodes = network.accessNodeFromGate(0);
+        const size_t wordCount = frontierBits_.size();
+        const size_t chunkCount = std::min(details::chunkCount(pool, wordCount, GRAIN / WORD_BITS), chunks_.size());
+        for (Chunk& chunk : chunks_)
+        {
+            chunk.nodeCount_ = 0;
+            chunk.relationCount_ = 0;
+        }
+
+        details::processChunks(pool, wordCount, chunkCount, [&](size_t chunkIndex, size_t begin, size_t end)
+            {
+                Chunk& chunk = chunks_[chunkIndex];
+                for (size_t w = begin; w < end; ++w)
+                {
+                    WordType visitedWord = visited_[w].load(std::memory_order_relaxed);
+                    WordType nextWord = 0;
+                    const size_t wordEnd = std::min(nodeCount_, (w + 1) * WORD_BITS);
+                    for (size_t node = w * WORD_BITS; node < wordEnd; ++node)
+                    {
+                        const WordType bit = WordType{ 1 } << (node % WORD_BITS);
+                        if ((visitedWord & bit) != 0)
+                        {
+                            continue;
+                        }
+
+                        const IndexType* last = network.endNeighbours(nodes[node]);
+                        for (const IndexType* neighbour = network.beginNeighbours(nodes[node]); neighbour != last; ++neighbour)
+                        {
+                            if ((frontierBits_[*neighbour / WORD_BITS] >> (*neighbour % WORD_BITS)) & 1)
+                            {
+                                distances_[node] = level + 1;
+                                parents_[node] = *neighbour;
+                                visitedWord |= bit;
+                                nextWord |= bit;
+                                ++chunk.nodeCount_;
+                                chunk.relationCount_ += static_cast<size_t>(last - network.beginNeighbours(nodes[node]));
+                                break;
+                            }
+                        }
+                    }
+                    visited_[w].store(visitedWord, std::memory_order_relaxed);
+                    nextBits_[w] = nextWord;
+                }
+            });
+
+        frontierBits_.swap(nextBits_);
+    }
+
+    inline void BreadthFirstSearch::queueToBitmap()
+    {
+        std::fill(frontierBits_.begin(), frontierBits_.end(), 0);
+        for (IndexType node : queue_)
+        {
+            frontierBits_[node / WORD_BITS] |= WordType{ 1 } << (node % WORD_BITS);
+        }
+        queue_.clear();
+    }
+
+    inline void BreadthFirstSearch::bitmapToQueue()
+    {
+        queue_.clear();
+        for (size_t w = 0; w < frontierBits_.size(); ++w)
+        {
+            for (WordType word = frontierBits_[w]; word != 0; word &= word - 1)
+            {
+                queue_.push_back(static_cast<IndexType>(w * WORD_BITS + simd::scalar::countTrailingZeros(word)));
+            }
+        }
+    }
+}
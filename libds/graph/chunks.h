@@ -0,0 +1,57 @@
+#pragma once
+
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <cstddef>
+
+namespace ds::graph::details
+{
+    // Enough chunks per thread to balance uneven degrees by stealing.
+    constexpr size_t CHUNKS_PER_THREAD = 8;
+
+    // Number of chunks a range of the count is split into, 1 without a pool or for small ranges.
+    inline size_t chunkCount(const WorkStealingPool* pool, size_t count, size_t grain)
+    {
+        if (pool == nullptr || pool->getThreadCount() == 1)
+        {
+            return 1;
+        }
+
+        const size_t chunks = (count + grain - 1) / std::max<size_t>(grain, 1);
+        return std::clamp<size_t>(chunks, 1, pool->getThreadCount() * CHUNKS_PER_THREAD);
+    }
+
+    /**
+     * @brief Calls operation(chunk, begin, end) for every chunk of [0, count) split into chunkCount even parts.
+     * A single chunk runs in the calling thread, others are forked to the pool and waited for.
+     */
+    template<typename Operation>
+    void processChunks(WorkStealingPool* pool, size_t count, size_t chunkCount, const Operation& operation)
+    {
+        if (chunkCount <= 1 || pool == nullptr)
+        {
+            operation(size_t{ 0 }, size_t{ 0 }, count);
+            return;
+        }
+
+        WorkStealingPool::TaskGroup group;
+        for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+        {
+            pool->fork(group, [&operation, count, chunkCount, chunk]()
+                {
+                    operation(chunk, count * chunk / chunkCount, count * (chunk + 1) / chunkCount);
+                });
+        }
+        try
+        {
+            operation(size_t{ 0 }, size_t{ 0 }, count / chunkCount);
+        }
+        catch (...)
+        {
+            // Forked chunks reference the group, so they have to finish first.
+            pool->wait(group);
+            throw;
+        }
+        pool->wait(group);
+    }
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <libds/adt/disjoint_sets.h>
+#include <libds/amt/csr_network.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/graph/chunks.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace ds::graph
+{
+    /**
+     * @brief Labels of connected components of a network, the label of a node is the smallest index in its component.
+     *
+     * Without a pool, relations are merged by disjoint sets in a single pass over them, so no search stack grows
+     * with the network. With a pool, components are found by Afforest: every node is linked to its first
+     * SAMPLED_RELATIONS neighbours, the largest component is estimated from SAMPLE_SIZE random nodes, and only
+     * nodes outside of it link their remaining relations. Links hang the root with the higher index under the
+     * lower node by a compare-and-swap, so a parent never has a higher index than its son and threads need no locks.
+     * Relations have to be stored at both of their nodes, as they are in frozen networks.
+     */
+    template<typename DataType>
+    std::vector<std::uint32_t> connectedComponents(const amt::CsrNetwork<DataType>& network, WorkStealingPool* pool = nullptr);
+
+    // Without a pool, relations are read from the network, otherwise from its snapshot. Indices are orders in the gate.
+    template<typename BlockType, typename GateType>
+    std::vector<std::uint32_t> connectedComponents(const amt::ExplicitNetwork<BlockType, GateType>& network, WorkStealingPool* pool = nullptr);
+
+    // Number of components of the labels returned by connectedComponents.
+    size_t componentCount(const std::vector<std::uint32_t>& labels);
+
+    namespace details
+    {
+        constexpr size_t SAMPLED_RELATIONS = 2;
+        constexpr size_t SAMPLE_SIZE = 1024;
+        constexpr size_t COMPONENT_GRAIN = 4096;
+
+        // Relabels every set by its smallest element.
+        std::vector<std::uint32_t> labelsOf(adt::DisjointSets& sets);
+
+        template<typename DataType>
+        std::vector<std::uint32_t> afforest(const amt::CsrNetwork<DataType>& network, WorkStealingPool& pool);
+
+        void link(std::atomic<std::uint32_t>* parents, std::uint32_t nodeA, std::uint32_t nodeB);
+        void compress(std::atomic<std::uint32_t>* parents, std::uint32_t node);
+    }
+
+    //----------
+
+    template<typename DataType>
+    std::vector<std::uint32_t> connectedComponents(const amt::CsrNetwork<DataType>& network, WorkStealingPool* pool)
+    {
+        if (network.isEmpty())
+        {
+            return std::vector<std::uint32_t>();
+        }
+        if (pool != nullptr)
+        {
+            return details::afforest(network, *pool);
+        }
+
+        adt::DisjointSets sets(network.size());
+        const amt::MemoryBlock<DataType>* nodes = network.accessNodeFromGate(0);
+        for (std::uint32_t node = 0; node < network.size(); ++node)
+        {
+            const std::uint32_t* last = network.endNeighbours(nodes[node]);
+            for (const std::uint32_t* neighbour = network.beginNeighbours(nodes[node]); neighbour != last; ++neighbour)
+            {
+                // Every relation is stored at both nodes, so it is merged from the lower one.
+                if (node < *neighbour)
+                {
+                    sets.unite(node, *neighbour);
+                }
+            }
+        }
+        return details::labelsOf(sets);
+    }
+
+    template<typename BlockType, typename GateType>
+    std::vector<std::uint32_t> connectedComponents(const amt::ExplicitNetwork<BlockType, GateType>& network, WorkStealingPool* pool)
+    {
+        if (pool != nullptr)
+        {
+            return connectedComponents(network.freeze(), pool);
+        }
+
+        adt::DisjointSets sets(network.size());
+        network.processRelations([&sets](const BlockType* node, const BlockType* relatedNode)
+            {
+                if (node->gateIndex_ < relatedNode->gateIndex_)
+                {
+                    sets.unite(node->gateIndex_, relatedNode->gateIndex_);
+                }
+            });
+        return details::labelsOf(sets);
+    }
+
+    inline size_t componentCount(const std::vector<std::uint32_t>& labels)
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < labels.size(); ++i)
+        {
+            result += labels[i] == i ? 1 : 0;
+        }
+        return result;
+    }
+
+    namespace details
+    {
+        inline std::vector<std::uint32_t> labelsOf(adt::DisjointSets& sets)
+        {
+            // A root with a higher index than the node gets the label of the node, which is the first of its set.
+            const std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+            std::vector<std::uint32_t> labels(sets.size(), none);
+            for (size_t node = 0; node < sets.size(); ++node)
+            {
+                const size_t root = sets.find(node);
+                if (labels[root] == none)
+                {
+                    labels[root] = static_cast<std::uint32_t>(node);
+                }
+                labels[node] = labels[root];
+            }
+            return labels;
+        }
+
+        template<typename DataType>
+        std::vector<std::uint32_t> afforest(const amt::CsrNetwork<DataType>& network, WorkStealingPool& pool)
+        {
+            const size_t nodeCount = network.size();
+            const amt::MemoryBlock<DataType>* nodes = network.accessNodeFromGate(0);
+            std::unique_ptr<std::atomic<std::uint32_t>[]> parentsArray = std::make_unique<std::atomic<std::uint32_t>[]>(nodeCount);
+            std::atomic<std::uint32_t>* parents = parentsArray.get();
+            const size_t chunks = chunkCount(&pool, nodeCount, COMPONENT_GRAIN);
+
+            auto compressAll = [parents](size_t, size_t begin, size_t end)
+                {
+                    for (size_t node = begin; node < end; ++node)
+                    {
+                        compress(parents, static_cast<std::uint32_t>(node));
+                    }
+                };
+
+            processChunks(&pool, nodeCount, chunks, [parents](size_t, size_t begin, size_t end)
+                {
+                    for (size_t node = begin; node < end; ++node)
+                    {
+                        parents[node].store(static_cast<std::uint32_t>(node), std::memory_order_relaxed);
+                    }
+                });
+
+            for (size_t round = 0; round < SAMPLED_RELATIONS; ++round)
+            {
+                processChunks(&pool, nodeCount, chunks, [&network, nodes, parents, round](size_t, size_t begin, size_t end)
+                    {
+                        for (size_t node = begin; node < end; ++node)
+                        {
+                            const std::uint32_t* first = network.beginNeighbours(nodes[node]);
+                            if (first + round < network.endNeighbours(nodes[node]))
+                            {
+                                link(parents, static_cast<std::uint32_t>(node), first[round]);
+                            }
+                        }
+                    });
+                processChunks(&pool, nodeCount, chunks, compressAll);
+            }
+
+            // The most frequent root among the samples is most likely the root of the largest component.
+            std::default_random_engine rng(144);
+            std::vector<std::uint32_t> samples(SAMPLE_SIZE);
+            for (std::uint32_t& sample : samples)
+            {
+                sample = parents[rng() % nodeCount].load(std::memory_order_relaxed);
+            }
+            std::sort(samples.begin(), samples.end());
+            std::uint32_t largest = samples.front();
+            size_t largestCount = 0;
+            for (size_t first = 0, last = 0; first < samples.size(); first = last)
+            {
+                while (last < samples.size() && samples[last] == samples[first])
+                {
+                    ++last;
+                }
+                if (last - first > largestCount)
+                {
+                    largest = samples[first];
+                    largestCount = last - first;
+                }
+            }
+
+            // Relations between the largest component and other nodes are linked from the other nodes.
+            processChunks(&pool, nodeCount, chunks, [&network, nodes, parents, largest](size_t, size_t begin, size_t end)
+                {
+                    for (size_t node = begin; node < end; ++node)
+                    {
+                        if (parents[node].load(std::memory_order_relaxed) == largest)
+                        {
+                            continue;
+                        }
+
+                        const std::uint32_t* last = network.endNeighbours(nodes[node]);
+                        const std::uint32_t* first = network.beginNeighbours(nodes[node]);
+                        for (const std::uint32_t* neighbour = first + std::min<size_t>(SAMPLED_RELATIONS, last - first); neighbour != last; ++neighbour)
+                        {
+                            link(parents, static_cast<std::uint32_t>(node), *neighbour);
+                        }
+                    }
+                });
+            processChunks(&pool, nodeCount, chunks, compressAll);
+
+            std::vector<std::uint32_t> labels(nodeCount);
+            for (size_t node = 0; node < nodeCount; ++node)
+            {
+                labels[node] = parents[node].load(std::memory_order_relaxed);
+            }
+            return labels;
+        }
+
+        inline void link(std::atomic<std::uint32_t>* parents, std::uint32_t nodeA, std::uint32_t nodeB)
+        {
+            std::uint32_t parentA = parents[nodeA].load(std::memory_order_relaxed);
+            std::uint32_t parentB = parents[nodeB].load(std::memory_order_relaxed);
+            while (parentA != parentB)
+            {
+                const std::uint32_t high = std::max(parentA, parentB);
+                const std::uint32_t low = std::min(parentA, parentB);
+                std::uint32_t parentHigh = parents[high].load(std::memory_order_relaxed);
+                if (parentHigh == low)
+                {
+                    return;
+                }
+                if (parentHigh == high && parents[high].compare_exchange_strong(parentHigh, low, std::memory_order_relaxed))
+                {
+                    return;
+                }
+                parentA = parents[parents[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+                parentB = parents[low].load(std::memory_order_relaxed);
+            }
+        }
+
+        inline void compress(std::atomic<std::uint32_t>* parents, std::uint32_t node)
+        {
+            std::uint32_t parent = parents[node].load(std::memory_order_relaxed);
+            std::uint32_t grandparent = parents[parent].load(std::memory_order_relaxed);
+            while (parent != grandparent)
+            {
+                parents[node].store(grandparent, std::memory_order_relaxed);
+                parent = grandparent;
+                grandparent = parents[parent].load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
@@ -0,0 +1,365 @@
+#pragma once
+
+#include <libds/amt/explicit_network.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/graph/chunks.h>
+#include <libds/prefetch.h>
+#include <libds/work_stealing_pool.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DS_MAPPED_FILES
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ds::graph
+{
+    /**
+     * @brief Text lists have a relation per line as two node indices separated by blanks, further fields
+     * of the line are ignored and lines starting with # or % are comments. Binary lists are pairs
+     * of 32-bit node indices in the byte order of the machine.
+     */
+    enum class EdgeListFormat { Text, Binary };
+
+    /**
+     * @brief Loads relations of an edge list into an empty network, as if every node was inserted and every
+     * relation connected in the order of the list.
+     *
+     * The file is mapped into memory and read twice. The first pass counts degrees, so the nodes are inserted
+     * at once and implicit relations of every node are reserved to their exact count. The second pass stores
+     * relations without any gate access, in batches whose nodes are prefetched first. With a pool, it runs one shard of nodes per thread, shards hold
+     * the same number of relations and every shard reads the whole list but stores only relations of its own nodes,
+     * so no two threads touch the same node. Reading binary lists is cheap compared to the stores, text lists are
+     * parsed again by every shard. The node count is the highest index + 1, arithmetic data of a node is its index.
+     */
+    template<typename BlockType, typename GateType>
+    void loadEdgeList(amt::ExplicitNetwork<BlockType, GateType>& network, const std::string& path,
+        EdgeListFormat format, WorkStealingPool* pool = nullptr); // throw(std::logic_error, std::runtime_error, std::invalid_argument)
+
+    namespace details
+    {
+        // Relations stored at once in the second pass, long enough to hide the misses of a prefetched batch.
+        constexpr size_t EDGE_BATCH_SIZE = 64;
+
+        /**
+         * @brief Read-only content of a whole file, mapped into memory where the platform allows it and read otherwise.
+         */
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(const std::string& path); // throw(std::runtime_error)
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+            ~MappedFile();
+
+            const char* begin() const;
+            const char* end() const;
+
+        private:
+            const char* data_;
+            size_t size_;
+#if !defined(DS_MAPPED_FILES)
+            std::vector<char> buffer_;
+#endif
+        };
+
+        // Calls operation(from, to) for every relation of the list in its order.
+        template<typename Operation>
+        void forEachEdge(const MappedFile& file, EdgeListFormat format, const Operation& operation); // throw(std::invalid_argument)
+
+        std::uint32_t parseNodeIndex(const char*& position, const char* end); // throw(std::invalid_argument)
+    }
+
+    //----------
+
+    template<typename BlockType, typename GateType>
+    void loadEdgeList(amt::ExplicitNetwork<BlockType, GateType>& network, const std::string& path,
+        EdgeListFormat format, WorkStealingPool* pool)
+    {
+        using DataType = typename BlockType::DataT;
+
+        if (!network.isEmpty())
+        {
+            throw std::logic_error("Network is not empty!");
+        }
+
+        details::MappedFile file(path);
+        std::vector<size_t> degrees;
+        size_t relationCount = 0;
+        details::forEachEdge(file, format, [&degrees, &relationCount](std::uint32_t from, std::uint32_t to)
+            {
+                const size_t last = std::max(from, to);
+                if (last >= degrees.size())
+                {
+                    degrees.resize(last + 1, 0);
+                }
+                ++degrees[from];
+                ++degrees[to];
+                relationCount += 2;
+            });
+
+        std::vector<BlockType*> nodes(degrees.size());
+        for (size_t index = 0; index < nodes.size(); ++index)
+        {
+            BlockType& node = network.insert();
+            if constexpr (std::is_arithmetic_v<DataType>)
+            {
+                node.data_ = static_cast<DataType>(index);
+            }
+            if constexpr (std::is_base_of_v<amt::IS<BlockType*>, std::remove_pointer_t<decltype(node.relations_)>>)
+            {
+                if (degrees[index] > 0)
+                {
+                    node.relations_->reserveCapacity(degrees[index]);
+                }
+            }
+            nodes[index] = &node;
+        }
+
+        // Shards split the stored relations, not the nodes, evenly, so hubs do not load a single thread.
+        const size_t shardCount = pool != nullptr ? pool->getThreadCount() : 1;
+        std::vector<size_t> bounds(shardCount + 1, nodes.size());
+        bounds[0] = 0;
+        size_t shard = 1;
+        size_t stored = 0;
+        for (size_t index = 0; index < nodes.size() && shard < shardCount; ++index)
+        {
+            while (shard < shardCount && stored * shardCount >= relationCount * shard)
+            {
+                bounds[shard++] = index;
+            }
+            stored += degrees[index];
+        }
+        degrees = std::vector<size_t>();
+
+        details::processChunks(pool, shardCount, shardCount, [&file, format, &nodes, &bounds](size_t chunk, size_t, size_t)
+            {
+                const size_t begin = bounds[chunk];
+                const size_t end = bounds[chunk + 1];
+                if (begin == end)
+                {
+                    return;
+                }
+
+                // Relations are stored in batches, whose nodes are prefetched level by level down to their relations first.
+                std::vector<std::uint32_t> batch;
+                batch.reserve(2 * details::EDGE_BATCH_SIZE);
+                auto storeBatch = [&nodes, &batch, begin, end]()
+                    {
+                        auto isOwn = [begin, end](std::uint32_t node) { return node >= begin && node < end; };
+                        for (const std::uint32_t node : batch)
+                        {
+                            prefetch(nodes.data() + node);
+                        }
+                        for (const std::uint32_t node : batch)
+                        {
+                            if (isOwn(node))
+                            {
+                                prefetch(nodes[node]);
+                            }
+                        }
+                        for (const std::uint32_t node : batch)
+                        {
+                            if (isOwn(node))
+                            {
+                                prefetch(nodes[node]->relations_);
+                            }
+                        }
+                        for (size_t i = 0; i < batch.size(); i += 2)
+                        {
+                            if (isOwn(batch[i]))
+                            {
+                                nodes[batch[i]]->relations_->insertLast().data_ = nodes[batch[i + 1]];
+                            }
+                            if (isOwn(batch[i + 1]))
+                            {
+                                nodes[batch[i + 1]]->relations_->insertLast().data_ = nodes[batch[i]];
+                            }
+                        }
+                        batch.clear();
+                    };
+
+                details::forEachEdge(file, format, [&batch, &storeBatch](std::uint32_t from, std::uint32_t to)
+                    {
+                        batch.push_back(from);
+                        batch.push_back(to);
+                        if (batch.size() == 2 * details::EDGE_BATCH_SIZE)
+                        {
+                            storeBatch();
+                        }
+                    });
+                storeBatch();
+            });
+    }
+
+    namespace details
+    {
+#if defined(DS_MAPPED_FILES)
+        inline MappedFile::MappedFile(const std::string& path) :
+            data_(nullptr),
+            size_(0)
+        {
+            const int descriptor = ::open(path.c_str(), O_RDONLY);
+            if (descriptor < 0)
+            {
+                throw std::runtime_error("Failed to open edge list!");
+            }
+
+            struct stat status;
+            if (::fstat(descriptor, &status) != 0)
+            {
+                ::close(descriptor);
+                throw std::runtime_error("Failed to open edge list!");
+            }
+
+            size_ = static_cast<size_t>(status.st_size);
+            if (size_ > 0)
+            {
+                void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (address == MAP_FAILED)
+                {
+                    ::close(descriptor);
+                    throw std::runtime_error("Failed to map edge list!");
+                }
+                ::posix_madvise(address, size_, POSIX_MADV_SEQUENTIAL);
+                data_ = static_cast<const char*>(address);
+            }
+            // The mapping stays valid without the descriptor.
+            ::close(descriptor);
+        }
+
+        inline MappedFile::~MappedFile()
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(const_cast<char*>(data_), size_);
+            }
+        }
+#else
+        inline MappedFile::MappedFile(const std::string& path) :
+            data_(nullptr),
+            size_(0)
+        {
+            std::ifstream stream(path, std::ios::binary | std::ios::ate);
+            if (!stream.is_open())
+            {
+                throw std::runtime_error("Failed to open edge list!");
+            }
+
+            buffer_.resize(static_cast<size_t>(stream.tellg()));
+            stream.seekg(0);
+            if (!stream.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size())))
+            {
+                throw std::runtime_error("Failed to read edge list!");
+            }
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+        }
+
+        inline MappedFile::~MappedFile()
+        {
+        }
+#endif
+
+        inline const char* MappedFile::begin() const
+        {
+            return data_;
+        }
+
+        inline const char* MappedFile::end() const
+        {
+            return data_ + size_;
+        }
+
+        template<typename Operation>
+        void forEachEdge(const MappedFile& file, EdgeListFormat format, const Operation& operation)
+        {
+            const char* position = file.begin();
+            const char* end = file.end();
+
+            if (format == EdgeListFormat::Binary)
+            {
+                constexpr size_t RELATION_SIZE = 2 * sizeof(std::uint32_t);
+                if ((end - position) % RELATION_SIZE != 0)
+                {
+                    throw std::invalid_argument("Malformed edge list!");
+                }
+
+                for (; position != end; position += RELATION_SIZE)
+                {
+                    std::uint32_t relation[2];
+                    std::memcpy(relation, position, RELATION_SIZE);
+                    operation(relation[0], relation[1]);
+                }
+                return;
+            }
+
+            auto isBlank = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+            auto skipLine = [&position, end]()
+                {
+                    position = std::find(position, end, '\n');
+                    position += position != end ? 1 : 0;
+                };
+
+            while (position != end)
+            {
+                while (position != end && isBlank(*position))
+                {
+                    ++position;
+                }
+                if (position == end || *position == '\n' || *position == '#' || *position == '%')
+                {
+                    skipLine();
+                    continue;
+                }
+
+                const std::uint32_t from = parseNodeIndex(position, end);
+                if (position == end || !isBlank(*position))
+                {
+                    throw std::invalid_argument("Malformed edge list!");
+                }
+                while (position != end && isBlank(*position))
+                {
+                    ++position;
+                }
+                const std::uint32_t to = parseNodeIndex(position, end);
+                if (position != end && *position != '\n' && !isBlank(*position))
+                {
+                    throw std::invalid_argument("Malformed edge list!");
+                }
+                skipLine();
+                operation(from, to);
+            }
+        }
+
+        inline std::uint32_t parseNodeIndex(const char*& position, const char* end)
+        {
+            if (position == end || *position < '0' || *position > '9')
+            {
+                throw std::invalid_argument("Malformed edge list!");
+            }
+
+            std::uint64_t result = 0;
+            for (; position != end && *position >= '0' && *position <= '9'; ++position)
+            {
+                result = result * 10 + static_cast<std::uint64_t>(*position - '0');
+                if (result > std::numeric_limits<std::uint32_t>::max())
+                {
+                    throw std::invalid_argument("Node index of edge list is too large!");
+                }
+            }
+            return static_cast<std::uint32_t>(result);
+        }
+    }
+}
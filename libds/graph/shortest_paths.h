@@ -0,0 +1,286 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/csr_network.h>
+#include <libds/graph/addressable_heap.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ds::graph
+{
+    /**
+     * @brief Shortest paths from one node of a compressed sparse row network with non-negative weights of relations.
+     *
+     * Weights are given by a function of the two related nodes, so the network needs no weights of its own.
+     * Dijkstra settles nodes in the order of their distances, A* in the order of their distances increased
+     * by a heuristic estimate of the remaining distance to the target and stops at the target.
+     * Open nodes are kept in an addressable heap, so a shorter path updates the priority of its node in place.
+     * Distances, predecessors and the heap are allocated by the first search of a network of the same size
+     * and reused by the following ones, which reset only the nodes reached before.
+     * An explicit network is searched through its snapshot, which the caller freezes once and reuses until it changes.
+     * Any other network is searched by a function which lists the related nodes of a node with weights of the relations.
+     */
+    template<typename WeightType>
+    class ShortestPaths
+    {
+    public:
+        using IndexType = std::uint32_t;
+
+        static constexpr WeightType INFINITE = std::numeric_limits<WeightType>::max();
+        static constexpr IndexType NO_PREDECESSOR = std::numeric_limits<IndexType>::max();
+
+        ShortestPaths();
+
+        // weight(from, to) returns the weight of the relation of the blocks of two nodes.
+        template<typename DataType, typename WeightFunction>
+        void dijkstra(const amt::CsrNetwork<DataType>& network, size_t source, WeightFunction weight); // throw(std::out_of_range, std::invalid_argument)
+        // neighbours(node, relax) calls relax(relatedNode, weight) for indices of all nodes related to the node.
+        template<typename NeighboursFunction>
+        void dijkstra(size_t nodeCount, size_t source, NeighboursFunction neighbours); // throw(std::out_of_range, std::invalid_argument)
+
+        // heuristic(node) must not overestimate the distance from the node to the target, returns whether the target was reached.
+        // A heuristic that is not consistent reopens settled nodes, so it costs time, not correctness.
+        template<typename DataType, typename WeightFunction, typename HeuristicFunction>
+        bool aStar(const amt::CsrNetwork<DataType>& network, size_t source, size_t target,
+                   WeightFunction weight, HeuristicFunction heuristic); // throw(std::out_of_range, std::invalid_argument)
+
+        size_t nodeCount() const;
+        // Number of nodes taken from the heap by the last search.
+        size_t settledCount() const;
+
+        bool isReached(size_t node) const; // throw(std::out_of_range)
+        // Exact for settled nodes, an upper bound for nodes left open by A*, INFINITE for unreached nodes.
+        WeightType distance(size_t node) const; // throw(std::out_of_range)
+        // Previous node on the path, the source is its own predecessor.
+        IndexType predecessor(size_t node) const; // throw(std::out_of_range)
+        // Nodes of the path from the source to the target, empty if the target was not reached.
+        std::vector<size_t> path(size_t target) const; // throw(std::out_of_range)
+
+    private:
+        void prepare(size_t nodeCount);
+        void checkNode(size_t node) const;
+
+        template<typename DataType, typename WeightFunction, typename HeuristicFunction>
+        bool search(const amt::CsrNetwork<DataType>& network, size_t source, IndexType target,
+                    WeightFunction& weight, HeuristicFunction& heuristic);
+        // Target NO_PREDECESSOR searches the whole network, heuristic(node) takes the index of a node.
+        template<typename NeighboursFunction, typename HeuristicFunction>
+        bool search(size_t nodeCount, size_t source, IndexType target,
+                    NeighboursFunction& neighbours, HeuristicFunction& heuristic);
+
+        size_t settledCount_;
+        std::vector<WeightType> distances_;
+        std::vector<IndexType> predecessors_;
+        // Nodes whose distance is not INFINITE.
+        std::vector<IndexType> reached_;
+        AddressableHeap<WeightType> heap_;
+    };
+
+    //----------
+
+    template<typename WeightType>
+    ShortestPaths<WeightType>::ShortestPaths() :
+        settledCount_(0),
+        distances_(),
+        predecessors_(),
+        reached_(),
+        heap_()
+    {
+    }
+
+    template<typename WeightType>
+    template<typename DataType, typename WeightFunction>
+    void ShortestPaths<WeightType>::dijkstra(const amt::CsrNetwork<DataType>& network, size_t source, WeightFunction weight)
+    {
+        auto noHeuristic = [](const amt::MemoryBlock<DataType>&) { return WeightType(); };
+        this->search(network, source, NO_PREDECESSOR, weight, noHeuristic);
+    }
+
+    template<typename WeightType>
+    template<typename NeighboursFunction>
+    void ShortestPaths<WeightType>::dijkstra(size_t nodeCount, size_t source, NeighboursFunction neighbours)
+    {
+        auto noHeuristic = [](IndexType) { return WeightType(); };
+        this->search(nodeCount, source, NO_PREDECESSOR, neighbours, noHeuristic);
+    }
+
+    template<typename WeightType>
+    template<typename DataType, typename WeightFunction, typename HeuristicFunction>
+    bool ShortestPaths<WeightType>::aStar(const amt::CsrNetwork<DataType>& network, size_t source, size_t target,
+                                          WeightFunction weight, HeuristicFunction heuristic)
+    {
+        if (target >= network.size())
+        {
+            throw std::out_of_range("Invalid target node!");
+        }
+
+        return this->search(network, source, static_cast<IndexType>(target), weight, heuristic);
+    }
+
+    template<typename WeightType>
+    size_t ShortestPaths<WeightType>::nodeCount() const
+    {
+        return distances_.size();
+    }
+
+    template<typename WeightType>
+    size_t ShortestPaths<WeightType>::settledCount() const
+    {
+        return settledCount_;
+    }
+
+    template<typename WeightType>
+    bool ShortestPaths<WeightType>::isReached(size_t node) const
+    {
+        this->checkNode(node);
+        return predecessors_[node] != NO_PREDECESSOR;
+    }
+
+    template<typename WeightType>
+    WeightType ShortestPaths<WeightType>::distance(size_t node) const
+    {
+        this->checkNode(node);
+        return distances_[node];
+    }
+
+    template<typename WeightType>
+    auto ShortestPaths<WeightType>::predecessor(size_t node) const -> IndexType
+    {
+        this->checkNode(node);
+        return predecessors_[node];
+    }
+
+    template<typename WeightType>
+    std::vector<size_t> ShortestPaths<WeightType>::path(size_t target) const
+    {
+        std::vector<size_t> result;
+        if (!this->isReached(target))
+        {
+            return result;
+        }
+
+        size_t node = target;
+        result.push_back(node);
+        while (predecessors_[node] != node)
+        {
+            node = predecessors_[node];
+            result.push_back(node);
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    template<typename WeightType>
+    void ShortestPaths<WeightType>::prepare(size_t nodeCount)
+    {
+        if (nodeCount >= NO_PREDECESSOR)
+        {
+            throw std::length_error("Network has too many nodes to search!");
+        }
+
+        if (nodeCount == distances_.size())
+        {
+            for (IndexType node : reached_)
+            {
+                distances_[node] = INFINITE;
+                predecessors_[node] = NO_PREDECESSOR;
+            }
+        }
+        else
+        {
+            distances_.assign(nodeCount, INFINITE);
+            predecessors_.assign(nodeCount, NO_PREDECESSOR);
+        }
+        reached_.clear();
+        heap_.reset(nodeCount);
+        settledCount_ = 0;
+    }
+
+    template<typename WeightType>
+    void ShortestPaths<WeightType>::checkNode(size_t node) const
+    {
+        if (node >= distances_.size())
+        {
+            throw std::out_of_range("Invalid node index!");
+        }
+    }
+
+    template<typename WeightType>
+    template<typename DataType, typename WeightFunction, typename HeuristicFunction>
+    bool ShortestPaths<WeightType>::search(const amt::CsrNetwork<DataType>& network, size_t source, IndexType target,
+                                           WeightFunction& weight, HeuristicFunction& heuristic)
+    {
+        if (source >= network.size())
+        {
+            throw std::out_of_range("Invalid source node!");
+        }
+
+        const amt::MemoryBlock<DataType>* nodes = network.accessNodeFromGate(0);
+        auto neighbours = [&network, &weight, nodes](IndexType node, auto& relax)
+            {
+                const IndexType* last = network.endNeighbours(nodes[node]);
+                for (const IndexType* neighbour = network.beginNeighbours(nodes[node]); neighbour != last; ++neighbour)
+                {
+                    relax(*neighbour, weight(nodes[node], nodes[*neighbour]));
+                }
+            };
+        auto nodeHeuristic = [&heuristic, nodes](IndexType node) { return heuristic(nodes[node]); };
+        return this->search(network.size(), source, target, neighbours, nodeHeuristic);
+    }
+
+    template<typename WeightType>
+    template<typename NeighboursFunction, typename HeuristicFunction>
+    bool ShortestPaths<WeightType>::search(size_t nodeCount, size_t source, IndexType target,
+                                           NeighboursFunction& neighbours, HeuristicFunction& heuristic)
+    {
+        if (source >= nodeCount)
+        {
+            throw std::out_of_range("Invalid source node!");
+        }
+
+        this->prepare(nodeCount);
+
+        distances_[source] = WeightType();
+        predecessors_[source] = static_cast<IndexType>(source);
+        reached_.push_back(static_cast<IndexType>(source));
+        heap_.push(source, heuristic(static_cast<IndexType>(source)));
+
+        while (!heap_.isEmpty())
+        {
+            const IndexType node = static_cast<IndexType>(heap_.pop());
+            ++settledCount_;
+            if (node == target)
+            {
+                return true;
+            }
+
+            const WeightType nodeDistance = distances_[node];
+            auto relax = [this, &heuristic, node, nodeDistance](size_t relatedNode, WeightType relationWeight)
+                {
+                    if (relationWeight < WeightType())
+                    {
+                        throw std::invalid_argument("Negative relation weight!");
+                    }
+
+                    const IndexType neighbour = static_cast<IndexType>(relatedNode);
+                    const WeightType neighbourDistance = nodeDistance + relationWeight;
+                    if (neighbourDistance < distances_[neighbour])
+                    {
+                        if (predecessors_[neighbour] == NO_PREDECESSOR)
+                        {
+                            reached_.push_back(neighbour);
+                        }
+                        distances_[neighbour] = neighbourDistance;
+                        predecessors_[neighbour] = node;
+                        heap_.pushOrDecrease(neighbour, neighbourDistance + heuristic(neighbour));
+                    }
+                };
+            neighbours(node, relax);
+        }
+
+        return false;
+    }
+}
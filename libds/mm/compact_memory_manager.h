@@ -4,6 +4,7 @@
 #include <libds/mm/memory_omanip.h>
 #include <libds/constants.h>
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -25,9 +26,19 @@ namespace ds::mm {
         void releaseMemory(BlockType* pointer) override;
         void releaseMemoryAt(size_t index);
         void releaseMemory();
+        bool allocatesIndividually() const override;
 
         size_t getCapacity() const;
 
+        // Copies of a copy-on-write manager share its buffer until either of them is mutated.
+        // Non-const access to a block counts as a mutation, const access does not.
+        // Copies may be made and destroyed on different threads.
+        void setCopyOnWrite(bool copyOnWrite);
+        bool isCopyOnWrite() const;
+        bool isShared() const;
+        // Copies a shared buffer, so that its blocks can be written.
+        void detach();
+
         CompactMemoryManager<BlockType>& assign(const CompactMemoryManager<BlockType>& other);
         void changeCapacity(size_t newCapacity);
         void shrinkMemory();
@@ -36,6 +47,7 @@ namespace ds::mm {
         void* calculateAddress(const BlockType& data);
         size_t calculateIndex(const BlockType& data);
         BlockType& getBlockAt(size_t index);
+        const BlockType& getBlockAt(size_t index) const;
         void swap(size_t index1, size_t index2);
 
         void print(std::ostream& os);
@@ -44,10 +56,18 @@ namespace ds::mm {
         size_t getAllocatedBlocksSize() const;
         size_t getAllocatedCapacitySize() const;
 
+        void share(const CompactMemoryManager<BlockType>& other);
+        void releaseBuffer();
+        // Drops the share of the buffer, the last owner destroys its blocks and frees it.
+        void releaseShare(BlockType* base, BlockType* end);
+
     private:
         BlockType* base_;
         BlockType* end_;
         BlockType* limit_;
+        // Owners of the buffer, present whenever the manager is copy-on-write or shares its buffer.
+        std::atomic<size_t>* sharedCount_;
+        bool copyOnWrite_;
 
         static const size_t INIT_SIZE = 4;
     };
@@ -62,13 +82,15 @@ namespace ds::mm {
     CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size) :
             base_(static_cast<BlockType*>(std::calloc(size, sizeof(BlockType)))),
             end_(base_),
-            limit_(base_ + size)
+            limit_(base_ + size),
+            sharedCount_(nullptr),
+            copyOnWrite_(false)
     {
     }
 
     template<typename BlockType>
     CompactMemoryManager<BlockType>::CompactMemoryManager(const CompactMemoryManager<BlockType>& other) :
-            CompactMemoryManager(other.getAllocatedBlockCount())
+            CompactMemoryManager(other.copyOnWrite_ ? 0 : other.getAllocatedBlockCount())
     {
         this->assign(other);
     }
@@ -76,13 +98,7 @@ namespace ds::mm {
     template<typename BlockType>
     CompactMemoryManager<BlockType>::~CompactMemoryManager()
     {
-        // Ensures that destructor of each object is called.
-        CompactMemoryManager<BlockType>::releaseMemory(base_);
-        std::free(base_);
-
-        base_ = nullptr;
-        end_ = nullptr;
-        limit_ = nullptr;
+        this->releaseBuffer();
     }
 
     template<typename BlockType>
@@ -94,9 +110,12 @@ namespace ds::mm {
     template<typename BlockType>
     BlockType* CompactMemoryManager<BlockType>::allocateMemoryAt(size_t index)
     {
+        this->detach();
+
         if (end_ == limit_)
         {
-            this->changeCapacity(2 * this->getAllocatedBlockCount());
+            const size_t doubled = 2 * this->getAllocatedBlockCount();
+            this->changeCapacity(doubled > INIT_SIZE ? doubled : INIT_SIZE);
         }
 
         if (end_ - base_ > static_cast<std::ptrdiff_t>(index))
@@ -117,6 +136,13 @@ namespace ds::mm {
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
     {
+        if (this->isShared())
+        {
+            const std::ptrdiff_t index = pointer - base_;
+            this->detach();
+            pointer = base_ + index;
+        }
+
         BlockType* p = pointer;
         while (p != end_)
         {
@@ -131,6 +157,7 @@ namespace ds::mm {
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::releaseMemoryAt(size_t index)
     {
+        this->detach();
         destroy(&this->getBlockAt(index));
         std::memmove(
                 base_ + index,
@@ -147,19 +174,64 @@ namespace ds::mm {
         this->releaseMemory(end_ - 1);
     }
 
+    template<typename BlockType>
+    bool CompactMemoryManager<BlockType>::allocatesIndividually() const
+    {
+        return false;
+    }
+
     template<typename BlockType>
     size_t CompactMemoryManager<BlockType>::getCapacity() const
     {
         return limit_ - base_;
     }
 
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::setCopyOnWrite(bool copyOnWrite)
+    {
+        copyOnWrite_ = copyOnWrite;
+        if (copyOnWrite_ && sharedCount_ == nullptr)
+        {
+            sharedCount_ = new std::atomic<size_t>(1);
+        }
+        else if (!copyOnWrite_ && !this->isShared())
+        {
+            delete sharedCount_;
+            sharedCount_ = nullptr;
+        }
+    }
+
+    template<typename BlockType>
+    bool CompactMemoryManager<BlockType>::isCopyOnWrite() const
+    {
+        return copyOnWrite_;
+    }
+
+    template<typename BlockType>
+    bool CompactMemoryManager<BlockType>::isShared() const
+    {
+        return sharedCount_ != nullptr && sharedCount_->load(std::memory_order_acquire) > 1;
+    }
+
     template<typename BlockType>
     CompactMemoryManager<BlockType>& CompactMemoryManager<BlockType>::assign
             (const CompactMemoryManager<BlockType>& other)
     {
-        if (this != &other)
+        if (other.copyOnWrite_)
         {
-            this->releaseMemory(base_);
+            this->share(other);
+        }
+        else if (this != &other)
+        {
+            if (this->isShared())
+            {
+                this->releaseBuffer();
+            }
+            else
+            {
+                this->releaseMemory(base_);
+            }
+
             this->allocatedBlockCount_ = other.MemoryManager<BlockType>::allocatedBlockCount_;
             void* newBase = std::realloc(base_, other.getAllocatedCapacitySize());
             if (newBase == nullptr)
@@ -174,6 +246,11 @@ namespace ds::mm {
             {
                 placement_copy(base_ + i, *(other.base_ + i));
             }
+
+            if (copyOnWrite_ && sharedCount_ == nullptr)
+            {
+                sharedCount_ = new std::atomic<size_t>(1);
+            }
         }
         return *this;
     }
@@ -199,6 +276,8 @@ namespace ds::mm {
             return;
         }
 
+        this->detach();
+
         if (newCapacity < this->getAllocatedBlockCount())
         {
             this->releaseMemory(base_ + newCapacity);
@@ -251,6 +330,13 @@ namespace ds::mm {
 
     template<typename BlockType>
     BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index)
+    {
+        this->detach();
+        return *(base_ + index);
+    }
+
+    template<typename BlockType>
+    const BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index) const
     {
         return *(base_ + index);
     }
@@ -273,6 +359,82 @@ namespace ds::mm {
         return (limit_ - base_) * sizeof(BlockType);
     }
 
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::share(const CompactMemoryManager<BlockType>& other)
+    {
+        if (this == &other || (sharedCount_ != nullptr && sharedCount_ == other.sharedCount_))
+        {
+            return;
+        }
+
+        this->releaseBuffer();
+
+        // A copy-on-write manager always has its counter, so the other manager is only read.
+        other.sharedCount_->fetch_add(1, std::memory_order_relaxed);
+        sharedCount_ = other.sharedCount_;
+        base_ = other.base_;
+        end_ = other.end_;
+        limit_ = other.limit_;
+        copyOnWrite_ = true;
+        this->allocatedBlockCount_ = other.getAllocatedBlockCount();
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::detach()
+    {
+        if (this->isShared())
+        {
+            const size_t capacity = this->getCapacity();
+            const size_t count = this->getAllocatedBlockCount();
+            BlockType* newBase = static_cast<BlockType*>(std::malloc(std::max<size_t>(capacity, 1) * sizeof(BlockType)));
+            if (newBase == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                placement_copy(newBase + i, *(base_ + i));
+            }
+
+            // Other owners may have detached in the meantime, so this one may be the last.
+            this->releaseShare(base_, end_);
+            sharedCount_ = copyOnWrite_ ? new std::atomic<size_t>(1) : nullptr;
+            base_ = newBase;
+            end_ = newBase + count;
+            limit_ = newBase + capacity;
+        }
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::releaseBuffer()
+    {
+        this->releaseShare(base_, end_);
+
+        sharedCount_ = nullptr;
+        base_ = nullptr;
+        end_ = nullptr;
+        limit_ = nullptr;
+        this->allocatedBlockCount_ = 0;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::releaseShare(BlockType* base, BlockType* end)
+    {
+        if (sharedCount_ != nullptr && sharedCount_->fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+
+        // Ensures that destructor of each object is called.
+        for (BlockType* p = base; p != end; ++p)
+        {
+            destroy(p);
+        }
+        std::free(base);
+        delete sharedCount_;
+    }
+
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::print(std::ostream& os)
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <libds/heap_monitor.h>
+#include <stdexcept>
 
 namespace ds::mm {
 
@@ -15,6 +16,12 @@ namespace ds::mm {
 		virtual void releaseMemory(BlockType* pointer);
 
 		void releaseAndSetNull(BlockType*& pointer);
+		void transferOwnership(MemoryManager<BlockType>& target, size_t blockCount);
+
+		// Hint that blockCount blocks are going to be allocated in a row.
+		virtual void reserve(size_t blockCount);
+		// Whether every block can be released by any individually allocating manager.
+		virtual bool allocatesIndividually() const;
 
 		size_t getAllocatedBlockCount() const;
 
@@ -55,6 +62,29 @@ namespace ds::mm {
 		pointer = nullptr;
 	}
 
+	template<typename BlockType>
+    void MemoryManager<BlockType>::transferOwnership(MemoryManager<BlockType>& target, size_t blockCount)
+	{
+		if (!this->allocatesIndividually() || !target.allocatesIndividually())
+		{
+			throw std::logic_error("Blocks can only be transferred between individually allocating managers!");
+		}
+
+		allocatedBlockCount_ -= blockCount;
+		target.allocatedBlockCount_ += blockCount;
+	}
+
+	template<typename BlockType>
+    void MemoryManager<BlockType>::reserve(size_t)
+	{
+	}
+
+	template<typename BlockType>
+    bool MemoryManager<BlockType>::allocatesIndividually() const
+	{
+		return true;
+	}
+
 	template<typename BlockType>
     size_t MemoryManager<BlockType>::getAllocatedBlockCount() const
 	{
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <libds/mm/memory_manager.h>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace ds::mm {
+
+    /**
+     * @brief Allocates blocks from large chunks and recycles released blocks.
+     *
+     * Blocks allocated right after reserve(n) occupy one contiguous run of memory.
+     * Chunks are returned to the system only when the manager is destroyed.
+     */
+    template<typename BlockType>
+    class PooledMemoryManager : public MemoryManager<BlockType> {
+    public:
+        PooledMemoryManager();
+        explicit PooledMemoryManager(size_t chunkSize);
+        PooledMemoryManager(const PooledMemoryManager<BlockType>& other) = delete;
+        ~PooledMemoryManager() override;
+
+        BlockType* allocateMemory() override;
+        // Allocates blockCount blocks lying one after another and returns the first of them.
+        BlockType* allocateMemoryRun(size_t blockCount);
+        void releaseMemory(BlockType* pointer) override;
+        void reserve(size_t blockCount) override;
+        bool allocatesIndividually() const override;
+
+        size_t getChunkCount() const;
+
+    private:
+        void addChunk(size_t blockCount);
+
+    private:
+        std::vector<BlockType*> chunks_;
+        std::vector<BlockType*> freeBlocks_;
+        BlockType* next_;
+        BlockType* limit_;
+        size_t reserved_;
+        size_t chunkSize_;
+
+        static const size_t INIT_CHUNK_SIZE = 1024;
+    };
+
+    template<typename BlockType>
+    PooledMemoryManager<BlockType>::PooledMemoryManager() :
+        PooledMemoryManager(INIT_CHUNK_SIZE)
+    {
+    }
+
+    template<typename BlockType>
+    PooledMemoryManager<BlockType>::PooledMemoryManager(size_t chunkSize) :
+        next_(nullptr),
+        limit_(nullptr),
+        reserved_(0),
+        chunkSize_(std::max<size_t>(chunkSize, 1))
+    {
+    }
+
+    template<typename BlockType>
+    PooledMemoryManager<BlockType>::~PooledMemoryManager()
+    {
+        // Blocks still allocated are not destroyed, same as in MemoryManager.
+        for (BlockType* chunk : chunks_)
+        {
+            std::free(chunk);
+        }
+        chunks_.clear();
+        freeBlocks_.clear();
+        next_ = nullptr;
+        limit_ = nullptr;
+    }
+
+    template<typename BlockType>
+    BlockType* PooledMemoryManager<BlockType>::allocateMemory()
+    {
+        BlockType* block;
+        if (reserved_ == 0 && !freeBlocks_.empty())
+        {
+            block = freeBlocks_.back();
+            freeBlocks_.pop_back();
+        }
+        else
+        {
+            if (next_ == limit_)
+            {
+                this->addChunk(chunkSize_);
+            }
+            block = next_++;
+            if (reserved_ > 0)
+            {
+                --reserved_;
+            }
+        }
+
+        ++this->allocatedBlockCount_;
+        return placement_new(block);
+    }
+
+    template<typename BlockType>
+    BlockType* PooledMemoryManager<BlockType>::allocateMemoryRun(size_t blockCount)
+    {
+        if (static_cast<size_t>(limit_ - next_) < blockCount)
+        {
+            this->addChunk(std::max(blockCount, chunkSize_));
+        }
+
+        BlockType* run = next_;
+        try
+        {
+            for (; next_ != run + blockCount; ++next_)
+            {
+                placement_new(next_);
+            }
+        }
+        catch (...)
+        {
+            for (BlockType* block = run; block != next_; ++block)
+            {
+                destroy(block);
+            }
+            next_ = run;
+            throw;
+        }
+
+        reserved_ = reserved_ > blockCount ? reserved_ - blockCount : 0;
+        this->allocatedBlockCount_ += blockCount;
+        return run;
+    }
+
+    template<typename BlockType>
+    void PooledMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
+    {
+        destroy(pointer);
+        freeBlocks_.push_back(pointer);
+        --this->allocatedBlockCount_;
+    }
+
+    template<typename BlockType>
+    void PooledMemoryManager<BlockType>::reserve(size_t blockCount)
+    {
+        if (static_cast<size_t>(limit_ - next_) < blockCount)
+        {
+            this->addChunk(std::max(blockCount, chunkSize_));
+        }
+        reserved_ = blockCount;
+    }
+
+    template<typename BlockType>
+    bool PooledMemoryManager<BlockType>::allocatesIndividually() const
+    {
+        return false;
+    }
+
+    template<typename BlockType>
+    size_t PooledMemoryManager<BlockType>::getChunkCount() const
+    {
+        return chunks_.size();
+    }
+
+    template<typename BlockType>
+    void PooledMemoryManager<BlockType>::addChunk(size_t blockCount)
+    {
+        BlockType* chunk = static_cast<BlockType*>(std::malloc(blockCount * sizeof(BlockType)));
+        if (chunk == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        // The remainder of the current chunk is kept for later allocations.
+        while (next_ != limit_)
+        {
+            freeBlocks_.push_back(next_++);
+        }
+
+        chunks_.push_back(chunk);
+        next_ = chunk;
+        limit_ = chunk + blockCount;
+    }
+}
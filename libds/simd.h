@@ -0,0 +1,869 @@
+#pragma once
+
+#include <libds/constants.h>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DS_SIMD_SSE2
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DS_TARGET_AVX2
+#else
+#define DS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/**
+ * Search and reduction kernels over contiguous arrays of arithmetic values.
+ * int, float and double are vectorized with SSE2 or AVX2 (chosen at runtime),
+ * other types use the scalar loops. Floating point sums are accumulated in a different
+ * order than by the scalar loop and NaNs are not handled by minimum/maximum.
+ * Bit counts of 64-bit words, alone or of their intersection or union, count the bits of bytes in vectors.
+ * Groups of 16 bytes are matched against a byte in a single SSE2 compare, which is as wide as the groups.
+ */
+namespace ds::simd
+{
+    // Number of bytes compared at once by matchBytes and negativeBytes.
+    constexpr unsigned BYTE_GROUP_SIZE = 16;
+
+    template<typename T>
+    using SumType = std::conditional_t<
+        std::is_floating_point_v<T>,
+        std::common_type_t<T, double>,
+        std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>
+    >;
+
+    namespace scalar
+    {
+        template<typename T>
+        size_t find(const T* data, size_t count, T value)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (data[i] == value)
+                {
+                    return i;
+                }
+            }
+            return INVALID_INDEX;
+        }
+
+        template<typename T>
+        size_t count(const T* data, size_t count, T value)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                result += data[i] == value ? 1 : 0;
+            }
+            return result;
+        }
+
+        template<typename T>
+        T minimum(const T* data, size_t count)
+        {
+            T result = data[0];
+            for (size_t i = 1; i < count; ++i)
+            {
+                result = data[i] < result ? data[i] : result;
+            }
+            return result;
+        }
+
+        template<typename T>
+        T maximum(const T* data, size_t count)
+        {
+            T result = data[0];
+            for (size_t i = 1; i < count; ++i)
+            {
+                result = result < data[i] ? data[i] : result;
+            }
+            return result;
+        }
+
+        template<typename T>
+        SumType<T> sum(const T* data, size_t count)
+        {
+            SumType<T> result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                result += static_cast<SumType<T>>(data[i]);
+            }
+            return result;
+        }
+
+        template<typename T>
+        bool containsAny(const T* data, size_t count, const T* values, size_t valueCount)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (size_t j = 0; j < valueCount; ++j)
+                {
+                    if (data[i] == values[j])
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        inline size_t popcount(std::uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_popcountll(word));
+#else
+            word = word - ((word >> 1) & 0x5555555555555555ull);
+            word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+            word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+            return static_cast<size_t>((word * 0x0101010101010101ull) >> 56);
+#endif
+        }
+
+        // Index of the highest set bit, the word must not be zero.
+        constexpr size_t floorLog2(std::uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return sizeof(unsigned long long) * CHAR_BIT - 1 - static_cast<size_t>(__builtin_clzll(word));
+#else
+            size_t result = 0;
+            while (word >>= 1)
+            {
+                ++result;
+            }
+            return result;
+#endif
+        }
+
+        // Index of the lowest set bit, the word must not be zero.
+        constexpr size_t countTrailingZeros(std::uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(word));
+#else
+            size_t result = 0;
+            for (; (word & 1) == 0; word >>= 1)
+            {
+                ++result;
+            }
+            return result;
+#endif
+        }
+
+        inline size_t popcount(const std::uint64_t* words, size_t count)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                result += popcount(words[i]);
+            }
+            return result;
+        }
+
+        inline size_t andPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                result += popcount(a[i] & b[i]);
+            }
+            return result;
+        }
+
+        inline size_t orPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                result += popcount(a[i] | b[i]);
+            }
+            return result;
+        }
+
+        inline unsigned matchBytes(const std::int8_t* bytes, std::int8_t value)
+        {
+            unsigned result = 0;
+            for (unsigned i = 0; i < BYTE_GROUP_SIZE; ++i)
+            {
+                result |= bytes[i] == value ? 1u << i : 0u;
+            }
+            return result;
+        }
+
+        inline unsigned negativeBytes(const std::int8_t* bytes)
+        {
+            unsigned result = 0;
+            for (unsigned i = 0; i < BYTE_GROUP_SIZE; ++i)
+            {
+                result |= bytes[i] < 0 ? 1u << i : 0u;
+            }
+            return result;
+        }
+    }
+
+    namespace details
+    {
+        template<typename T>
+        constexpr bool isVectorizable = std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+        inline size_t bitCount(unsigned mask)
+        {
+            size_t result = 0;
+            for (; mask != 0; mask &= mask - 1)
+            {
+                ++result;
+            }
+            return result;
+        }
+
+#if defined(DS_SIMD_SSE2)
+        inline bool hasAvx2()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            static const bool result = []
+            {
+                int info[4];
+                __cpuid(info, 0);
+                if (info[0] < 7)
+                {
+                    return false;
+                }
+
+                __cpuid(info, 1);
+                const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+                __cpuidex(info, 7, 0);
+                return osSavesYmm && (info[1] & (1 << 5)) != 0;
+            }();
+#else
+            static const bool result = __builtin_cpu_supports("avx2");
+#endif
+            return result;
+        }
+
+        namespace sse2
+        {
+            inline __m128i load(const int* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            inline __m128 load(const float* p) { return _mm_loadu_ps(p); }
+            inline __m128d load(const double* p) { return _mm_loadu_pd(p); }
+
+            inline __m128i broadcast(int v) { return _mm_set1_epi32(v); }
+            inline __m128 broadcast(float v) { return _mm_set1_ps(v); }
+            inline __m128d broadcast(double v) { return _mm_set1_pd(v); }
+
+            inline unsigned equalMask(__m128i a, __m128i b) { return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)))); }
+            inline unsigned equalMask(__m128 a, __m128 b) { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b))); }
+            inline unsigned equalMask(__m128d a, __m128d b) { return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(a, b))); }
+
+            inline __m128i lower(__m128i a, __m128i b)
+            {
+                const __m128i greater = _mm_cmpgt_epi32(a, b);
+                return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+            }
+            inline __m128 lower(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+            inline __m128d lower(__m128d a, __m128d b) { return _mm_min_pd(a, b); }
+
+            inline __m128i upper(__m128i a, __m128i b)
+            {
+                const __m128i greater = _mm_cmpgt_epi32(a, b);
+                return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+            }
+            inline __m128 upper(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+            inline __m128d upper(__m128d a, __m128d b) { return _mm_max_pd(a, b); }
+
+            inline void store(int* p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            inline void store(float* p, __m128 v) { _mm_storeu_ps(p, v); }
+            inline void store(double* p, __m128d v) { _mm_storeu_pd(p, v); }
+
+            // Sums are accumulated in 64-bit lanes, one load of values at a time.
+            inline __m128i zeroSum(const int*) { return _mm_setzero_si128(); }
+            inline __m128d zeroSum(const float*) { return _mm_setzero_pd(); }
+            inline __m128d zeroSum(const double*) { return _mm_setzero_pd(); }
+
+            inline void accumulate(__m128i& sum, const int* p)
+            {
+                const __m128i v = load(p);
+                const __m128i sign = _mm_cmpgt_epi32(_mm_setzero_si128(), v);
+                sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(v, sign));
+                sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(v, sign));
+            }
+            inline void accumulate(__m128d& sum, const float* p)
+            {
+                const __m128 v = load(p);
+                sum = _mm_add_pd(sum, _mm_cvtps_pd(v));
+                sum = _mm_add_pd(sum, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+            }
+            inline void accumulate(__m128d& sum, const double* p) { sum = _mm_add_pd(sum, load(p)); }
+
+            inline long long reduceSum(__m128i sum)
+            {
+                long long lanes[2];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum);
+                return lanes[0] + lanes[1];
+            }
+            inline double reduceSum(__m128d sum)
+            {
+                double lanes[2];
+                _mm_storeu_pd(lanes, sum);
+                return lanes[0] + lanes[1];
+            }
+
+            template<typename T>
+            size_t find(const T* data, size_t count, T value)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                const Vector needle = broadcast(value);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    const unsigned mask = equalMask(load(data + i), needle);
+                    if (mask != 0)
+                    {
+                        return i + scalar::countTrailingZeros(mask);
+                    }
+                }
+
+                const size_t rest = scalar::find(data + i, count - i, value);
+                return rest == INVALID_INDEX ? INVALID_INDEX : i + rest;
+            }
+
+            template<typename T>
+            size_t count(const T* data, size_t count, T value)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                const Vector needle = broadcast(value);
+
+                size_t result = 0;
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    result += bitCount(equalMask(load(data + i), needle));
+                }
+
+                return result + scalar::count(data + i, count - i, value);
+            }
+
+            template<typename T>
+            T minimum(const T* data, size_t count)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                if (count < lanes)
+                {
+                    return scalar::minimum(data, count);
+                }
+
+                Vector result = load(data);
+                size_t i = lanes;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    result = lower(result, load(data + i));
+                }
+
+                T values[lanes];
+                store(values, result);
+                T rest = scalar::minimum(values, lanes);
+                return i < count ? (std::min)(rest, scalar::minimum(data + i, count - i)) : rest;
+            }
+
+            template<typename T>
+            T maximum(const T* data, size_t count)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                if (count < lanes)
+                {
+                    return scalar::maximum(data, count);
+                }
+
+                Vector result = load(data);
+                size_t i = lanes;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    result = upper(result, load(data + i));
+                }
+
+                T values[lanes];
+                store(values, result);
+                T rest = scalar::maximum(values, lanes);
+                return i < count ? (std::max)(rest, scalar::maximum(data + i, count - i)) : rest;
+            }
+
+            template<typename T>
+            SumType<T> sum(const T* data, size_t count)
+            {
+                constexpr size_t lanes = sizeof(decltype(load(data))) / sizeof(T);
+                auto result = zeroSum(data);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    accumulate(result, data + i);
+                }
+
+                return static_cast<SumType<T>>(reduceSum(result)) + scalar::sum(data + i, count - i);
+            }
+
+            template<typename T>
+            bool containsAny(const T* data, size_t count, const T* values, size_t valueCount)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    const Vector block = load(data + i);
+                    for (size_t j = 0; j < valueCount; ++j)
+                    {
+                        if (equalMask(block, broadcast(values[j])) != 0)
+                        {
+                            return true;
+                        }
+                    }
+                }
+
+                return scalar::containsAny(data + i, count - i, values, valueCount);
+            }
+
+            inline __m128i loadWords(const std::uint64_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+
+            // Bits of every byte are counted in parallel and the bytes summed into the two 64-bit lanes.
+            inline __m128i laneBitCounts(__m128i v)
+            {
+                v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi8(0x55)));
+                v = _mm_add_epi8(_mm_and_si128(v, _mm_set1_epi8(0x33)), _mm_and_si128(_mm_srli_epi16(v, 2), _mm_set1_epi8(0x33)));
+                v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi16(v, 4)), _mm_set1_epi8(0x0F));
+                return _mm_sad_epu8(v, _mm_setzero_si128());
+            }
+
+            inline size_t popcount(const std::uint64_t* words, size_t count)
+            {
+                __m128i result = _mm_setzero_si128();
+                size_t i = 0;
+                for (; i + 2 <= count; i += 2)
+                {
+                    result = _mm_add_epi64(result, laneBitCounts(loadWords(words + i)));
+                }
+                return static_cast<size_t>(reduceSum(result)) + scalar::popcount(words + i, count - i);
+            }
+
+            inline size_t andPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+            {
+                __m128i result = _mm_setzero_si128();
+                size_t i = 0;
+                for (; i + 2 <= count; i += 2)
+                {
+                    result = _mm_add_epi64(result, laneBitCounts(_mm_and_si128(loadWords(a + i), loadWords(b + i))));
+                }
+                return static_cast<size_t>(reduceSum(result)) + scalar::andPopcount(a + i, b + i, count - i);
+            }
+
+            inline size_t orPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+            {
+                __m128i result = _mm_setzero_si128();
+                size_t i = 0;
+                for (; i + 2 <= count; i += 2)
+                {
+                    result = _mm_add_epi64(result, laneBitCounts(_mm_or_si128(loadWords(a + i), loadWords(b + i))));
+                }
+                return static_cast<size_t>(reduceSum(result)) + scalar::orPopcount(a + i, b + i, count - i);
+            }
+
+            inline unsigned matchBytes(const std::int8_t* bytes, std::int8_t value)
+            {
+                const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+                return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+            }
+
+            inline unsigned negativeBytes(const std::int8_t* bytes)
+            {
+                return static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes))));
+            }
+        }
+
+        namespace avx2
+        {
+            DS_TARGET_AVX2 inline __m256i load(const int* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            DS_TARGET_AVX2 inline __m256 load(const float* p) { return _mm256_loadu_ps(p); }
+            DS_TARGET_AVX2 inline __m256d load(const double* p) { return _mm256_loadu_pd(p); }
+
+            DS_TARGET_AVX2 inline __m256i broadcast(int v) { return _mm256_set1_epi32(v); }
+            DS_TARGET_AVX2 inline __m256 broadcast(float v) { return _mm256_set1_ps(v); }
+            DS_TARGET_AVX2 inline __m256d broadcast(double v) { return _mm256_set1_pd(v); }
+
+            DS_TARGET_AVX2 inline unsigned equalMask(__m256i a, __m256i b) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)))); }
+            DS_TARGET_AVX2 inline unsigned equalMask(__m256 a, __m256 b) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ))); }
+            DS_TARGET_AVX2 inline unsigned equalMask(__m256d a, __m256d b) { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ))); }
+
+            DS_TARGET_AVX2 inline __m256i lower(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+            DS_TARGET_AVX2 inline __m256 lower(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+            DS_TARGET_AVX2 inline __m256d lower(__m256d a, __m256d b) { return _mm256_min_pd(a, b); }
+
+            DS_TARGET_AVX2 inline __m256i upper(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+            DS_TARGET_AVX2 inline __m256 upper(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+            DS_TARGET_AVX2 inline __m256d upper(__m256d a, __m256d b) { return _mm256_max_pd(a, b); }
+
+            DS_TARGET_AVX2 inline void store(int* p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+            DS_TARGET_AVX2 inline void store(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+            DS_TARGET_AVX2 inline void store(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+
+            // Sums are accumulated in 64-bit lanes, one load of values at a time.
+            DS_TARGET_AVX2 inline __m256i zeroSum(const int*) { return _mm256_setzero_si256(); }
+            DS_TARGET_AVX2 inline __m256d zeroSum(const float*) { return _mm256_setzero_pd(); }
+            DS_TARGET_AVX2 inline __m256d zeroSum(const double*) { return _mm256_setzero_pd(); }
+
+            DS_TARGET_AVX2 inline void accumulate(__m256i& sum, const int* p)
+            {
+                sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+                sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4))));
+            }
+            DS_TARGET_AVX2 inline void accumulate(__m256d& sum, const float* p)
+            {
+                sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm_loadu_ps(p)));
+                sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm_loadu_ps(p + 4)));
+            }
+            DS_TARGET_AVX2 inline void accumulate(__m256d& sum, const double* p) { sum = _mm256_add_pd(sum, load(p)); }
+
+            DS_TARGET_AVX2 inline long long reduceSum(__m256i sum)
+            {
+                long long lanes[4];
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), sum);
+                return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            }
+            DS_TARGET_AVX2 inline double reduceSum(__m256d sum)
+            {
+                double lanes[4];
+                _mm256_storeu_pd(lanes, sum);
+                return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            }
+
+            template<typename T>
+            DS_TARGET_AVX2 size_t find(const T* data, size_t count, T value)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                const Vector needle = broadcast(value);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    const unsigned mask = equalMask(load(data + i), needle);
+                    if (mask != 0)
+                    {
+                        return i + scalar::countTrailingZeros(mask);
+                    }
+                }
+
+                const size_t rest = scalar::find(data + i, count - i, value);
+                return rest == INVALID_INDEX ? INVALID_INDEX : i + rest;
+            }
+
+            template<typename T>
+            DS_TARGET_AVX2 size_t count(const T* data, size_t count, T value)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                const Vector needle = broadcast(value);
+
+                size_t result = 0;
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    result += bitCount(equalMask(load(data + i), needle));
+                }
+
+                return result + scalar::count(data + i, count - i, value);
+            }
+
+            template<typename T>
+            DS_TARGET_AVX2 T minimum(const T* data, size_t count)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                if (count < lanes)
+                {
+                    return scalar::minimum(data, count);
+                }
+
+                Vector result = load(data);
+                size_t i = lanes;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    result = lower(result, load(data + i));
+                }
+
+                T values[lanes];
+                store(values, result);
+                T rest = scalar::minimum(values, lanes);
+                return i < count ? (std::min)(rest, scalar::minimum(data + i, count - i)) : rest;
+            }
+
+            template<typename T>
+            DS_TARGET_AVX2 T maximum(const T* data, size_t count)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+                if (count < lanes)
+                {
+                    return scalar::maximum(data, count);
+                }
+
+                Vector result = load(data);
+                size_t i = lanes;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    result = upper(result, load(data + i));
+                }
+
+                T values[lanes];
+                store(values, result);
+                T rest = scalar::maximum(values, lanes);
+                return i < count ? (std::max)(rest, scalar::maximum(data + i, count - i)) : rest;
+            }
+
+            template<typename T>
+            DS_TARGET_AVX2 SumType<T> sum(const T* data, size_t count)
+            {
+                constexpr size_t lanes = sizeof(decltype(load(data))) / sizeof(T);
+                auto result = zeroSum(data);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    accumulate(result, data + i);
+                }
+
+                return static_cast<SumType<T>>(reduceSum(result)) + scalar::sum(data + i, count - i);
+            }
+
+            template<typename T>
+            DS_TARGET_AVX2 bool containsAny(const T* data, size_t count, const T* values, size_t valueCount)
+            {
+                using Vector = decltype(load(data));
+                constexpr size_t lanes = sizeof(Vector) / sizeof(T);
+
+                size_t i = 0;
+                for (; i + lanes <= count; i += lanes)
+                {
+                    const Vector block = load(data + i);
+                    for (size_t j = 0; j < valueCount; ++j)
+                    {
+                        if (equalMask(block, broadcast(values[j])) != 0)
+                        {
+                            return true;
+                        }
+                    }
+                }
+
+                return scalar::containsAny(data + i, count - i, values, valueCount);
+            }
+
+            DS_TARGET_AVX2 inline __m256i loadWords(const std::uint64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+
+            // Bits of both nibbles of every byte are looked up in a shuffle and the bytes summed into the four 64-bit lanes.
+            DS_TARGET_AVX2 inline __m256i laneBitCounts(__m256i v)
+            {
+                const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+                const __m256i nibble = _mm256_set1_epi8(0x0F);
+                const __m256i counts = _mm256_add_epi8(
+                    _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble)),
+                    _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble)));
+                return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+            }
+
+            DS_TARGET_AVX2 inline size_t popcount(const std::uint64_t* words, size_t count)
+            {
+                __m256i result = _mm256_setzero_si256();
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4)
+                {
+                    result = _mm256_add_epi64(result, laneBitCounts(loadWords(words + i)));
+                }
+                return static_cast<size_t>(reduceSum(result)) + scalar::popcount(words + i, count - i);
+            }
+
+            DS_TARGET_AVX2 inline size_t andPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+            {
+                __m256i result = _mm256_setzero_si256();
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4)
+                {
+                    result = _mm256_add_epi64(result, laneBitCounts(_mm256_and_si256(loadWords(a + i), loadWords(b + i))));
+                }
+                return static_cast<size_t>(reduceSum(result)) + scalar::andPopcount(a + i, b + i, count - i);
+            }
+
+            DS_TARGET_AVX2 inline size_t orPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+            {
+                __m256i result = _mm256_setzero_si256();
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4)
+                {
+                    result = _mm256_add_epi64(result, laneBitCounts(_mm256_or_si256(loadWords(a + i), loadWords(b + i))));
+                }
+                return static_cast<size_t>(reduceSum(result)) + scalar::orPopcount(a + i, b + i, count - i);
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief Returns index of the first @p value in @p data or INVALID_INDEX.
+     */
+    template<typename T>
+    size_t find(const T* data, size_t count, T value)
+    {
+#if defined(DS_SIMD_SSE2)
+        if constexpr (details::isVectorizable<T>)
+        {
+            return details::hasAvx2() ? details::avx2::find(data, count, value) : details::sse2::find(data, count, value);
+        }
+#endif
+        return scalar::find(data, count, value);
+    }
+
+    /**
+     * @brief Returns number of occurrences of @p value in @p data.
+     */
+    template<typename T>
+    size_t count(const T* data, size_t count, T value)
+    {
+#if defined(DS_SIMD_SSE2)
+        if constexpr (details::isVectorizable<T>)
+        {
+            return details::hasAvx2() ? details::avx2::count(data, count, value) : details::sse2::count(data, count, value);
+        }
+#endif
+        return scalar::count(data, count, value);
+    }
+
+    /**
+     * @brief Returns the smallest value of non-empty @p data.
+     */
+    template<typename T>
+    T minimum(const T* data, size_t count)
+    {
+#if defined(DS_SIMD_SSE2)
+        if constexpr (details::isVectorizable<T>)
+        {
+            return details::hasAvx2() ? details::avx2::minimum(data, count) : details::sse2::minimum(data, count);
+        }
+#endif
+        return scalar::minimum(data, count);
+    }
+
+    /**
+     * @brief Returns the greatest value of non-empty @p data.
+     */
+    template<typename T>
+    T maximum(const T* data, size_t count)
+    {
+#if defined(DS_SIMD_SSE2)
+        if constexpr (details::isVectorizable<T>)
+        {
+            return details::hasAvx2() ? details::avx2::maximum(data, count) : details::sse2::maximum(data, count);
+        }
+#endif
+        return scalar::maximum(data, count);
+    }
+
+    /**
+     * @brief Returns sum of @p data in a type wide enough for the values.
+     */
+    template<typename T>
+    SumType<T> sum(const T* data, size_t count)
+    {
+#if defined(DS_SIMD_SSE2)
+        if constexpr (details::isVectorizable<T>)
+        {
+            return details::hasAvx2() ? details::avx2::sum(data, count) : details::sse2::sum(data, count);
+        }
+#endif
+        return scalar::sum(data, count);
+    }
+
+    /**
+     * @brief Checks whether @p data contains at least one of @p values.
+     */
+    template<typename T>
+    bool containsAny(const T* data, size_t count, const T* values, size_t valueCount)
+    {
+#if defined(DS_SIMD_SSE2)
+        if constexpr (details::isVectorizable<T>)
+        {
+            return details::hasAvx2()
+                ? details::avx2::containsAny(data, count, values, valueCount)
+                : details::sse2::containsAny(data, count, values, valueCount);
+        }
+#endif
+        return scalar::containsAny(data, count, values, valueCount);
+    }
+
+    /**
+     * @brief Returns number of set bits of @p words.
+     */
+    inline size_t popcount(const std::uint64_t* words, size_t count)
+    {
+#if defined(DS_SIMD_SSE2)
+        return details::hasAvx2() ? details::avx2::popcount(words, count) : details::sse2::popcount(words, count);
+#else
+        return scalar::popcount(words, count);
+#endif
+    }
+
+    /**
+     * @brief Returns number of bits set in both @p a and @p b.
+     */
+    inline size_t andPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+    {
+#if defined(DS_SIMD_SSE2)
+        return details::hasAvx2() ? details::avx2::andPopcount(a, b, count) : details::sse2::andPopcount(a, b, count);
+#else
+        return scalar::andPopcount(a, b, count);
+#endif
+    }
+
+    /**
+     * @brief Returns number of bits set in @p a or @p b.
+     */
+    inline size_t orPopcount(const std::uint64_t* a, const std::uint64_t* b, size_t count)
+    {
+#if defined(DS_SIMD_SSE2)
+        return details::hasAvx2() ? details::avx2::orPopcount(a, b, count) : details::sse2::orPopcount(a, b, count);
+#else
+        return scalar::orPopcount(a, b, count);
+#endif
+    }
+
+    /**
+     * @brief Returns a mask with bit i set if the i-th of BYTE_GROUP_SIZE @p bytes equals @p value.
+     */
+    inline unsigned matchBytes(const std::int8_t* bytes, std::int8_t value)
+    {
+#if defined(DS_SIMD_SSE2)
+        return details::sse2::matchBytes(bytes, value);
+#else
+        return scalar::matchBytes(bytes, value);
+#endif
+    }
+
+    /**
+     * @brief Returns a mask with bit i set if the i-th of BYTE_GROUP_SIZE @p bytes is negative.
+     */
+    inline unsigned negativeBytes(const std::int8_t* bytes)
+    {
+#if defined(DS_SIMD_SSE2)
+        return details::sse2::negativeBytes(bytes);
+#else
+        return scalar::negativeBytes(bytes);
+#endif
+    }
+}
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ds
+{
+    /**
+     * @brief Fork-join thread pool in which every thread owns a deque of tasks.
+     *
+     * A thread pushes and pops its own tasks at the back of its deque, so it continues
+     * with the most recently forked (smallest, cache-warm) work. Idle threads steal
+     * from the front of the other deques, which holds the oldest (largest) work.
+     * The thread waiting for a task group runs tasks as well, so nested forks cannot deadlock.
+     * The pool with thread count t starts t - 1 workers, the waiting thread is the t-th.
+     */
+    class WorkStealingPool
+    {
+    public:
+        /**
+         * @brief Tasks forked together. Must outlive the tasks and be waited for before it is destroyed.
+         */
+        class TaskGroup
+        {
+        public:
+            TaskGroup();
+
+        private:
+            std::atomic<size_t> pendingCount_;
+            std::mutex exceptionMutex_;
+            std::exception_ptr exception_;
+
+            friend class WorkStealingPool;
+        };
+
+        explicit WorkStealingPool(size_t threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1));
+        WorkStealingPool(const WorkStealingPool& other) = delete;
+        ~WorkStealingPool();
+
+        WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+
+        size_t getThreadCount() const;
+
+        void fork(TaskGroup& group, std::function<void()> task);
+        // Runs tasks until all tasks of the group finish, then rethrows the first exception thrown by them.
+        void wait(TaskGroup& group);
+
+    private:
+        struct Task
+        {
+            std::function<void()> function_;
+            TaskGroup* group_;
+        };
+
+        struct TaskDeque
+        {
+            std::mutex mutex_;
+            std::deque<Task> tasks_;
+        };
+
+        void work(size_t dequeIndex);
+        bool tryRunTask(size_t dequeIndex);
+        bool tryPopOwn(size_t dequeIndex, Task& task);
+        bool trySteal(size_t thiefIndex, Task& task);
+        void run(Task& task);
+        size_t currentDequeIndex() const;
+
+        // Failed attempts to run a task after which a waiting thread sleeps until a task is queued or its group finishes.
+        static const size_t WAIT_SPIN_COUNT = 64;
+
+        std::vector<std::unique_ptr<TaskDeque>> deques_;
+        std::vector<std::thread> workers_;
+
+        std::mutex sleepMutex_;
+        std::condition_variable wakeUp_;
+        std::atomic<size_t> queuedCount_;
+        bool stopping_;
+
+        // Deque of the current thread if it is a worker of this pool. Other threads share deque 0.
+        static thread_local const WorkStealingPool* currentPool_;
+        static thread_local size_t currentIndex_;
+    };
+
+    //----------
+
+    inline WorkStealingPool::TaskGroup::TaskGroup() :
+        pendingCount_(0)
+    {
+    }
+
+    //----------
+
+    inline thread_local const WorkStealingPool* WorkStealingPool::currentPool_ = nullptr;
+    inline thread_local size_t WorkStealingPool::currentIndex_ = 0;
+
+    inline WorkStealingPool::WorkStealingPool(size_t threadCount) :
+        queuedCount_(0),
+        stopping_(false)
+    {
+        threadCount = std::max<size_t>(threadCount, 1);
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            deques_.push_back(std::make_unique<TaskDeque>());
+        }
+        for (size_t i = 1; i < threadCount; ++i)
+        {
+            workers_.emplace_back([this, i]() { this->work(i); });
+        }
+    }
+
+    inline WorkStealingPool::~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stopping_ = true;
+        }
+        wakeUp_.notify_all();
+        for (std::thread& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    inline size_t WorkStealingPool::getThreadCount() const
+    {
+        return deques_.size();
+    }
+
+    inline void WorkStealingPool::fork(TaskGroup& group, std::function<void()> task)
+    {
+        group.pendingCount_.fetch_add(1, std::memory_order_relaxed);
+        {
+            // Incremented under the lock, so a worker cannot miss it between its check and its wait,
+            // and before the task is published, so the decrement after its pop cannot precede it.
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            queuedCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        TaskDeque& deque = *deques_[this->currentDequeIndex()];
+        {
+            std::lock_guard<std::mutex> lock(deque.mutex_);
+            deque.tasks_.push_back({ std::move(task), &group });
+        }
+        wakeUp_.notify_one();
+    }
+
+    inline void WorkStealingPool::wait(TaskGroup& group)
+    {
+        const size_t dequeIndex = this->currentDequeIndex();
+        size_t failedCount = 0;
+        while (group.pendingCount_.load(std::memory_order_acquire) > 0)
+        {
+            if (this->tryRunTask(dequeIndex))
+            {
+                failedCount = 0;
+            }
+            else if (++failedCount < WAIT_SPIN_COUNT)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex_);
+                wakeUp_.wait(lock, [this, &group]()
+                    {
+                        return group.pendingCount_.load(std::memory_order_acquire) == 0 || queuedCount_.load(std::memory_order_relaxed) > 0;
+                    });
+                failedCount = 0;
+            }
+        }
+
+        if (group.exception_ != nullptr)
+        {
+            std::exception_ptr exception = group.exception_;
+            group.exception_ = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+    inline void WorkStealingPool::work(size_t dequeIndex)
+    {
+        currentPool_ = this;
+        currentIndex_ = dequeIndex;
+        while (true)
+        {
+            if (this->tryRunTask(dequeIndex))
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            wakeUp_.wait(lock, [this]() { return stopping_ || queuedCount_.load(std::memory_order_relaxed) > 0; });
+            if (stopping_)
+            {
+                return;
+            }
+        }
+    }
+
+    inline bool WorkStealingPool::tryRunTask(size_t dequeIndex)
+    {
+        Task task;
+        if (this->tryPopOwn(dequeIndex, task) || this->trySteal(dequeIndex, task))
+        {
+            queuedCount_.fetch_sub(1, std::memory_order_relaxed);
+            this->run(task);
+            return true;
+        }
+        return false;
+    }
+
+    inline bool WorkStealingPool::tryPopOwn(size_t dequeIndex, Task& task)
+    {
+        TaskDeque& deque = *deques_[dequeIndex];
+        std::lock_guard<std::mutex> lock(deque.mutex_);
+        if (deque.tasks_.empty())
+        {
+            return false;
+        }
+        task = std::move(deque.tasks_.back());
+        deque.tasks_.pop_back();
+        return true;
+    }
+
+    inline bool WorkStealingPool::trySteal(size_t thiefIndex, Task& task)
+    {
+        const size_t dequeCount = deques_.size();
+        for (size_t offset = 1; offset < dequeCount; ++offset)
+        {
+            TaskDeque& deque = *deques_[(thiefIndex + offset) % dequeCount];
+            std::lock_guard<std::mutex> lock(deque.mutex_);
+            if (!deque.tasks_.empty())
+            {
+                task = std::move(deque.tasks_.front());
+                deque.tasks_.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline void WorkStealingPool::run(Task& task)
+    {
+        TaskGroup& group = *task.group_;
+        try
+        {
+            task.function_();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(group.exceptionMutex_);
+            if (group.exception_ == nullptr)
+            {
+                group.exception_ = std::current_exception();
+            }
+        }
+        if (group.pendingCount_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // The group must not be touched from here on, its waiter may already have returned.
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex_);
+            }
+            wakeUp_.notify_all();
+        }
+    }
+
+    inline size_t WorkStealingPool::currentDequeIndex() const
+    {
+        return currentPool_ == this ? currentIndex_ : 0;
+    }
+}
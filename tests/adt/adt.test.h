@@ -2,6 +2,7 @@
 
 #include <tests/_details/test.hpp>
 #include <tests/adt/array.test.h>
+#include <tests/adt/disjoint_sets.test.h>
 #include <tests/adt/list.test.h>
 #include <tests/adt/priority_queue.test.h>
 #include <tests/adt/queue.test.h>
@@ -26,6 +27,7 @@ namespace ds::tests
             this->add_test(std::make_unique<TableTest>());
             this->add_test(std::make_unique<TreeTest>());
             this->add_test(std::make_unique<SortTest>());
+            this->add_test(std::make_unique<DisjointSetsTest>());
         }
     };
 }
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/adt/disjoint_sets.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests unions and finds against relabelling of an array of set labels.
+     */
+    class DisjointSetsTestUnite : public LeafTest
+    {
+    public:
+        DisjointSetsTestUnite() :
+            LeafTest("unite")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 1000;
+
+            adt::DisjointSets sets(n);
+            std::vector<size_t> labels(n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                labels[i] = i;
+            }
+            this->assert_equals(n, sets.setCount());
+
+            std::default_random_engine rng(144);
+            size_t setCount = n;
+            bool matches = true;
+            for (int i = 0; i < 3000; ++i)
+            {
+                const size_t a = rng() % n;
+                const size_t b = rng() % n;
+                const size_t labelA = labels[a];
+                const size_t labelB = labels[b];
+                matches = matches && sets.connected(a, b) == (labelA == labelB);
+                matches = matches && sets.unite(a, b) == (labelA != labelB);
+                if (labelA != labelB)
+                {
+                    for (size_t& label : labels)
+                    {
+                        label = label == labelB ? labelA : label;
+                    }
+                    --setCount;
+                }
+                matches = matches && sets.setCount() == setCount;
+            }
+            this->assert_true(matches, "Sets are merged like the labels.");
+
+            bool representatives = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                const size_t root = sets.find(i);
+                representatives = representatives && labels[root] == labels[i] && sets.find(root) == root;
+            }
+            this->assert_true(representatives, "Representative lies in the set of the element.");
+
+            this->assert_throws([&sets]() { sets.find(n); });
+            this->assert_throws([&sets]() { sets.unite(0, n); });
+        }
+    };
+
+    /**
+     * @brief Tests adding elements, copying, assignment, equality and clearing.
+     */
+    class DisjointSetsTestCopyAssignEquals : public LeafTest
+    {
+    public:
+        DisjointSetsTestCopyAssignEquals() :
+            LeafTest("copy-assign-equals")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            adt::DisjointSets sets;
+            this->assert_true(sets.isEmpty(), "Default sets are empty.");
+            for (size_t i = 0; i < 6; ++i)
+            {
+                this->assert_equals(i, sets.add());
+            }
+            sets.unite(0, 1);
+            sets.unite(2, 3);
+            sets.unite(1, 3);
+
+            adt::DisjointSets copy(sets);
+            this->assert_true(copy.equals(sets), "Copy has the same partition.");
+            this->assert_equals(static_cast<size_t>(3), copy.setCount());
+
+            // Same partition by different unions has different representatives.
+            adt::DisjointSets other(6);
+            other.unite(3, 2);
+            other.unite(0, 2);
+            other.unite(1, 0);
+            this->assert_true(other.equals(sets), "Same partition by other unions is equal.");
+            other.unite(4, 5);
+            this->assert_false(other.equals(sets), "Partitions differ.");
+            copy.unite(4, 0);
+            this->assert_false(copy.equals(other), "Partitions with the same set count differ.");
+
+            copy.assign(other);
+            this->assert_true(copy.equals(other), "Assigned sets are equal.");
+            copy.clear();
+            this->assert_true(copy.isEmpty(), "Cleared sets are empty.");
+            this->assert_equals(static_cast<size_t>(0), copy.setCount());
+        }
+    };
+
+    /**
+     * @brief All disjoint sets tests.
+     */
+    class DisjointSetsTest : public CompositeTest
+    {
+    public:
+        DisjointSetsTest() :
+            CompositeTest("DisjointSets")
+        {
+            this->add_test(std::make_unique<DisjointSetsTestUnite>());
+            this->add_test(std::make_unique<DisjointSetsTestCopyAssignEquals>());
+        }
+    };
+}
@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <functional>
 #include <libds/amt/implicit_sequence.h>
+#include <libds/amt/explicit_sequence.h>
 #include <libds/adt/sorts.h>
 #include <random>
 #include <string>
+#include <vector>
 #include <tests/_details/test.hpp>
 
 namespace ds::tests
@@ -243,6 +245,78 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests in-place sorting of a linked sequence
+     * @tparam SequenceT Type of the linked sequence
+     * @tparam Comparator Comparator type
+     */
+    template<class SequenceT, class Comparator>
+    class LinkedSortTest : public LeafTest
+    {
+    public:
+        LinkedSortTest(const std::string& name, std::mt19937_64& seeder, Comparator cmp, size_t elementCount) :
+            LeafTest(name),
+            rngKey_(seeder()),
+            cmp_(std::move(cmp)),
+            elementCount_(elementCount)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            SequenceT seq;
+            std::uniform_int_distribution<int> distKey(0, static_cast<int>(elementCount_));
+            for (size_t i = 0; i < elementCount_; ++i)
+            {
+                seq.insertLast().data_ = distKey(rngKey_);
+            }
+
+            std::vector<const void*> blocksBefore;
+            seq.processAllBlocksForward([&](auto* b) { blocksBefore.push_back(b); });
+
+            adt::LinkedMergeSort<int>().sort(seq, cmp_);
+
+            std::vector<int> keys;
+            std::vector<const void*> blocksAfter;
+            seq.processAllBlocksForward([&](auto* b) { keys.push_back(b->data_); blocksAfter.push_back(b); });
+            this->assert_true(std::is_sorted(keys.begin(), keys.end(), cmp_), "Is sorted.");
+            this->assert_equals(elementCount_, seq.size());
+
+            std::sort(blocksBefore.begin(), blocksBefore.end());
+            std::sort(blocksAfter.begin(), blocksAfter.end());
+            this->assert_true(blocksBefore == blocksAfter, "Blocks are relinked, not copied.");
+
+            std::vector<int> keysBackward;
+            seq.processAllBlocksBackward([&](auto* b) { keysBackward.insert(keysBackward.begin(), b->data_); });
+            this->assert_true(keys == keysBackward, "Backward links are consistent.");
+        }
+
+    private:
+        std::mt19937_64 rngKey_;
+        Comparator cmp_;
+        size_t elementCount_;
+    };
+
+    /**
+     * @brief Tests for linked merge sort
+     */
+    class LinkedMergeSortTest : public CompositeTest
+    {
+    public:
+        LinkedMergeSortTest(std::mt19937_64& seeder, std::initializer_list<int> elementCounts) :
+            CompositeTest("LinkedMergeSort")
+        {
+            for (auto const n : elementCounts)
+            {
+                this->add_test(std::make_unique<LinkedSortTest<amt::SinglyLS<int>, std::less<>>>("singly-asc-" + std::to_string(n), seeder, std::less<>(), n));
+                this->add_test(std::make_unique<LinkedSortTest<amt::SinglyLS<int>, std::greater<>>>("singly-desc-" + std::to_string(n), seeder, std::greater<>(), n));
+                this->add_test(std::make_unique<LinkedSortTest<amt::DoublyLS<int>, std::less<>>>("doubly-asc-" + std::to_string(n), seeder, std::less<>(), n));
+                this->add_test(std::make_unique<LinkedSortTest<amt::DoublyLS<int>, std::greater<>>>("doubly-desc-" + std::to_string(n), seeder, std::greater<>(), n));
+            }
+        }
+    };
+
     /**
      * @brief All sort tests
      */
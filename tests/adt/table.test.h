@@ -2,8 +2,10 @@
 
 #include <algorithm>
 #include <libds/adt/table.h>
+#include <cstdint>
 #include <memory>
 #include <random>
+#include <unordered_map>
 #include <unordered_set>
 #include <tests/_details/test.hpp>
 
@@ -501,6 +503,283 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests lookups in a frozen sorted sequence table
+     */
+    class SortedSequenceTableTestFreeze : public details::TableTestBase<adt::SortedSequenceTable<int, int>>
+    {
+    public:
+        SortedSequenceTableTestFreeze() :
+            details::TableTestBase<adt::SortedSequenceTable<int, int>>("freeze", 597)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto table = adt::SortedSequenceTable<int, int>();
+            table.freeze();
+            this->assert_false(table.contains(0), "Empty frozen table contains nothing.");
+
+            bool found = true;
+            for (auto const n : { 1, 2, 3, 7, 8, 100, 1000 })
+            {
+                table.clear();
+                this->assert_false(table.isFrozen(), "Clear drops the index.");
+                for (auto const key : this->generateKeys(n))
+                {
+                    table.insert(2 * key, key);
+                }
+                table.freeze();
+                this->assert_true(table.isFrozen(), "Table is frozen.");
+
+                for (auto key = -1; key <= 2 * n; ++key)
+                {
+                    auto* data = static_cast<int*>(nullptr);
+                    auto const contains = table.tryFind(key, data);
+                    found = found && contains == (key >= 0 && key % 2 == 0 && key < 2 * n);
+                    found = found && (!contains || *data == key / 2);
+                }
+            }
+            this->assert_true(found, "Frozen table finds exactly the inserted keys.");
+
+            auto copy = table;
+            this->assert_true(copy.isFrozen() && copy.contains(0) && copy.equals(table), "Copy keeps the index.");
+
+            table.insert(-2, -1);
+            this->assert_false(table.isFrozen(), "Insert drops the index.");
+            table.freeze();
+            this->assert_equals(-1, table.find(-2));
+            this->assert_equals(999, table.remove(1998));
+            this->assert_false(table.isFrozen(), "Remove drops the index.");
+            this->assert_false(table.contains(1998), "Removed key is gone.");
+        }
+    };
+
+    /**
+     * @brief Tests probing of a flat hash table through full groups, deleted slots and rehashing
+     */
+    class FlatHashTableTestProbing : public details::TableTestBase<adt::FlatHashTable<int, int>>
+    {
+    public:
+        FlatHashTableTestProbing() :
+            details::TableTestBase<adt::FlatHashTable<int, int>>("probing", 369)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using TableType = adt::FlatHashTable<int, int>;
+
+            // Group kernels against the scalar loops, on control bytes of all kinds.
+            auto distControl = std::uniform_int_distribution<int>(-3, 5);
+            bool kernels = true;
+            for (auto i = 0; i < 1000; ++i)
+            {
+                std::int8_t group[simd::BYTE_GROUP_SIZE];
+                for (auto& control : group)
+                {
+                    auto const value = distControl(this->rngKey_);
+                    control = static_cast<std::int8_t>(value == -3 ? -128 : value);
+                }
+                kernels = kernels && simd::negativeBytes(group) == simd::scalar::negativeBytes(group);
+                for (auto const value : { -128, -2, 0, 5 })
+                {
+                    kernels = kernels && simd::matchBytes(group, static_cast<std::int8_t>(value)) == simd::scalar::matchBytes(group, static_cast<std::int8_t>(value));
+                }
+            }
+            this->assert_true(kernels, "Group kernels match the scalar loops.");
+
+            // Colliding keys share their first group and control byte, so probes go through many groups.
+            auto table = TableType([](const int&) { return static_cast<size_t>(0); }, 16);
+            auto keys = this->generateKeys(300);
+            for (auto const key : keys)
+            {
+                table.insert(key, key);
+            }
+            this->assert_true(hasKeys(table, keys), "Colliding keys are found.");
+            for (size_t i = 0; i < keys.size(); i += 2)
+            {
+                table.remove(keys[i]);
+            }
+            bool found = true;
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                found = found && table.contains(keys[i]) == (i % 2 == 1);
+            }
+            this->assert_true(found, "Colliding keys are found past deleted slots.");
+
+            // Random operations on few keys against a reference, with a weak and with the default hash.
+            for (auto const weak : { true, false })
+            {
+                auto churned = weak
+                    ? TableType([](const int& key) { return static_cast<size_t>(key % 4); }, 16)
+                    : TableType();
+                auto reference = std::unordered_map<int, int>();
+                auto distKey = std::uniform_int_distribution<int>(0, 999);
+                bool consistent = true;
+                size_t maxCapacity = 0;
+                for (auto i = 0; i < 50000; ++i)
+                {
+                    auto const key = distKey(this->rngKey_);
+                    if (reference.count(key) == 0)
+                    {
+                        churned.insert(key, i);
+                        reference[key] = i;
+                    }
+                    else if (i % 3 != 0)
+                    {
+                        consistent = consistent && churned.remove(key) == reference[key];
+                        reference.erase(key);
+                    }
+                    else
+                    {
+                        consistent = consistent && churned.find(key) == reference[key];
+                    }
+                    consistent = consistent && churned.size() == reference.size();
+                    maxCapacity = std::max(maxCapacity, churned.capacity());
+                }
+
+                for (auto const& item : churned)
+                {
+                    consistent = consistent && reference.count(item.key_) == 1 && reference[item.key_] == item.data_;
+                    reference.erase(item.key_);
+                }
+                this->assert_true(consistent && reference.empty(), "Table matches the reference.");
+                this->assert_true(maxCapacity <= 4096, "Deleted slots do not grow the table.");
+
+                auto copy = churned;
+                this->assert_true(copy.equals(churned), "Copy is equal.");
+                churned.clear();
+                this->assert_true(churned.isEmpty() && !churned.contains(0) && !copy.isEmpty(), "Cleared table is empty.");
+            }
+        }
+    };
+
+    /**
+     * @brief All flat hash table tests
+     */
+    class FlatHashTableTest : public GeneralTableTest<adt::FlatHashTable<int, int>>
+    {
+    public:
+        FlatHashTableTest() :
+            GeneralTableTest<adt::FlatHashTable<int, int>>("FlatHashTable")
+        {
+            this->add_test(std::make_unique<FlatHashTableTestProbing>());
+        }
+    };
+
+    namespace details
+    {
+        /**
+         * @brief Binary search tree with its rotations exposed.
+         * @tparam TreeT Binary search tree type
+         */
+        template<class TreeT>
+        class RotatableBinarySearchTree : public TreeT
+        {
+        public:
+            using BSTNodeType = typename TreeT::BSTNodeType;
+
+            using TreeT::getHierarchy;
+            using TreeT::rotateLeft;
+            using TreeT::rotateRight;
+
+            BSTNodeType* insertLeaf(int key)
+            {
+                auto* hierarchy = this->getHierarchy();
+                auto* node = hierarchy->accessRoot();
+                if (node == nullptr)
+                {
+                    node = &hierarchy->emplaceRoot();
+                }
+                else
+                {
+                    auto* son = hierarchy->accessSon(*node, key < node->data_.key_ ? 0 : 1);
+                    while (son != nullptr)
+                    {
+                        node = son;
+                        son = hierarchy->accessSon(*node, key < node->data_.key_ ? 0 : 1);
+                    }
+                    node = &hierarchy->emplaceSon(*node, key < node->data_.key_ ? 0 : 1);
+                }
+                node->data_.key_ = key;
+                node->data_.data_ = key;
+                return node;
+            }
+        };
+    }
+
+    /**
+     * @brief Tests that binary search tree rotations keep the in-order sequence and parent links
+     * @tparam TreeT Binary search tree type
+     */
+    template<class TreeT>
+    class BinarySearchTreeTestRotations : public LeafTest
+    {
+    public:
+        BinarySearchTreeTestRotations(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    private:
+        using TreeType = details::RotatableBinarySearchTree<TreeT>;
+
+    protected:
+        void test() override
+        {
+            auto tree = TreeType();
+            std::vector<typename TreeType::BSTNodeType*> nodes(8, nullptr);
+            for (auto const key : { 4, 2, 6, 1, 3, 5, 7 })
+            {
+                nodes[key] = tree.insertLeaf(key);
+            }
+
+            // Rotations of the root and of nodes under a left and under a right son.
+            tree.rotateLeft(nodes[6]);
+            this->assert_true(tree.getHierarchy()->accessRoot() == nodes[6], "Right son became the root.");
+            this->assert_true(isConsistent(tree), "Left rotation of the root keeps the tree.");
+            tree.rotateRight(nodes[2]);
+            this->assert_true(isConsistent(tree), "Right rotation under a left son keeps the tree.");
+            tree.rotateLeft(nodes[4]);
+            this->assert_true(isConsistent(tree), "Left rotation under a left son keeps the tree.");
+            tree.rotateRight(nodes[4]);
+            this->assert_true(tree.getHierarchy()->accessRoot() == nodes[4], "Left son became the root.");
+            this->assert_true(isConsistent(tree), "Right rotation of the root keeps the tree.");
+            tree.rotateRight(nodes[5]);
+            this->assert_true(isConsistent(tree), "Right rotation under a right son keeps the tree.");
+            tree.rotateLeft(nodes[7]);
+            this->assert_true(isConsistent(tree), "Left rotation under a right son keeps the tree.");
+        }
+
+    private:
+        static bool isConsistent(TreeType& tree)
+        {
+            auto* hierarchy = tree.getHierarchy();
+            auto expectedKey = 1;
+            for (auto const& item : tree)
+            {
+                if (item.key_ != expectedKey++)
+                {
+                    return false;
+                }
+            }
+
+            auto consistent = expectedKey == 8 && hierarchy->accessParent(*hierarchy->accessRoot()) == nullptr;
+            hierarchy->processPreOrder(hierarchy->accessRoot(), [hierarchy, &consistent](auto* node)
+                {
+                    for (size_t sonOrder = 0; sonOrder < 2; ++sonOrder)
+                    {
+                        auto* son = hierarchy->accessSon(*node, sonOrder);
+                        consistent = consistent && (son == nullptr || hierarchy->accessParent(*son) == node);
+                    }
+                });
+            return consistent;
+        }
+    };
+
     /**
      * @brief All sequence table implementations tests
      */
@@ -4,8 +4,12 @@
 #include <tests/amt/implicit_sequence.test.h>
 #include <tests/amt/explicit_sequence.test.h>
 #include <tests/amt/implicit_hierarchy.test.h>
+#include <tests/amt/veb_implicit_hierarchy.test.h>
 #include <tests/amt/explicit_hierarchy.test.h>
 #include <tests/amt/hierarchy.test.h>
+#include <tests/amt/ancestor_index.test.h>
+#include <tests/amt/succinct_hierarchy.test.h>
+#include <tests/amt/network.test.h>
 #include <memory>
 
 namespace ds::tests
@@ -19,8 +23,12 @@ namespace ds::tests
             this->add_test(std::make_unique<ImplicitSequenceTest>());
             this->add_test(std::make_unique<ExplicitSequenceTest>());
             this->add_test(std::make_unique<ImplicitHierarchyTest>());
+            this->add_test(std::make_unique<VebImplicitHierarchyTest>());
             this->add_test(std::make_unique<ExplicitHierarchyTest>());
             this->add_test(std::make_unique<HierarchyTest>());
+            this->add_test(std::make_unique<AncestorIndexTest>());
+            this->add_test(std::make_unique<SuccinctHierarchyTest>());
+            this->add_test(std::make_unique<NetworkTest>());
         }
     };
 }
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <libds/amt/ancestor_index.h>
+#include <tests/_details/test.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::tests
+{
+    namespace details
+    {
+        template<class Hierarchy>
+        typename Hierarchy::BlockType* naiveLca(const Hierarchy& hierarchy, typename Hierarchy::BlockType* first, typename Hierarchy::BlockType* second)
+        {
+            size_t firstLevel = hierarchy.level(*first);
+            size_t secondLevel = hierarchy.level(*second);
+            for (; firstLevel > secondLevel; --firstLevel)
+            {
+                first = hierarchy.accessParent(*first);
+            }
+            for (; secondLevel > firstLevel; --secondLevel)
+            {
+                second = hierarchy.accessParent(*second);
+            }
+            while (first != second)
+            {
+                first = hierarchy.accessParent(*first);
+                second = hierarchy.accessParent(*second);
+            }
+            return first;
+        }
+    }
+
+    /**
+     * @brief Tests queries against walks over parents on a random multi-way hierarchy.
+     */
+    class AncestorIndexTestQueries : public LeafTest
+    {
+    public:
+        AncestorIndexTestQueries() :
+            LeafTest("queries")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int count = 3000;
+            amt::MultiWayExplicitHierarchy<int> hierarchy;
+            std::vector<amt::MWEHBlock<int>*> nodes;
+            nodes.push_back(&hierarchy.emplaceRoot());
+            std::default_random_engine rng(144);
+            for (int i = 1; i < count; ++i)
+            {
+                // Every third node deepens the hierarchy, the others attach anywhere.
+                auto* parent = i % 3 == 0 ? nodes.back() : nodes[rng() % nodes.size()];
+                nodes.push_back(&hierarchy.emplaceSon(*parent, hierarchy.degree(*parent)));
+            }
+
+            amt::AncestorIndex<amt::MWEHBlock<int>> index(hierarchy);
+            this->assert_equals(static_cast<size_t>(count), index.size());
+
+            bool levels = true;
+            bool ancestors = true;
+            for (auto* node : nodes)
+            {
+                const size_t level = hierarchy.level(*node);
+                levels = levels && index.level(*node) == level;
+                auto* ancestor = node;
+                for (size_t k = 0; k <= level; ++k)
+                {
+                    ancestors = ancestors && index.levelAncestor(*node, k) == ancestor;
+                    ancestor = hierarchy.accessParent(*ancestor);
+                }
+                ancestors = ancestors && index.levelAncestor(*node, level + 1) == nullptr;
+            }
+            this->assert_true(levels, "Levels match.");
+            this->assert_true(ancestors, "Level ancestors match.");
+
+            bool lcas = true;
+            for (int i = 0; i < 20000; ++i)
+            {
+                auto* first = nodes[rng() % nodes.size()];
+                auto* second = nodes[rng() % nodes.size()];
+                lcas = lcas && index.lca(*first, *second) == details::naiveLca(hierarchy, first, second);
+            }
+            this->assert_true(lcas, "Lowest common ancestors match.");
+            this->assert_equals(nodes[5], index.lca(*nodes[5], *nodes[5]));
+            this->assert_equals(nodes[0], index.lca(*nodes[0], *nodes[count - 1]));
+        }
+    };
+
+    /**
+     * @brief Tests that the index detects changes of the hierarchy.
+     */
+    class AncestorIndexTestInvalidation : public LeafTest
+    {
+    public:
+        AncestorIndexTestInvalidation() :
+            LeafTest("invalidation")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            /*
+             *        root
+             *      /      \
+             *    left    right
+             *    /
+             *  leaf
+             */
+            amt::BinaryExplicitHierarchy<int> hierarchy;
+            auto& root = hierarchy.emplaceRoot();
+            auto& left = hierarchy.insertLeftSon(root);
+            auto& right = hierarchy.insertRightSon(root);
+            auto& leaf = hierarchy.insertLeftSon(left);
+
+            amt::AncestorIndex<amt::BEHBlock<int>> index(hierarchy);
+            this->assert_true(index.isValid(), "New index is valid.");
+            this->assert_equals(&root, index.lca(leaf, right));
+            this->assert_equals(&left, index.lca(leaf, left));
+            this->assert_equals(static_cast<size_t>(2), index.level(leaf));
+
+            auto& newLeaf = hierarchy.insertRightSon(right);
+            this->assert_false(index.isValid(), "Index is out of date after an insertion.");
+            this->assert_throws([&]() { index.lca(leaf, right); });
+
+            index.rebuild();
+            this->assert_equals(&root, index.lca(leaf, newLeaf));
+            this->assert_equals(&right, index.levelAncestor(newLeaf, 1));
+
+            hierarchy.removeLeftSon(root);
+            this->assert_throws([&]() { index.level(root); });
+            index.rebuild();
+            this->assert_equals(static_cast<size_t>(3), index.size());
+            this->assert_throws([&]() { index.level(leaf); });
+
+            hierarchy.clear();
+            index.rebuild();
+            this->assert_equals(static_cast<size_t>(0), index.size());
+        }
+    };
+
+    /**
+     * @brief All ancestor index tests.
+     */
+    class AncestorIndexTest : public CompositeTest
+    {
+    public:
+        AncestorIndexTest() :
+            CompositeTest("AncestorIndex")
+        {
+            this->add_test(std::make_unique<AncestorIndexTestQueries>());
+            this->add_test(std::make_unique<AncestorIndexTestInvalidation>());
+        }
+    };
+}
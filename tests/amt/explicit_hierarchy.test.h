@@ -4,7 +4,9 @@
 #include <tests/_details/test.hpp>
 #include <tests/amt/hierarchy.test.h>
 #include <memory>
+#include <random>
 #include <type_traits>
+#include <vector>
 
 namespace ds::tests
 {
@@ -245,6 +247,208 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests insertion of sons at the front, in the middle and at the back.
+     */
+    class LinkedMWEHTestInsert : public LeafTest
+    {
+    public:
+        LinkedMWEHTestInsert() :
+            LeafTest("insert")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeLinkedMWEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            //        0
+            //   /         \
+            //   1         2
+            // / | \       |
+            // 3 4 5       6
+            auto& root = *hierarchy.accessRoot();
+            auto& one = *hierarchy.accessSon(root, 0);
+            this->assert_equals(static_cast<size_t>(7), hierarchy.size());
+
+            hierarchy.emplaceSon(one, 1).data_ = 7;
+            hierarchy.emplaceSon(one, 4).data_ = 8;
+            hierarchy.emplaceSon(one, 0).data_ = 9;
+            std::vector<int> sons;
+            for (size_t i = 0; i < hierarchy.degree(one); ++i)
+            {
+                sons.push_back(hierarchy.accessSon(one, i)->data_);
+            }
+            this->assert_true(sons == std::vector<int>({ 9, 3, 7, 4, 5, 8 }), "Sons are linked in order.");
+            this->assert_equals(&one, hierarchy.accessParent(*hierarchy.accessSon(one, 5)));
+            this->assert_null(hierarchy.accessSon(one, 6));
+            this->assert_throws([&]() { hierarchy.emplaceSon(one, 7); });
+            this->assert_equals(static_cast<size_t>(10), hierarchy.size());
+        }
+    };
+
+    /**
+     *  @brief Tests change and removal of sons.
+     */
+    class LinkedMWEHTestChangeRemove : public LeafTest
+    {
+    public:
+        LinkedMWEHTestChangeRemove() :
+            LeafTest("change-remove")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeLinkedMWEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            //        0
+            //   /         \
+            //   1         2
+            // / | \       |
+            // 3 4 5       6
+            auto& root = *hierarchy.accessRoot();
+            auto& one = *hierarchy.accessSon(root, 0);
+            auto& two = *hierarchy.accessSon(root, 1);
+            auto& four = *hierarchy.accessSon(one, 1);
+            auto& six = *hierarchy.accessSon(two, 0);
+
+            hierarchy.changeSon(two, 0, nullptr);
+            hierarchy.changeSon(one, 1, &six);
+            this->assert_null(hierarchy.accessParent(four));
+            this->assert_equals(&one, hierarchy.accessParent(six));
+            this->assert_equals(static_cast<size_t>(0), hierarchy.degree(two));
+            this->assert_equals(6, hierarchy.accessSon(one, 1)->data_);
+            this->assert_equals(5, hierarchy.accessSon(one, 2)->data_);
+            this->assert_throws([&]() { hierarchy.changeSon(two, 0, &four); });
+
+            hierarchy.removeSon(one, 0);
+            hierarchy.removeSon(root, 0);
+            this->assert_equals(static_cast<size_t>(1), hierarchy.degree(root));
+            this->assert_equals(2, hierarchy.accessSon(root, 0)->data_);
+            this->assert_equals(static_cast<size_t>(2), hierarchy.size());
+            this->assert_throws([&]() { hierarchy.removeSon(root, 1); });
+        }
+    };
+
+    /**
+     *  @brief Tests copy constructor, assign and equals.
+     */
+    class LinkedMWEHTestCopyAssignEquals : public LeafTest
+    {
+    public:
+        LinkedMWEHTestCopyAssignEquals() :
+            LeafTest("copy-assign-equals")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeLinkedMWEH();
+            auto& hierarchy1 = *fixture.hierarchy_;
+
+            auto& root1 = *hierarchy1.accessRoot();
+            auto& one1 = *hierarchy1.accessSon(root1, 0);
+
+            auto hierarchy2(hierarchy1);
+            this->assert_true(hierarchy1.equals(hierarchy2), "Copy constructed hierarchy is the same.");
+            std::vector<int> preOrder;
+            hierarchy2.processPreOrder(hierarchy2.accessRoot(), [&preOrder](auto* b)
+                {
+                    preOrder.push_back(b->data_);
+                });
+            this->assert_true(preOrder == fixture.preOrder_, "Copy keeps the order of sons.");
+            this->assert_equals(hierarchy2.accessRoot(), hierarchy2.accessParent(*hierarchy2.accessSon(*hierarchy2.accessRoot(), 1)));
+            hierarchy1.removeSon(root1, 1);
+            this->assert_false(hierarchy1.equals(hierarchy2), "Modified copy is different.");
+
+            auto hierarchy3 = amt::LinkedMultiWayExplicitHierarchy<int>();
+            hierarchy3.assign(hierarchy1);
+            this->assert_true(hierarchy1.equals(hierarchy3), "Assigned hierarchy is the same.");
+            hierarchy1.removeSon(one1, 0);
+            hierarchy1.removeSon(one1, 0);
+            this->assert_false(hierarchy1.equals(hierarchy3), "Modified assigned hierarchy is different.");
+
+            hierarchy3.assign(hierarchy3);
+            this->assert_equals(static_cast<size_t>(5), hierarchy3.size());
+            hierarchy3.clear();
+            this->assert_true(hierarchy3.isEmpty(), "Cleared hierarchy is empty.");
+        }
+    };
+
+    /**
+     *  @brief Tests traversals and iterators over a node with many sons.
+     */
+    class LinkedMWEHTestWideTraversal : public LeafTest
+    {
+    public:
+        LinkedMWEHTestWideTraversal() :
+            LeafTest("wide-traversal")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            // Son orders are walked in O(k), so any quadratic traversal would not finish.
+            const int width = 100000;
+            amt::LinkedMultiWayExplicitHierarchy<int> hierarchy;
+            auto& root = hierarchy.emplaceRoot();
+            root.data_ = -1;
+            for (int i = width - 1; i >= 0; --i)
+            {
+                auto& son = hierarchy.emplaceSon(root, 0);
+                son.data_ = i;
+                hierarchy.emplaceSon(son, 0).data_ = width + i;
+            }
+
+            std::vector<int> order;
+            hierarchy.processLevelOrder(hierarchy.accessRoot(), [&order](auto* b)
+                {
+                    order.push_back(b->data_);
+                });
+            bool ordered = order.size() == static_cast<size_t>(2 * width + 1);
+            for (int i = 0; ordered && i < 2 * width; ++i)
+            {
+                ordered = order[i + 1] == i;
+            }
+            this->assert_true(ordered, "Level-order visits sons in order.");
+
+            order.clear();
+            for (int data : hierarchy)
+            {
+                order.push_back(data);
+            }
+            this->assert_equals(static_cast<size_t>(2 * width + 1), order.size());
+            this->assert_equals(0, order[1]);
+            this->assert_equals(width, order[2]);
+            this->assert_equals(2 * width - 1, order[2 * width]);
+
+            this->assert_equals(static_cast<size_t>(2 * width + 1), hierarchy.size());
+            hierarchy.removeSon(root, 0);
+            this->assert_equals(static_cast<size_t>(2 * width - 1), hierarchy.size());
+        }
+    };
+
+    /**
+     * @brief All LinkedMultiWayExplicitHierarchy tests.
+     */
+    class LinkedMultiwayExplicitHierarchyTest : public CompositeTest
+    {
+    public:
+        LinkedMultiwayExplicitHierarchyTest() :
+            CompositeTest("LinkedMultiwayExplicitHierarchy")
+        {
+            this->add_test(std::make_unique<LinkedMWEHTestInsert>());
+            this->add_test(std::make_unique<LinkedMWEHTestChangeRemove>());
+            this->add_test(std::make_unique<LinkedMWEHTestCopyAssignEquals>());
+            this->add_test(std::make_unique<LinkedMWEHTestWideTraversal>());
+        }
+    };
+
     /**
      * @brief Tests insertion of root and sons.
      */
@@ -523,6 +727,98 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests that clones equal the original and lie contiguously in pre-order, with and without a pool.
+     */
+    class ExplicitHierarchyTestClone : public LeafTest
+    {
+    public:
+        ExplicitHierarchyTestClone() :
+            LeafTest("clone")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            std::default_random_engine rng(144);
+            amt::MultiWayExplicitHierarchy<int> multiWay;
+            std::vector<amt::MWEHBlock<int>*> nodes;
+            nodes.push_back(&multiWay.emplaceRoot());
+            for (int i = 1; i < 5000; ++i)
+            {
+                auto* parent = nodes[rng() % nodes.size()];
+                auto& son = multiWay.emplaceSon(*parent, rng() % (multiWay.degree(*parent) + 1));
+                son.data_ = i;
+                nodes.push_back(&son);
+            }
+
+            amt::BinaryExplicitHierarchy<int> binary;
+            binary.emplaceRoot().data_ = 0;
+            for (int i = 1; i < 5000; ++i)
+            {
+                auto* node = binary.accessRoot();
+                while (true)
+                {
+                    const bool left = rng() % 2 == 0;
+                    auto* son = left ? binary.accessLeftSon(*node) : binary.accessRightSon(*node);
+                    if (son == nullptr)
+                    {
+                        (left ? binary.insertLeftSon(*node) : binary.insertRightSon(*node)).data_ = i;
+                        break;
+                    }
+                    node = son;
+                }
+            }
+
+            WorkStealingPool pool(2);
+            for (WorkStealingPool* clonePool : { static_cast<WorkStealingPool*>(nullptr), &pool })
+            {
+                auto multiWayClone = multiWay.clone(clonePool, 100);
+                this->assert_true(multiWayClone.equals(multiWay), "Multi-way clone is the same.");
+                this->assert_true(this->isContiguous(multiWayClone), "Multi-way clone is contiguous in pre-order.");
+
+                auto binaryClone = binary.clone(clonePool, 100);
+                this->assert_true(binaryClone.equals(binary), "Binary clone is the same.");
+                this->assert_true(this->isContiguous(binaryClone), "Binary clone is contiguous in pre-order.");
+
+                auto& multiWayRoot = *multiWayClone.accessRoot();
+                multiWayClone.emplaceSon(multiWayRoot, 0).data_ = -1;
+                multiWayClone.removeSon(multiWayRoot, 1);
+                this->assert_false(multiWayClone.equals(multiWay), "Modified multi-way clone is different.");
+
+                binaryClone.removeLeftSon(*binaryClone.accessRoot());
+                binaryClone.insertLeftSon(*binaryClone.accessRoot()).data_ = -1;
+                this->assert_false(binaryClone.equals(binary), "Modified binary clone is different.");
+                this->assert_equals(static_cast<size_t>(5000), binary.size());
+            }
+
+            amt::BinaryExplicitHierarchy<int> empty;
+            this->assert_true(empty.clone().isEmpty(), "Clone of an empty hierarchy is empty.");
+        }
+
+    private:
+        template<typename Hierarchy>
+        bool isContiguous(const Hierarchy& hierarchy)
+        {
+            using BlockType = typename Hierarchy::BlockType;
+            const BlockType* root = hierarchy.accessRoot();
+            size_t index = 0;
+            bool result = true;
+            hierarchy.processPreOrder(root, [&](const BlockType* b)
+                {
+                    result = result && b == root + index;
+                    for (size_t order = 0; order <= hierarchy.degree(*b); ++order)
+                    {
+                        const BlockType* son = hierarchy.accessSon(*b, order);
+                        result = result && (son == nullptr || hierarchy.accessParent(*son) == b);
+                    }
+                    ++index;
+                });
+            return result;
+        }
+    };
+
     /**
      * @brief All ExplicitHierarchy tests.
      */
@@ -533,7 +829,9 @@ namespace ds::tests
             CompositeTest("ExplicitHierarchy")
         {
             this->add_test(std::make_unique<MultiwayExplicitHierarchyTest>());
+            this->add_test(std::make_unique<LinkedMultiwayExplicitHierarchyTest>());
             this->add_test(std::make_unique<KWayExplicitHierarchyTest>());
+            this->add_test(std::make_unique<ExplicitHierarchyTestClone>());
         }
     };
 }
@@ -3,10 +3,314 @@
 #include <tests/_details/test.hpp>
 #include <tests/amt/sequence.test.h>
 #include <libds/amt/explicit_sequence.h>
+#include <libds/mm/pooled_memory_manager.h>
 #include <memory>
+#include <new>
+#include <vector>
 
 namespace ds::tests
 {
+    /**
+     * @brief Checks that @p seq contains exactly @p expected and that its links are consistent.
+     */
+    template<class SequenceT>
+    bool explicitSequenceContains(const SequenceT& seq, const std::vector<int>& expected)
+    {
+        if (seq.size() != expected.size())
+        {
+            return false;
+        }
+
+        size_t i = 0;
+        auto* previous = static_cast<decltype(seq.accessFirst())>(nullptr);
+        for (auto* block = seq.accessFirst(); block != nullptr; block = seq.accessNext(*block))
+        {
+            if (i >= expected.size() || block->data_ != expected[i] || seq.accessPrevious(*block) != previous)
+            {
+                return false;
+            }
+            previous = block;
+            ++i;
+        }
+
+        return i == expected.size() && seq.accessLast() == previous;
+    }
+
+    /**
+     * @brief Tests moving a run of blocks between two sequences and within one sequence.
+     * @tparam SequenceT Type of the explicit sequence.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceTestSplice : public LeafTest
+    {
+    public:
+        ExplicitSequenceTestSplice() :
+            LeafTest("splice")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            SequenceT seq1;
+            SequenceT seq2;
+            for (int i = 0; i < 5; ++i)
+            {
+                seq1.insertLast().data_ = i;
+                seq2.insertLast().data_ = 10 + i;
+            }
+            // 0 1 2 3 4
+            // 10 11 12 13 14
+
+            auto* firstMoved = seq2.access(1);
+            seq1.splice(seq1.access(1), seq2, *firstMoved, *seq2.access(3));
+            this->assert_true(explicitSequenceContains(seq1, {0, 1, 11, 12, 13, 2, 3, 4}), "Run is inserted after target block.");
+            this->assert_true(explicitSequenceContains(seq2, {10, 14}), "Run is removed from source sequence.");
+            this->assert_true(seq1.access(2) == firstMoved, "Blocks are relinked, not copied.");
+
+            seq1.splice(nullptr, seq2, *seq2.accessFirst(), *seq2.accessFirst());
+            this->assert_true(explicitSequenceContains(seq1, {10, 0, 1, 11, 12, 13, 2, 3, 4}), "Run is inserted at the front.");
+
+            seq1.splice(seq1.accessLast(), seq2, *seq2.accessFirst(), *seq2.accessLast());
+            this->assert_true(explicitSequenceContains(seq1, {10, 0, 1, 11, 12, 13, 2, 3, 4, 14}), "Run is inserted at the end.");
+            this->assert_true(seq2.isEmpty(), "Whole source sequence is moved.");
+            this->assert_null(seq2.accessFirst());
+            this->assert_null(seq2.accessLast());
+
+            seq1.splice(seq1.accessLast(), seq1, *seq1.access(3), *seq1.access(5));
+            this->assert_true(explicitSequenceContains(seq1, {10, 0, 1, 2, 3, 4, 14, 11, 12, 13}), "Run is moved within one sequence.");
+        }
+    };
+
+    /**
+     * @brief Tests splitting a sequence after a block.
+     * @tparam SequenceT Type of the explicit sequence.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceTestSplitAfter : public LeafTest
+    {
+    public:
+        ExplicitSequenceTestSplitAfter() :
+            LeafTest("splitAfter")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            SequenceT seq1;
+            for (int i = 0; i < 6; ++i)
+            {
+                seq1.insertLast().data_ = i;
+            }
+
+            SequenceT seq2;
+            seq2.insertLast().data_ = 10;
+
+            seq1.splitAfter(*seq1.access(2), seq2);
+            this->assert_true(explicitSequenceContains(seq1, {0, 1, 2}), "Head stays in the sequence.");
+            this->assert_true(explicitSequenceContains(seq2, {10, 3, 4, 5}), "Tail is appended to the target.");
+
+            seq1.splitAfter(*seq1.accessLast(), seq2);
+            this->assert_true(explicitSequenceContains(seq1, {0, 1, 2}), "Split after the last block changes nothing.");
+
+            seq1.splitAfter(*seq1.accessFirst(), seq2);
+            this->assert_true(explicitSequenceContains(seq1, {0}), "Split after the first block.");
+            this->assert_true(explicitSequenceContains(seq2, {10, 3, 4, 5, 1, 2}), "Second tail is appended to the target.");
+        }
+    };
+
+    /**
+     * @brief Tests concatenation of two sequences.
+     * @tparam SequenceT Type of the explicit sequence.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceTestConcat : public LeafTest
+    {
+    public:
+        ExplicitSequenceTestConcat() :
+            LeafTest("concat")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            SequenceT seq1;
+            SequenceT seq2;
+            SequenceT empty;
+
+            seq1.concat(empty);
+            this->assert_true(seq1.isEmpty(), "Concatenation of empty sequences is empty.");
+
+            for (int i = 0; i < 3; ++i)
+            {
+                seq2.insertLast().data_ = i;
+            }
+
+            seq1.concat(seq2);
+            this->assert_true(explicitSequenceContains(seq1, {0, 1, 2}), "Concatenation to empty sequence.");
+            this->assert_true(seq2.isEmpty(), "Concatenated sequence is emptied.");
+
+            seq2.insertLast().data_ = 3;
+            seq2.insertLast().data_ = 4;
+            seq1.concat(seq2);
+            this->assert_true(explicitSequenceContains(seq1, {0, 1, 2, 3, 4}), "Concatenation to non-empty sequence.");
+
+            seq1.concat(empty);
+            this->assert_true(explicitSequenceContains(seq1, {0, 1, 2, 3, 4}), "Concatenation of empty sequence changes nothing.");
+
+            seq1.insertLast().data_ = 5;
+            this->assert_true(explicitSequenceContains(seq1, {0, 1, 2, 3, 4, 5}), "Sequence stays usable.");
+        }
+    };
+
+    /**
+     * @brief Tests in-place sorting of blocks.
+     * @tparam SequenceT Type of the explicit sequence.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceTestSortBlocks : public LeafTest
+    {
+    public:
+        ExplicitSequenceTestSortBlocks() :
+            LeafTest("sortBlocks")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using BlockType = typename SequenceT::BlockType;
+            auto less = [](const BlockType& a, const BlockType& b) { return a.data_ < b.data_; };
+
+            SequenceT seq;
+            seq.sortBlocks(less);
+            this->assert_true(seq.isEmpty(), "Empty sequence stays empty.");
+
+            for (int i : {5, 3, 8, 1, 9, 2, 7, 3, 0})
+            {
+                seq.insertLast().data_ = i;
+            }
+            auto* eight = seq.access(2);
+
+            seq.sortBlocks(less);
+            this->assert_true(explicitSequenceContains(seq, {0, 1, 2, 3, 3, 5, 7, 8, 9}), "Blocks are sorted.");
+            this->assert_true(seq.access(7) == eight, "Blocks are relinked, not copied.");
+
+            seq.insertLast().data_ = 4;
+            seq.sortBlocks([](const BlockType& a, const BlockType& b) { return a.data_ > b.data_; });
+            this->assert_true(explicitSequenceContains(seq, {9, 8, 7, 5, 4, 3, 3, 2, 1, 0}), "Blocks are sorted in reverse.");
+        }
+    };
+
+    /**
+     * @brief Memory manager whose allocations fail once the given number of blocks is allocated.
+     */
+    template<typename BlockType>
+    class FailingMemoryManager : public mm::MemoryManager<BlockType>
+    {
+    public:
+        explicit FailingMemoryManager(size_t allocationsLeft) :
+            allocationsLeft_(allocationsLeft)
+        {
+        }
+
+        BlockType* allocateMemory() override
+        {
+            if (allocationsLeft_ == 0)
+            {
+                throw std::bad_alloc();
+            }
+
+            --allocationsLeft_;
+            return mm::MemoryManager<BlockType>::allocateMemory();
+        }
+
+    private:
+        size_t allocationsLeft_;
+    };
+
+    /**
+     * @brief Tests reallocation of blocks in logical order.
+     * @tparam SequenceT Type of the explicit sequence.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceTestCompact : public LeafTest
+    {
+    public:
+        ExplicitSequenceTestCompact() :
+            LeafTest("compact")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using BlockType = typename SequenceT::BlockType;
+
+            SequenceT seq;
+            seq.compact();
+            this->assert_true(seq.isEmpty(), "Empty sequence stays empty.");
+
+            for (int i = 0; i < 6; ++i)
+            {
+                seq.insertFirst().data_ = i;
+            }
+            seq.compact();
+            this->assert_true(explicitSequenceContains(seq, {5, 4, 3, 2, 1, 0}), "Order is kept.");
+
+            auto* pool = new mm::PooledMemoryManager<BlockType>(2);
+            seq.compact(pool);
+            this->assert_true(explicitSequenceContains(seq, {5, 4, 3, 2, 1, 0}), "Order is kept in pool.");
+            this->assert_equals(static_cast<size_t>(6), pool->getAllocatedBlockCount());
+
+            bool contiguous = true;
+            for (auto* block = seq.accessFirst(); block != seq.accessLast(); block = seq.accessNext(*block))
+            {
+                contiguous = contiguous && seq.accessNext(*block) == block + 1;
+            }
+            this->assert_true(contiguous, "Blocks are contiguous in logical order.");
+
+            seq.removeFirst();
+            seq.insertLast().data_ = 7;
+            this->assert_true(explicitSequenceContains(seq, {4, 3, 2, 1, 0, 7}), "Pooled sequence can be modified.");
+
+            FailingMemoryManager<BlockType> failing(3);
+            bool thrown = false;
+            try
+            {
+                seq.compact(&failing);
+            }
+            catch (const std::bad_alloc&)
+            {
+                thrown = true;
+            }
+            this->assert_true(thrown, "Failed allocation is reported.");
+            this->assert_true(explicitSequenceContains(seq, {4, 3, 2, 1, 0, 7}), "Failed compaction leaves the sequence unchanged.");
+            this->assert_equals(static_cast<size_t>(0), failing.getAllocatedBlockCount());
+        }
+    };
+
+    /**
+     * @brief Relinking tests for explicit sequences.
+     * @tparam SequenceT Type of the explicit sequence.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceRelinkTest : public CompositeTest
+    {
+    public:
+        ExplicitSequenceRelinkTest() :
+            CompositeTest("ExplicitSequenceRelinkTest")
+        {
+            this->add_test(std::make_unique<ExplicitSequenceTestSplice<SequenceT>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestSplitAfter<SequenceT>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestConcat<SequenceT>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestSortBlocks<SequenceT>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestCompact<SequenceT>>());
+        }
+    };
+
     /**
      * @brief All tests for singly linked sequence.
      */
@@ -17,6 +321,7 @@ namespace ds::tests
             CompositeTest("SinglyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::SinglyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<ExplicitSequenceRelinkTest<amt::SinglyLinkedSequence<int>>>());
         }
     };
 
@@ -30,6 +335,7 @@ namespace ds::tests
             CompositeTest("DoublyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::DoublyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<ExplicitSequenceRelinkTest<amt::DoublyLinkedSequence<int>>>());
         }
     };
 
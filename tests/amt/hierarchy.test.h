@@ -4,6 +4,9 @@
 #include <libds/amt/implicit_hierarchy.h>
 #include <libds/amt/explicit_hierarchy.h>
 #include <memory>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace ds::tests
@@ -50,6 +53,38 @@ namespace ds::tests
             };
         };
 
+        /**
+         *         0
+         *    /         \
+         *    1         2
+         *  / | \       |
+         *  3 4 5       6
+         *
+         *  Sons are inserted at the front in reverse order.
+         */
+        inline auto const makeLinkedMWEH = []()-> HierarchyFixture<amt::LinkedMultiWayExplicitHierarchy<int>>
+        {
+            auto hierarchy = std::make_unique<amt::LinkedMultiWayExplicitHierarchy<int>>();
+            auto& root = hierarchy->emplaceRoot();
+            auto& two = hierarchy->emplaceSon(root, 0);
+            auto& one = hierarchy->emplaceSon(root, 0);
+            root.data_ = 0;
+            one.data_ = 1;
+            two.data_ = 2;
+            hierarchy->emplaceSon(one, 0).data_ = 5;
+            hierarchy->emplaceSon(one, 0).data_ = 4;
+            hierarchy->emplaceSon(one, 0).data_ = 3;
+            hierarchy->emplaceSon(two, 0).data_ = 6;
+            return
+            {
+                std::move(hierarchy),
+                {0, 1, 3, 4, 5, 2, 6},
+                {3, 4, 5, 1, 6, 2, 0},
+                {0, 1, 2, 3, 4, 5, 6},
+                {}
+            };
+        };
+
         /**
          *         0
          *    /    |    \
@@ -134,6 +169,37 @@ namespace ds::tests
                 {2, 5, 7, 10, 15, 20}
             };
         };
+
+        /*         10
+         *    /          \
+         *    5          15
+         *  /   \      /   \
+         *  2   7      -   20
+         */
+        inline auto const makeThreadedBEH = []() -> HierarchyFixture<amt::ThreadedBinaryExplicitHierarchy<int>>
+        {
+            auto hierarchy = std::make_unique<amt::ThreadedBinaryExplicitHierarchy<int>>();
+            auto& root = hierarchy->emplaceRoot();
+            auto& five = hierarchy->insertLeftSon(root);
+            auto& fifteen = hierarchy->insertRightSon(root);
+            auto& two = hierarchy->insertLeftSon(five);
+            auto& seven = hierarchy->insertRightSon(five);
+            auto& twenty = hierarchy->insertRightSon(fifteen);
+            root.data_ = 10;
+            five.data_ = 5;
+            fifteen.data_ = 15;
+            two.data_ = 2;
+            seven.data_ = 7;
+            twenty.data_ = 20;
+            return
+            {
+                std::move(hierarchy),
+                {10, 5, 2, 7, 15, 20},
+                {2, 7, 5, 20, 15, 10},
+                {10, 5, 15, 2, 7, 20},
+                {2, 5, 7, 10, 15, 20}
+            };
+        };
     }
 
     /**
@@ -363,6 +429,453 @@ namespace ds::tests
         MakeFixture makeFixture_;
     };
 
+    /**
+     *  @brief Tests in-order neighbours and in-order traversal of a subtree.
+     */
+    template<class MakeFixture>
+    class BinaryHierarchyTestInOrderNeighbours : public LeafTest
+    {
+    public:
+        BinaryHierarchyTestInOrderNeighbours(MakeFixture makeFixture, const std::string& name) :
+            LeafTest(name),
+            makeFixture_(makeFixture)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = makeFixture_();
+            auto& hierarchy = *fixture.hierarchy_;
+            using BlockType = typename std::remove_reference_t<decltype(hierarchy)>::BlockType;
+
+            std::vector<const BlockType*> nodes;
+            hierarchy.processInOrder(hierarchy.accessRoot(), [&nodes](const BlockType* node)
+                {
+                    nodes.push_back(node);
+                });
+            this->assert_equals(fixture.inOrder_.size(), nodes.size());
+
+            for (size_t i = 0; i < nodes.size(); ++i)
+            {
+                const BlockType* predecessor = i > 0 ? nodes[i - 1] : nullptr;
+                const BlockType* successor = i + 1 < nodes.size() ? nodes[i + 1] : nullptr;
+                this->assert_true(hierarchy.accessInOrderPredecessor(*nodes[i]) == predecessor, "Predecessor matches.");
+                this->assert_true(hierarchy.accessInOrderSuccessor(*nodes[i]) == successor, "Successor matches.");
+            }
+
+            BlockType* five = hierarchy.accessLeftSon(*hierarchy.accessRoot());
+            std::vector<int> subtree;
+            hierarchy.processInOrder(five, [&subtree](const BlockType* node)
+                {
+                    subtree.push_back(node->data_);
+                });
+            std::vector<int> subtreeIterated;
+            using IteratorType = typename std::remove_reference_t<decltype(hierarchy)>::IteratorType;
+            for (IteratorType it(&hierarchy, five); it != hierarchy.end(); ++it)
+            {
+                subtreeIterated.push_back(*it);
+            }
+            const std::vector<int> expected = { 2, 5, 7 };
+            this->assert_true(subtree == expected, "Processing stays in the subtree.");
+            this->assert_true(subtreeIterated == expected, "Iterator stays in the subtree.");
+        }
+
+    private:
+        MakeFixture makeFixture_;
+    };
+
+    /**
+     *  @brief Tests traversals of a degenerate hierarchy deeper than the call stack allows.
+     */
+    class HierarchyTestDeepTraversal : public LeafTest
+    {
+    public:
+        HierarchyTestDeepTraversal() :
+            LeafTest("deep-traversal")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int depth = 500000;
+            amt::BinaryExplicitHierarchy<int> hierarchy;
+            auto* node = &hierarchy.emplaceRoot();
+            node->data_ = 0;
+            for (int i = 1; i < depth; ++i)
+            {
+                node = i % 2 == 0 ? &hierarchy.insertLeftSon(*node) : &hierarchy.insertRightSon(*node);
+                node->data_ = i;
+            }
+
+            int expected = 0;
+            bool ordered = true;
+            hierarchy.processPreOrder(hierarchy.accessRoot(), [&expected, &ordered](auto* b)
+                {
+                    ordered = ordered && b->data_ == expected++;
+                });
+            this->assert_true(ordered && expected == depth, "Pre-order visits the whole chain.");
+
+            hierarchy.processPostOrder(hierarchy.accessRoot(), [&expected, &ordered](auto* b)
+                {
+                    ordered = ordered && b->data_ == --expected;
+                });
+            this->assert_true(ordered && expected == 0, "Post-order visits the whole chain.");
+
+            hierarchy.processLevelOrder(hierarchy.accessRoot(), [&expected, &ordered](auto* b)
+                {
+                    ordered = ordered && b->data_ == expected++;
+                });
+            this->assert_true(ordered && expected == depth, "Level-order visits the whole chain.");
+
+            size_t count = 0;
+            hierarchy.processInOrder(hierarchy.accessRoot(), [&count](auto*)
+                {
+                    ++count;
+                });
+            this->assert_equals(static_cast<size_t>(depth), count);
+
+            hierarchy.clear();
+            this->assert_true(hierarchy.isEmpty(), "Deep hierarchy is cleared.");
+        }
+    };
+
+    /**
+     *  @brief Tests traversals of a multi-way hierarchy with high-degree nodes.
+     */
+    class HierarchyTestWideTraversal : public LeafTest
+    {
+    public:
+        HierarchyTestWideTraversal() :
+            LeafTest("wide-traversal")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int width = 100000;
+            amt::MultiWayExplicitHierarchy<int> hierarchy;
+            auto& root = hierarchy.emplaceRoot();
+            root.data_ = -1;
+            for (int i = 0; i < width; ++i)
+            {
+                auto& son = hierarchy.emplaceSon(root, i);
+                son.data_ = i;
+                hierarchy.emplaceSon(son, 0).data_ = width + i;
+            }
+
+            std::vector<int> order;
+            hierarchy.processPreOrder(hierarchy.accessRoot(), [&order](auto* b)
+                {
+                    order.push_back(b->data_);
+                });
+            this->assert_equals(static_cast<size_t>(2 * width + 1), order.size());
+            this->assert_equals(0, order[1]);
+            this->assert_equals(width, order[2]);
+            this->assert_equals(2 * width - 1, order[2 * width]);
+
+            order.clear();
+            hierarchy.processLevelOrder(hierarchy.accessRoot(), [&order](auto* b)
+                {
+                    order.push_back(b->data_);
+                });
+            bool ordered = order.size() == static_cast<size_t>(2 * width + 1);
+            for (int i = 0; ordered && i < 2 * width; ++i)
+            {
+                ordered = order[i + 1] == i;
+            }
+            this->assert_true(ordered, "Level-order visits sons in order.");
+        }
+    };
+
+    /**
+     *  @brief Tests iterators over a hierarchy deeper than their inline path.
+     */
+    class HierarchyTestDeepIterators : public LeafTest
+    {
+    public:
+        HierarchyTestDeepIterators() :
+            LeafTest("deep-iterators")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int depth = 100000;
+            amt::BinaryExplicitHierarchy<int> hierarchy;
+            auto* node = &hierarchy.emplaceRoot();
+            node->data_ = 0;
+            for (int i = 1; i < depth; ++i)
+            {
+                node = &hierarchy.insertRightSon(*node);
+                node->data_ = i;
+            }
+
+            int expected = 0;
+            bool ordered = true;
+            for (int data : hierarchy)
+            {
+                ordered = ordered && data == expected++;
+            }
+            this->assert_true(ordered && expected == depth, "In-order iterator visits the whole chain.");
+
+            expected = 0;
+            for (auto it = hierarchy.beginPre(); it != hierarchy.endPre(); ++it)
+            {
+                ordered = ordered && *it == expected++;
+            }
+            this->assert_true(ordered && expected == depth, "Pre-order iterator visits the whole chain.");
+
+            for (auto it = hierarchy.beginPost(); it != hierarchy.endPost(); ++it)
+            {
+                ordered = ordered && *it == --expected;
+            }
+            this->assert_true(ordered && expected == 0, "Post-order iterator visits the whole chain.");
+        }
+    };
+
+    /**
+     *  @brief Tests that a copied iterator owns its whole path.
+     */
+    class HierarchyTestIteratorCopy : public LeafTest
+    {
+    public:
+        HierarchyTestIteratorCopy() :
+            LeafTest("iterator-copy")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int depth = 40;
+            amt::MultiWayExplicitHierarchy<int> hierarchy;
+            auto* node = &hierarchy.emplaceRoot();
+            node->data_ = 0;
+            for (int i = 1; i < depth; ++i)
+            {
+                auto& leaf = hierarchy.emplaceSon(*node, 0);
+                leaf.data_ = -i;
+                node = &hierarchy.emplaceSon(*node, 1);
+                node->data_ = i;
+            }
+
+            auto it = hierarchy.begin();
+            while (*it != depth - 1)
+            {
+                ++it;
+            }
+
+            auto copy = it;
+            auto assigned = hierarchy.begin();
+            assigned = it;
+            std::vector<int> rest;
+            for (++it; it != hierarchy.end(); ++it)
+            {
+                rest.push_back(*it);
+            }
+            this->assert_true(rest.empty(), "Original iterator reached the end.");
+
+            this->assert_equals(depth - 1, *copy);
+            this->assert_equals(depth - 1, *assigned);
+            ++copy;
+            ++assigned;
+            this->assert_true(copy == hierarchy.end(), "Copied iterator finishes independently.");
+            this->assert_true(assigned == hierarchy.end(), "Assigned iterator finishes independently.");
+
+            auto preOrder = hierarchy.beginPre();
+            for (int i = 0; i < depth; ++i)
+            {
+                ++preOrder;
+            }
+            auto preOrderCopy = preOrder;
+            size_t remaining = 0;
+            size_t remainingCopy = 0;
+            for (; preOrder != hierarchy.endPre(); ++preOrder)
+            {
+                ++remaining;
+            }
+            for (; preOrderCopy != hierarchy.endPre(); ++preOrderCopy)
+            {
+                ++remainingCopy;
+            }
+            this->assert_equals(static_cast<size_t>(depth - 1), remaining);
+            this->assert_equals(remaining, remainingCopy);
+        }
+    };
+
+    /**
+     *  @brief Tests that threads follow changes of the threaded binary hierarchy.
+     */
+    class ThreadedBinaryHierarchyTestChanges : public LeafTest
+    {
+    public:
+        ThreadedBinaryHierarchyTestChanges() :
+            LeafTest("threaded-changes")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeThreadedBEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            auto* root = hierarchy.accessRoot();
+            auto* five = hierarchy.accessLeftSon(*root);
+            auto* fifteen = hierarchy.accessRightSon(*root);
+
+            // Moves the subtree of 5 under 15, then removes 20 and 2.
+            hierarchy.changeLeftSon(*root, nullptr);
+            this->assert_true(inOrder(hierarchy) == std::vector<int>({ 10, 15, 20 }), "Detached subtree is skipped.");
+            hierarchy.changeLeftSon(*fifteen, five);
+            this->assert_true(inOrder(hierarchy) == std::vector<int>({ 10, 2, 5, 7, 15, 20 }), "Attached subtree is visited.");
+            this->assert_true(hierarchy.accessParent(*five) == fifteen, "Attached subtree has a parent.");
+            hierarchy.removeRightSon(*fifteen);
+            hierarchy.removeLeftSon(*five);
+            this->assert_true(inOrder(hierarchy) == std::vector<int>({ 10, 5, 7, 15 }), "Removed leaves are skipped.");
+            this->assert_equals(static_cast<size_t>(4), hierarchy.size());
+
+            amt::ThreadedBinaryExplicitHierarchy<int> copy(hierarchy);
+            this->assert_true(copy.equals(hierarchy), "Copy is equal.");
+            this->assert_true(inOrder(copy) == inOrder(hierarchy), "Copy has the same threads.");
+
+            amt::ThreadedBinaryExplicitHierarchy<int> chain;
+            auto* node = &chain.emplaceRoot();
+            node->data_ = 0;
+            const int depth = 100000;
+            for (int i = 1; i < depth; ++i)
+            {
+                node = &chain.insertLeftSon(*node);
+                node->data_ = -i;
+            }
+            int expected = -depth;
+            bool ordered = true;
+            for (int data : chain)
+            {
+                ordered = ordered && data == ++expected;
+            }
+            this->assert_true(ordered && expected == 0, "Deep chain is iterated.");
+        }
+
+    private:
+        static std::vector<int> inOrder(amt::ThreadedBinaryExplicitHierarchy<int>& hierarchy)
+        {
+            std::vector<int> result;
+            for (int data : hierarchy)
+            {
+                result.push_back(data);
+            }
+
+            std::vector<int> backwards;
+            auto* node = hierarchy.accessRoot();
+            while (node != nullptr && hierarchy.accessRightSon(*node) != nullptr)
+            {
+                node = hierarchy.accessRightSon(*node);
+            }
+            for (; node != nullptr; node = hierarchy.accessInOrderPredecessor(*node))
+            {
+                backwards.insert(backwards.begin(), node->data_);
+            }
+            return backwards == result ? result : std::vector<int>();
+        }
+    };
+
+    /**
+     *  @brief Tests parallel fold and for-each against the serial traversal.
+     */
+    class HierarchyTestParallelFold : public LeafTest
+    {
+    public:
+        HierarchyTestParallelFold() :
+            LeafTest("parallel-fold")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int count = 100000;
+            amt::MultiWayExplicitHierarchy<int> hierarchy;
+            std::vector<amt::MWEHBlock<int>*> nodes;
+            nodes.push_back(&hierarchy.emplaceRoot());
+            nodes.back()->data_ = 0;
+            std::default_random_engine rng(144);
+            for (int i = 1; i < count; ++i)
+            {
+                // Every fourth node continues a long path, the others fan out.
+                auto* parent = i % 4 == 0 ? nodes.back() : nodes[rng() % nodes.size()];
+                auto& son = hierarchy.emplaceSon(*parent, hierarchy.degree(*parent));
+                son.data_ = i;
+                nodes.push_back(&son);
+            }
+
+            long long expectedSum = 0;
+            hierarchy.processPreOrder(hierarchy.accessRoot(), [&expectedSum](auto* b)
+                {
+                    expectedSum += b->data_;
+                });
+
+            bool same = true;
+            for (size_t threadCount : { 1, 2, 4 })
+            {
+                WorkStealingPool pool(threadCount);
+                for (size_t cutoff : { 1, 7, 1000, 1000000 })
+                {
+                    const long long sum = hierarchy.parallelFold(hierarchy.accessRoot(),
+                        [](const amt::MWEHBlock<int>* b) { return static_cast<long long>(b->data_); },
+                        [](long long a, long long b) { return a + b; },
+                        pool, cutoff);
+                    same = same && sum == expectedSum;
+
+                    const size_t nodeCount = hierarchy.parallelFold(nodes[count / 2],
+                        [](const amt::MWEHBlock<int>*) { return static_cast<size_t>(1); },
+                        [](size_t a, size_t b) { return a + b; },
+                        pool, cutoff);
+                    same = same && nodeCount == hierarchy.nodeCount(*nodes[count / 2]);
+                }
+
+                hierarchy.parallelForEach(hierarchy.accessRoot(), [](amt::MWEHBlock<int>* b) { ++b->data_; }, pool, 64);
+                expectedSum += count;
+                const long long sum = hierarchy.parallelFold(hierarchy.accessRoot(),
+                    [](const amt::MWEHBlock<int>* b) { return static_cast<long long>(b->data_); },
+                    [](long long a, long long b) { return a + b; },
+                    pool);
+                same = same && sum == expectedSum;
+
+                this->assert_throws([&]()
+                    {
+                        hierarchy.parallelFold(hierarchy.accessRoot(),
+                            [](const amt::MWEHBlock<int>* b)
+                            {
+                                if (b->data_ == count / 3)
+                                {
+                                    throw std::runtime_error("Leaf failed!");
+                                }
+                                return 0;
+                            },
+                            [](int a, int b) { return a + b; },
+                            pool, 16);
+                    });
+            }
+            this->assert_true(same, "Parallel results match the serial traversal.");
+
+            WorkStealingPool pool(2);
+            auto fixture = details::makeLinkedMWEH();
+            const size_t linkedCount = fixture.hierarchy_->parallelFold(fixture.hierarchy_->accessRoot(),
+                [](const amt::LinkedMWEHBlock<int>*) { return static_cast<size_t>(1); },
+                [](size_t a, size_t b) { return a + b; },
+                pool, 1);
+            this->assert_equals(static_cast<size_t>(7), linkedCount);
+            this->assert_equals(0, hierarchy.parallelFold(static_cast<const amt::MWEHBlock<int>*>(nullptr),
+                [](const amt::MWEHBlock<int>*) { return 1; },
+                [](int a, int b) { return a + b; },
+                pool));
+        }
+    };
+
     /**
      *  @brief Test for processing elements in various orders.
      */
@@ -374,8 +887,10 @@ namespace ds::tests
         {
             using MakeKWEHType = decltype(details::makeKWEH);
             using MakeMWEHType = decltype(details::makeMWEH);
+            using MakeLinkedMWEHType = decltype(details::makeLinkedMWEH);
             using MakeBIHType = decltype(details::makeBIH);
             using MakeBEHType = decltype(details::makeBEH);
+            using MakeThreadedBEHType = decltype(details::makeThreadedBEH);
 
             this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeKWEHType>>(details::makeKWEH, "process-pre-order-kweh"));
             this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeMWEHType>>(details::makeMWEH, "process-pre-order-mweh"));
@@ -396,6 +911,25 @@ namespace ds::tests
             this->add_test(std::make_unique<BinaryHierarchyTestProcessInOrder<MakeBEHType>>(details::makeBEH, "process-in-order-beh"));
             this->add_test(std::make_unique<BinaryHierarchyTestInOrderIterator<MakeBIHType>>(details::makeBIH, "in-order-iterator-bih"));
             this->add_test(std::make_unique<BinaryHierarchyTestInOrderIterator<MakeBEHType>>(details::makeBEH, "in-order-iterator-beh"));
+            this->add_test(std::make_unique<BinaryHierarchyTestInOrderNeighbours<MakeBIHType>>(details::makeBIH, "in-order-neighbours-bih"));
+            this->add_test(std::make_unique<BinaryHierarchyTestInOrderNeighbours<MakeBEHType>>(details::makeBEH, "in-order-neighbours-beh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeLinkedMWEHType>>(details::makeLinkedMWEH, "process-pre-order-linked-mweh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPostOrder<MakeLinkedMWEHType>>(details::makeLinkedMWEH, "process-post-order-linked-mweh"));
+            this->add_test(std::make_unique<HierarchyTestProcessLevelOrder<MakeLinkedMWEHType>>(details::makeLinkedMWEH, "process-level-order-linked-mweh"));
+            this->add_test(std::make_unique<HierarchyTestPreOrderIterator<MakeLinkedMWEHType>>(details::makeLinkedMWEH, "pre-order-iterator-linked-mweh"));
+            this->add_test(std::make_unique<HierarchyTestPostOrderIterator<MakeLinkedMWEHType>>(details::makeLinkedMWEH, "post-order-iterator-linked-mweh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeThreadedBEHType>>(details::makeThreadedBEH, "process-pre-order-threaded-beh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPostOrder<MakeThreadedBEHType>>(details::makeThreadedBEH, "process-post-order-threaded-beh"));
+            this->add_test(std::make_unique<HierarchyTestProcessLevelOrder<MakeThreadedBEHType>>(details::makeThreadedBEH, "process-level-order-threaded-beh"));
+            this->add_test(std::make_unique<BinaryHierarchyTestProcessInOrder<MakeThreadedBEHType>>(details::makeThreadedBEH, "process-in-order-threaded-beh"));
+            this->add_test(std::make_unique<BinaryHierarchyTestInOrderIterator<MakeThreadedBEHType>>(details::makeThreadedBEH, "in-order-iterator-threaded-beh"));
+            this->add_test(std::make_unique<BinaryHierarchyTestInOrderNeighbours<MakeThreadedBEHType>>(details::makeThreadedBEH, "in-order-neighbours-threaded-beh"));
+            this->add_test(std::make_unique<ThreadedBinaryHierarchyTestChanges>());
+            this->add_test(std::make_unique<HierarchyTestDeepTraversal>());
+            this->add_test(std::make_unique<HierarchyTestWideTraversal>());
+            this->add_test(std::make_unique<HierarchyTestDeepIterators>());
+            this->add_test(std::make_unique<HierarchyTestIteratorCopy>());
+            this->add_test(std::make_unique<HierarchyTestParallelFold>());
         }
     };
 }
@@ -183,6 +183,69 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests integer index math against a level-by-level construction.
+     */
+    class ImplicitHierarchyTestIndexMath : public LeafTest
+    {
+    public:
+        ImplicitHierarchyTestIndexMath() :
+            LeafTest("index-math")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            static_assert(amt::ImplicitHierarchy<int, 2>::indexOfParent(6) == 2);
+            static_assert(amt::ImplicitHierarchy<int, 3>::indexOfSon(1, 2) == 6);
+            static_assert(amt::ImplicitHierarchy<int, 4>::level(21) == 3);
+
+            this->testK<1>();
+            this->testK<2>();
+            this->testK<3>();
+            this->testK<4>();
+            this->testK<5>();
+            this->testK<8>();
+
+            constexpr size_t deepIndex = (static_cast<size_t>(1) << 52) - 1;
+            this->assert_equals(static_cast<size_t>(52), amt::ImplicitHierarchy<int, 2>::level(deepIndex));
+            this->assert_equals(static_cast<size_t>(51), amt::ImplicitHierarchy<int, 2>::level(deepIndex - 1));
+        }
+
+    private:
+        template<size_t K>
+        void testK()
+        {
+            const int n = 200;
+            auto hierarchy = details::makeIH<K>(n);
+            bool levelsMatch = true;
+            bool degreesMatch = true;
+            size_t levelStart = 0;
+            size_t levelSize = 1;
+            size_t level = 0;
+            for (size_t index = 0; index < static_cast<size_t>(n); ++index)
+            {
+                if (index >= levelStart + levelSize)
+                {
+                    levelStart += levelSize;
+                    levelSize *= K;
+                    ++level;
+                }
+                levelsMatch = levelsMatch && hierarchy.level(index) == level;
+
+                size_t sons = 0;
+                for (size_t son = index + 1; son < static_cast<size_t>(n); ++son)
+                {
+                    sons += hierarchy.indexOfParent(son) == index ? 1 : 0;
+                }
+                degreesMatch = degreesMatch && hierarchy.degree(index) == sons;
+            }
+            this->assert_true(levelsMatch, "Levels are exact for K = " + std::to_string(K) + ".");
+            this->assert_true(degreesMatch, "Degrees are exact for K = " + std::to_string(K) + ".");
+        }
+    };
+
     /**
      *  @brief Tests removal of the last leaf.
      */
@@ -258,6 +321,7 @@ namespace ds::tests
             this->add_test(std::make_unique<ImplicitHierarchyTestInsert>());
             this->add_test(std::make_unique<ImplicitHierarchyTestAccess>());
             this->add_test(std::make_unique<ImplicitHierarchyTestLevelsCountsDegs>());
+            this->add_test(std::make_unique<ImplicitHierarchyTestIndexMath>());
             this->add_test(std::make_unique<ImplicitHierarchyTestRemove>());
             this->add_test(std::make_unique<ImplicitHierarchyTestCopyAssign>());
         }
@@ -4,6 +4,9 @@
 #include <tests/amt/sequence.test.h>
 #include <libds/amt/implicit_sequence.h>
 #include <memory>
+#include <random>
+#include <string>
+#include <vector>
 
 namespace ds::tests
 {
@@ -67,6 +70,275 @@ namespace ds::tests
         }
     };
 
+    /**
+     *  @brief Tests deferred removal with tombstones.
+     */
+    class ImplicitSequenceTestMarkRemoved : public LeafTest
+    {
+    public:
+        ImplicitSequenceTestMarkRemoved() :
+            LeafTest("markRemoved")
+        {
+        }
+
+        void test() override
+        {
+            amt::ImplicitSequence<int> seq;
+            seq.setCompactionThreshold(0.5);
+            for (int i = 0; i < 10; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+
+            seq.markRemoved(0);
+            seq.markRemoved(4);
+            seq.markRemoved(5);
+            seq.markRemoved(9);
+            this->assert_equals(static_cast<size_t>(6), seq.liveCount());
+            this->assert_equals(static_cast<size_t>(10), seq.size());
+            this->assert_equals(static_cast<size_t>(4), seq.getRemovedCount());
+            this->assert_true(seq.isRemoved(4), "Block is marked.");
+            this->assert_true(seq.access(4) == nullptr, "Tombstone is not accessible.");
+            this->assert_equals(1, seq.accessFirst()->data_);
+            this->assert_equals(8, seq.accessLast()->data_);
+            this->assert_equals(6, seq.accessNext(*seq.access(3))->data_);
+            this->assert_equals(3, seq.accessPrevious(*seq.access(6))->data_);
+
+            std::vector<int> live;
+            for (int data : seq)
+            {
+                live.push_back(data);
+            }
+            this->assert_true(live == std::vector<int>({1, 2, 3, 6, 7, 8}), "Iteration skips tombstones.");
+
+            // Indices keep counting tombstones, so an indexed pass reaches the last block.
+            std::vector<int> indexed;
+            for (size_t i = 0; i < seq.size(); ++i)
+            {
+                if (!seq.isRemoved(i))
+                {
+                    indexed.push_back(seq.access(i)->data_);
+                }
+            }
+            this->assert_true(indexed == live, "Indexed access sees the same blocks.");
+            this->assert_equals(8, seq.access(8)->data_);
+            this->assert_true(seq.access(seq.size() - 1) == nullptr, "Last slot is a tombstone.");
+
+            seq.insertFirst().data_ = -1;
+            this->assert_true(seq.isRemoved(1) && !seq.isRemoved(0), "Tombstones move with insertion.");
+            seq.remove(1);
+            this->assert_equals(static_cast<size_t>(3), seq.getRemovedCount());
+
+            seq.markRemoved(7);
+            seq.markRemoved(6);
+            this->assert_false(seq.compactIfSparse(), "Sequence below the threshold is not compacted.");
+            seq.markRemoved(2);
+            this->assert_equals(static_cast<size_t>(6), seq.getRemovedCount());
+            this->assert_equals(8, seq.access(8)->data_);
+            this->assert_true(seq.compactIfSparse(), "Sequence above the threshold is compacted.");
+            this->assert_equals(static_cast<size_t>(0), seq.getRemovedCount());
+            this->assert_equals(static_cast<size_t>(4), seq.size());
+            this->assert_equals(static_cast<size_t>(4), seq.liveCount());
+            this->assert_equals(-1, seq.access(0)->data_);
+            this->assert_equals(1, seq.access(1)->data_);
+            this->assert_equals(3, seq.access(2)->data_);
+            this->assert_equals(8, seq.access(3)->data_);
+        }
+    };
+
+    /**
+     *  @brief Tests single pass removal by a predicate.
+     */
+    class ImplicitSequenceTestRemoveIf : public LeafTest
+    {
+    public:
+        ImplicitSequenceTestRemoveIf() :
+            LeafTest("removeIf")
+        {
+        }
+
+        void test() override
+        {
+            amt::ImplicitSequence<int> seq;
+            for (int i = 0; i < 20; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+            seq.markRemoved(1);
+
+            const size_t removed = seq.removeIf([](amt::MemoryBlock<int>* b) { return b->data_ % 3 == 0; });
+            this->assert_equals(static_cast<size_t>(7), removed);
+            this->assert_equals(static_cast<size_t>(12), seq.size());
+            this->assert_equals(static_cast<size_t>(0), seq.getRemovedCount());
+
+            bool kept = true;
+            int expected = 2;
+            for (int data : seq)
+            {
+                kept = kept && data == expected;
+                expected += expected % 3 == 1 ? 1 : 2;
+            }
+            this->assert_true(kept, "Order of kept blocks is preserved.");
+        }
+    };
+
+    /**
+     *  @brief Tests copy-on-write copies of a sequence.
+     */
+    class ImplicitSequenceTestCopyOnWrite : public LeafTest
+    {
+    public:
+        ImplicitSequenceTestCopyOnWrite() :
+            LeafTest("copyOnWrite")
+        {
+        }
+
+        void test() override
+        {
+            amt::ImplicitSequence<int> seq;
+            seq.setCopyOnWrite(true);
+            for (int i = 0; i < 10; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+
+            amt::ImplicitSequence<int> snapshot(seq);
+            this->assert_true(snapshot.isCopyOnWrite(), "Copy keeps the mode.");
+            this->assert_true(seq.read(5) == snapshot.read(5), "Snapshot shares the buffer.");
+
+            int sum = 0;
+            const amt::ImplicitSequence<int>& constSnapshot = snapshot;
+            for (const int data : constSnapshot)
+            {
+                sum += data;
+            }
+            this->assert_equals(45, sum);
+            this->assert_true(seq.read(5) == snapshot.read(5), "Read-only traversals keep the buffer shared.");
+
+            // Writable access copies the shared buffer on both sides, without an explicit detach.
+            snapshot.access(1)->data_ = 100;
+            this->assert_equals(1, seq.read(1)->data_);
+            seq.accessFirst()->data_ = 50;
+            this->assert_equals(0, snapshot.read(0)->data_);
+            this->assert_equals(100, snapshot.read(1)->data_);
+
+            amt::ImplicitSequence<int> assigned;
+            assigned.assign(seq);
+            this->assert_true(assigned.read(0) == seq.read(0), "Assigned copy shares the buffer.");
+            for (int& data : assigned)
+            {
+                data = 7;
+            }
+            this->assert_equals(2, seq.read(2)->data_);
+            for (int& data : seq)
+            {
+                data = -data;
+            }
+            this->assert_equals(7, assigned.read(0)->data_);
+            this->assert_equals(2, snapshot.read(2)->data_);
+            this->assert_equals(-50, seq.read(0)->data_);
+
+            seq.access(5)->data_ = 50;
+            seq.insertFirst().data_ = -1;
+            this->assert_equals(5, snapshot.read(5)->data_);
+            this->assert_equals(static_cast<size_t>(10), snapshot.size());
+            this->assert_equals(50, seq.read(6)->data_);
+
+            amt::ImplicitSequence<int> other;
+            other.assign(snapshot);
+            this->assert_true(other.equals(snapshot), "Assigned copy equals.");
+            other.removeLast();
+            this->assert_equals(static_cast<size_t>(10), snapshot.size());
+            this->assert_equals(9, snapshot.accessLast()->data_);
+        }
+    };
+
+    /**
+     *  @brief Compares vectorized kernels with scalar loops.
+     *  @tparam DataType Arithmetic type of the data.
+     */
+    template<typename DataType>
+    class ImplicitSequenceTestKernels : public LeafTest
+    {
+    public:
+        explicit ImplicitSequenceTestKernels(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+        void test() override
+        {
+            std::default_random_engine rng(144);
+            std::uniform_int_distribution<int> values(-50, 50);
+
+            for (size_t size : {0, 1, 3, 7, 8, 9, 31, 100, 1001})
+            {
+                amt::ImplicitSequence<DataType> seq;
+                std::vector<DataType> data;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    data.push_back(static_cast<DataType>(values(rng)));
+                    seq.insertLast().data_ = data.back();
+                }
+
+                const DataType* first = data.data();
+                const DataType needle = static_cast<DataType>(7);
+                const std::vector<DataType> any = { static_cast<DataType>(100), static_cast<DataType>(-13) };
+
+                this->assertSame(simd::scalar::find(first, size, needle), seq.find(needle));
+                this->assertSame(simd::scalar::count(first, size, needle), seq.count(needle));
+                this->assertSame(simd::scalar::sum(first, size), seq.sum());
+                this->assertSame(simd::scalar::containsAny(first, size, any.data(), any.size()), seq.containsAny(any));
+                if (size > 0)
+                {
+                    this->assertSame(simd::scalar::minimum(first, size), seq.minimum());
+                    this->assertSame(simd::scalar::maximum(first, size), seq.maximum());
+                }
+
+#if defined(DS_SIMD_SSE2)
+                if constexpr (simd::details::isVectorizable<DataType>)
+                {
+                    this->assertSame(simd::scalar::find(first, size, needle), simd::details::sse2::find(first, size, needle));
+                    this->assertSame(simd::scalar::sum(first, size), simd::details::sse2::sum(first, size));
+                    if (simd::details::hasAvx2())
+                    {
+                        this->assertSame(simd::scalar::find(first, size, needle), simd::details::avx2::find(first, size, needle));
+                        this->assertSame(simd::scalar::sum(first, size), simd::details::avx2::sum(first, size));
+                    }
+                }
+#endif
+
+                if (size > 8)
+                {
+                    seq.markRemoved(0);
+                    seq.markRemoved(size / 2);
+                    data.erase(data.begin() + static_cast<std::ptrdiff_t>(size / 2));
+                    data.erase(data.begin());
+                    first = data.data();
+
+                    this->assertSame(simd::scalar::count(first, size - 2, needle), seq.count(needle));
+                    this->assertSame(simd::scalar::sum(first, size - 2), seq.sum());
+                    this->assertSame(simd::scalar::minimum(first, size - 2), seq.minimum());
+                    this->assertSame(simd::scalar::maximum(first, size - 2), seq.maximum());
+                }
+            }
+        }
+
+    private:
+        template<typename T>
+        void assertSame(T expected, T actual)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                this->assert_equals(expected, actual, static_cast<T>(1e-9));
+            }
+            else
+            {
+                this->assert_equals(expected, actual);
+            }
+        }
+    };
+
     /**
      *  @brief All ImplicitSequenceTests.
      */
@@ -79,6 +351,13 @@ namespace ds::tests
             this->add_test(std::make_unique<GenericSequenceTest<amt::ImplicitSequence<int>>>());
             this->add_test(std::make_unique<ImplicitSequenceTestIndexOfRelative>());
             this->add_test(std::make_unique<CyclicImplicitSequenceTestIndexOfRelative>());
+            this->add_test(std::make_unique<ImplicitSequenceTestMarkRemoved>());
+            this->add_test(std::make_unique<ImplicitSequenceTestRemoveIf>());
+            this->add_test(std::make_unique<ImplicitSequenceTestCopyOnWrite>());
+            this->add_test(std::make_unique<ImplicitSequenceTestKernels<int>>("kernels-int"));
+            this->add_test(std::make_unique<ImplicitSequenceTestKernels<double>>("kernels-double"));
+            this->add_test(std::make_unique<ImplicitSequenceTestKernels<float>>("kernels-float"));
+            this->add_test(std::make_unique<ImplicitSequenceTestKernels<short>>("kernels-short"));
         }
     };
 }
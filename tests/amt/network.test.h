@@ -0,0 +1,618 @@
+#pragma once
+
+#include <libds/amt/bit_matrix_network.h>
+#include <libds/amt/csr_network.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/amt/sorted_network.h>
+#include <libds/simd.h>
+#include <tests/_details/test.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ds::tests
+{
+    namespace details
+    {
+        // Random multigraph whose i-th node holds i.
+        template<class NetworkType>
+        void growRandomNetwork(NetworkType& network, int nodeCount, int relationCount)
+        {
+            std::default_random_engine rng(144);
+            std::vector<typename NetworkType::NodeType*> nodes;
+            for (int i = 0; i < nodeCount; ++i)
+            {
+                auto& node = network.insert();
+                node.data_ = i;
+                nodes.push_back(&node);
+            }
+            for (int i = 0; i < relationCount; ++i)
+            {
+                network.connect(*nodes[rng() % nodes.size()], *nodes[rng() % nodes.size()]);
+            }
+        }
+
+        // Checks that the snapshot has the same nodes and relations in the same order as the network.
+        template<class NetworkType>
+        bool snapshotMatches(const NetworkType& network, const amt::CsrNetwork<int>& snapshot)
+        {
+            if (network.size() != snapshot.size() || network.relationCount() != snapshot.relationCount())
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < network.size(); ++i)
+            {
+                auto* node = network.accessNodeFromGate(i);
+                auto* frozenNode = snapshot.accessNodeFromGate(i);
+                const size_t degree = network.degree(*node);
+                if (frozenNode->data_ != node->data_ || snapshot.degree(*frozenNode) != degree || snapshot.indexOf(*frozenNode) != i)
+                {
+                    return false;
+                }
+
+                std::vector<int> neighbours;
+                snapshot.processNeighbours(*frozenNode, [&neighbours](amt::MemoryBlock<int>* b) { neighbours.push_back(b->data_); });
+                if (neighbours.size() != degree)
+                {
+                    return false;
+                }
+                for (size_t order = 0; order < degree; ++order)
+                {
+                    const int data = network.accessNodeFromNode(*node, order)->data_;
+                    if (snapshot.accessNodeFromNode(*frozenNode, order)->data_ != data || neighbours[order] != data)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
+    /**
+     * @brief Tests that a snapshot matches networks with implicit and explicit relations.
+     */
+    class NetworkTestFreeze : public LeafTest
+    {
+    public:
+        NetworkTestFreeze() :
+            LeafTest("freeze")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            amt::IGIRNetwork<int> implicitNetwork;
+            details::growRandomNetwork(implicitNetwork, 300, 2000);
+            amt::CsrNetwork<int> implicitSnapshot = implicitNetwork.freeze();
+            this->assert_true(details::snapshotMatches(implicitNetwork, implicitSnapshot), "Snapshot of implicit relations matches.");
+
+            amt::EGERNetwork<int> explicitNetwork;
+            details::growRandomNetwork(explicitNetwork, 300, 2000);
+            amt::CsrNetwork<int> explicitSnapshot = explicitNetwork.freeze();
+            this->assert_true(details::snapshotMatches(explicitNetwork, explicitSnapshot), "Snapshot of explicit relations matches.");
+            this->assert_true(explicitSnapshot.equals(implicitSnapshot), "Snapshots of the same network are equal.");
+
+            std::default_random_engine rng(7);
+            bool relations = true;
+            for (int i = 0; i < 5000; ++i)
+            {
+                const size_t first = rng() % implicitNetwork.size();
+                const size_t second = rng() % implicitNetwork.size();
+                relations = relations &&
+                    implicitNetwork.relationExists(*implicitNetwork.accessNodeFromGate(first), *implicitNetwork.accessNodeFromGate(second)) ==
+                    implicitSnapshot.relationExists(*implicitSnapshot.accessNodeFromGate(first), *implicitSnapshot.accessNodeFromGate(second));
+            }
+            this->assert_true(relations, "Relations exist in both networks.");
+
+            implicitSnapshot.accessNodeFromGate(0)->data_ = -1;
+            this->assert_equals(0, implicitNetwork.accessNodeFromGate(0)->data_);
+            this->assert_false(explicitSnapshot.equals(implicitSnapshot), "Snapshots differ in data.");
+
+            amt::IGIRNetwork<int> emptyNetwork;
+            this->assert_true(emptyNetwork.freeze().isEmpty(), "Snapshot of an empty network is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests construction from arrays, assignment and unavailable modifications.
+     */
+    class NetworkTestCsrReadOnly : public LeafTest
+    {
+    public:
+        NetworkTestCsrReadOnly() :
+            LeafTest("csr-read-only")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            //  0 - 1 - 2   3
+            amt::CsrNetwork<int> network({ 10, 11, 12, 13 }, { 0, 1, 3, 4, 4 }, { 1, 0, 2, 1 });
+            auto& first = *network.accessNodeFromGate(0);
+            auto& second = *network.accessNodeFromGate(1);
+            auto& last = *network.accessNodeFromGate(3);
+            this->assert_equals(static_cast<size_t>(4), network.size());
+            this->assert_equals(static_cast<size_t>(4), network.relationCount());
+            this->assert_equals(static_cast<size_t>(2), network.degree(second));
+            this->assert_equals(static_cast<size_t>(0), network.degree(last));
+            this->assert_equals(12, network.accessNodeFromNode(second, 1)->data_);
+            this->assert_true(network.relationExists(first, second), "Relation exists.");
+            this->assert_false(network.relationExists(first, last), "Relation does not exist.");
+            this->assert_throws([&]() { network.accessNodeFromGate(4); });
+            this->assert_throws([&]() { network.accessNodeFromNode(last, 0); });
+
+            this->assert_throws([&]() { network.insert(); });
+            this->assert_throws([&]() { network.remove(&first); });
+            this->assert_throws([&]() { network.connect(first, last); });
+            this->assert_throws([&]() { network.disconnect(first, second); });
+
+            this->assert_throws([]() { amt::CsrNetwork<int>({ 1, 2 }, { 0, 1 }, { 1 }); });
+            this->assert_throws([]() { amt::CsrNetwork<int>({ 1, 2 }, { 0, 2, 1 }, { 1 }); });
+            this->assert_throws([]() { amt::CsrNetwork<int>({ 1, 2 }, { 0, 1, 2 }, { 1, 2 }); });
+
+            amt::CsrNetwork<int> copy;
+            this->assert_true(copy.isEmpty(), "New network is empty.");
+            copy.assign(network);
+            this->assert_true(copy.equals(network), "Assigned network is equal.");
+            copy.clear();
+            this->assert_equals(static_cast<size_t>(0), copy.relationCount());
+            this->assert_false(copy.equals(network), "Cleared network differs.");
+        }
+    };
+
+    /**
+     * @brief Tests copies of networks with implicit and explicit relations, self-relations and repeated relations included.
+     */
+    class NetworkTestAssign : public LeafTest
+    {
+    public:
+        NetworkTestAssign() :
+            LeafTest("assign")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            this->testCopies<amt::IGIRNetwork<int>>("implicit");
+            this->testCopies<amt::EGERNetwork<int>>("explicit");
+        }
+
+    private:
+        template<class NetworkType>
+        void testCopies(const std::string& name)
+        {
+            NetworkType network;
+            details::growRandomNetwork(network, 300, 2000);
+            network.connect(*network.accessNodeFromGate(7), *network.accessNodeFromGate(7));
+            network.connect(*network.accessNodeFromGate(7), *network.accessNodeFromGate(8));
+
+            NetworkType copy(network);
+            this->assert_true(copy.freeze().equals(network.freeze()), "Copy of " + name + " relations matches.");
+
+            NetworkType assigned;
+            details::growRandomNetwork(assigned, 10, 20);
+            assigned.assign(network);
+            this->assert_true(assigned.freeze().equals(network.freeze()), "Assigned " + name + " relations match.");
+            bool indices = true;
+            for (size_t i = 0; i < assigned.size(); ++i)
+            {
+                indices = indices && assigned.gateIndexOf(*assigned.accessNodeFromGate(i)) == i;
+            }
+            this->assert_true(indices, "Nodes know their gate indices.");
+
+            assigned.assign(NetworkType());
+            this->assert_equals(static_cast<size_t>(0), assigned.size());
+        }
+    };
+
+    /**
+     * @brief Tests removal of nodes against lists of relations, implicit gates move the last node to the removed one.
+     */
+    class NetworkTestRemove : public LeafTest
+    {
+    public:
+        NetworkTestRemove() :
+            LeafTest("remove")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            this->testRemovals<amt::IGIRNetwork<int>>("implicit", false);
+            this->testRemovals<amt::EGERNetwork<int>>("explicit", true);
+        }
+
+    private:
+        template<class NetworkType>
+        void testRemovals(const std::string& name, bool keepsOrder)
+        {
+            const int nodeCount = 200;
+            NetworkType network;
+            details::growRandomNetwork(network, nodeCount, 1000);
+            std::vector<std::multiset<int>> neighbours(nodeCount);
+            for (size_t i = 0; i < network.size(); ++i)
+            {
+                auto* node = network.accessNodeFromGate(i);
+                for (size_t order = 0; order < network.degree(*node); ++order)
+                {
+                    neighbours[node->data_].insert(network.accessNodeFromNode(*node, order)->data_);
+                }
+            }
+
+            std::default_random_engine rng(144);
+            bool moved = true;
+            for (int i = 0; i < nodeCount / 2; ++i)
+            {
+                const size_t gateIndex = rng() % network.size();
+                auto* node = network.accessNodeFromGate(gateIndex);
+                auto* lastNode = network.accessNodeFromGate(network.size() - 1);
+                const int data = node->data_;
+                for (int neighbour : neighbours[data])
+                {
+                    neighbours[neighbour].erase(data);
+                }
+                neighbours[data].clear();
+                network.remove(node);
+
+                if (!keepsOrder && gateIndex < network.size())
+                {
+                    moved = moved && network.accessNodeFromGate(gateIndex) == lastNode;
+                }
+            }
+            this->assert_true(moved, "Last node takes place of a removed one in " + name + " gate.");
+            this->assert_equals(static_cast<size_t>(nodeCount / 2), network.size());
+
+            bool matches = true;
+            for (size_t i = 0; i < network.size(); ++i)
+            {
+                auto* node = network.accessNodeFromGate(i);
+                std::multiset<int> nodeNeighbours;
+                for (size_t order = 0; order < network.degree(*node); ++order)
+                {
+                    nodeNeighbours.insert(network.accessNodeFromNode(*node, order)->data_);
+                }
+                matches = matches && network.gateIndexOf(*node) == i && nodeNeighbours == neighbours[node->data_] &&
+                          (!keepsOrder || i == 0 || network.accessNodeFromGate(i - 1)->data_ < node->data_);
+            }
+            this->assert_true(matches, "Relations and gate indices match after removals from " + name + " gate.");
+        }
+    };
+
+    /**
+     * @brief Tests sorted relations against a set of pairs, with a hub whose relations are hashed.
+     */
+    class NetworkTestSortedRelations : public LeafTest
+    {
+    public:
+        NetworkTestSortedRelations() :
+            LeafTest("sorted-relations")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using NetworkType = amt::IGSRNetwork<int>;
+            using BlockType = NetworkType::BlockType;
+
+            const int nodeCount = 100;
+            NetworkType network;
+            std::vector<BlockType*> nodes;
+            for (int i = 0; i < nodeCount; ++i)
+            {
+                nodes.push_back(&network.insert());
+                nodes.back()->data_ = i;
+            }
+
+            std::set<std::pair<int, int>> relations;
+            auto connect = [&](int a, int b)
+                {
+                    network.connect(*nodes[a], *nodes[b]);
+                    relations.emplace(std::min(a, b), std::max(a, b));
+                };
+            auto disconnect = [&](int a, int b)
+                {
+                    network.disconnect(*nodes[a], *nodes[b]);
+                    relations.erase({ std::min(a, b), std::max(a, b) });
+                };
+            auto matches = [&]() -> bool
+                {
+                    std::vector<size_t> degrees(nodeCount, 0);
+                    for (const auto& [a, b] : relations)
+                    {
+                        ++degrees[a];
+                        degrees[b] += a != b ? 1 : 0;
+                    }
+
+                    const std::less<const BlockType*> less;
+                    for (int a = 0; a < nodeCount; ++a)
+                    {
+                        const size_t degree = network.degree(*nodes[a]);
+                        if (degree != degrees[a] ||
+                            (degree >= NetworkType::HASH_THRESHOLD && nodes[a]->hashedRelations_ == nullptr) ||
+                            (degree < NetworkType::HASH_THRESHOLD / 2 && nodes[a]->hashedRelations_ != nullptr))
+                        {
+                            return false;
+                        }
+                        for (size_t order = 1; order < degree; ++order)
+                        {
+                            if (!less(network.accessNodeFromNode(*nodes[a], order - 1), network.accessNodeFromNode(*nodes[a], order)))
+                            {
+                                return false;
+                            }
+                        }
+                        for (int b = 0; b < nodeCount; ++b)
+                        {
+                            if (network.relationExists(*nodes[a], *nodes[b]) != (relations.count({ std::min(a, b), std::max(a, b) }) == 1))
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                };
+
+            for (int i = 1; i < nodeCount; ++i)
+            {
+                connect(0, i);
+            }
+            connect(5, 5);
+            connect(5, 0);
+            this->assert_equals(static_cast<size_t>(nodeCount - 1), network.degree(*nodes[0]));
+            this->assert_true(matches(), "Relations match with a hub.");
+
+            std::default_random_engine rng(144);
+            bool stillMatches = true;
+            for (int i = 0; i < 20000 && stillMatches; ++i)
+            {
+                // Half of the changes touch the hub, so its degree falls and rises across the threshold.
+                const int a = i % 2 == 0 ? 0 : static_cast<int>(rng() % nodeCount);
+                const int b = static_cast<int>(rng() % nodeCount);
+                if (rng() % 2 == 0)
+                {
+                    connect(a, b);
+                }
+                else
+                {
+                    disconnect(a, b);
+                }
+                stillMatches = i % 1000 != 0 || matches();
+            }
+            this->assert_true(stillMatches && matches(), "Relations match after random changes.");
+
+            for (int i = 0; i < nodeCount; ++i)
+            {
+                disconnect(0, i);
+            }
+            this->assert_true(nodes[0]->hashedRelations_ == nullptr && matches(), "Hash set is dropped with relations.");
+
+            amt::CsrNetwork<int> snapshot = network.freeze();
+            this->assert_true(details::snapshotMatches(network, snapshot), "Snapshot matches.");
+
+            NetworkType copy(network);
+            bool copied = copy.size() == network.size();
+            for (size_t a = 0; a < copy.size() && copied; ++a)
+            {
+                auto* node = copy.accessNodeFromGate(a);
+                copied = node->data_ == network.accessNodeFromGate(a)->data_ && network.degree(*node) == network.degree(*network.accessNodeFromGate(a));
+                for (size_t order = 1; order < copy.degree(*node) && copied; ++order)
+                {
+                    copied = std::less<const BlockType*>()(copy.accessNodeFromNode(*node, order - 1), copy.accessNodeFromNode(*node, order));
+                }
+                for (size_t b = 0; b < copy.size() && copied; ++b)
+                {
+                    copied = copy.relationExists(*node, *copy.accessNodeFromGate(b)) ==
+                             network.relationExists(*network.accessNodeFromGate(a), *network.accessNodeFromGate(b));
+                }
+            }
+            this->assert_true(copied, "Copy has the same sorted relations.");
+
+            for (int i = 1; i < nodeCount; ++i)
+            {
+                connect(0, i);
+            }
+            network.remove(nodes[0]);
+            nodes[0] = nullptr;
+            bool removed = true;
+            for (int i = 1; i < nodeCount; ++i)
+            {
+                removed = removed && network.accessNodeFromGate(nodes[i]->gateIndex_) == nodes[i] && network.relationExists(*nodes[i], *nodes[i]) == (relations.count({ i, i }) == 1);
+                for (size_t order = 0; order < network.degree(*nodes[i]); ++order)
+                {
+                    removed = removed && network.accessNodeFromNode(*nodes[i], order)->data_ != 0;
+                }
+            }
+            this->assert_true(removed, "Relations of a removed hub are removed.");
+            this->assert_equals(static_cast<size_t>(nodeCount - 1), network.size());
+        }
+    };
+
+    /**
+     * @brief Tests the bit matrix network and its row kernels against a matrix of flags indexed by data of nodes.
+     */
+    class NetworkTestBitMatrix : public LeafTest
+    {
+    public:
+        NetworkTestBitMatrix() :
+            LeafTest("bit-matrix")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using NetworkType = amt::BitMatrixNetwork<int>;
+            using BlockType = NetworkType::BlockType;
+
+            std::default_random_engine rng(144);
+            bool kernels = true;
+            for (size_t count = 0; count < 40; ++count)
+            {
+                std::vector<std::uint64_t> a(count);
+                std::vector<std::uint64_t> b(count);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    a[i] = (static_cast<std::uint64_t>(rng()) << 32) ^ rng();
+                    b[i] = (static_cast<std::uint64_t>(rng()) << 32) ^ rng();
+                }
+                kernels = kernels && simd::popcount(a.data(), count) == simd::scalar::popcount(a.data(), count);
+                kernels = kernels && simd::andPopcount(a.data(), b.data(), count) == simd::scalar::andPopcount(a.data(), b.data(), count);
+                kernels = kernels && simd::orPopcount(a.data(), b.data(), count) == simd::scalar::orPopcount(a.data(), b.data(), count);
+#if defined(DS_SIMD_SSE2)
+                kernels = kernels && simd::details::sse2::andPopcount(a.data(), b.data(), count) == simd::scalar::andPopcount(a.data(), b.data(), count);
+                kernels = kernels && simd::details::sse2::orPopcount(a.data(), b.data(), count) == simd::scalar::orPopcount(a.data(), b.data(), count);
+#endif
+            }
+            this->assert_true(kernels, "Bit counts of words match the scalar loops.");
+
+            const int nodeCount = 150;
+            NetworkType network;
+            std::vector<BlockType*> nodes;
+            for (int i = 0; i < nodeCount; ++i)
+            {
+                nodes.push_back(&network.insert());
+                nodes.back()->data_ = i;
+            }
+
+            std::vector<std::vector<bool>> related(nodeCount, std::vector<bool>(nodeCount, false));
+            std::vector<bool> present(nodeCount, true);
+            auto matches = [&]() -> bool
+                {
+                    size_t relationCount = 0;
+                    for (size_t a = 0; a < network.size(); ++a)
+                    {
+                        BlockType* nodeA = network.accessNodeFromGate(a);
+                        std::vector<int> neighbours;
+                        for (size_t b = 0; b < network.size(); ++b)
+                        {
+                            BlockType* nodeB = network.accessNodeFromGate(b);
+                            const bool expected = related[nodeA->data_][nodeB->data_];
+                            if (network.relationExists(*nodeA, *nodeB) != expected)
+                            {
+                                return false;
+                            }
+                            if (expected)
+                            {
+                                neighbours.push_back(nodeB->data_);
+                            }
+                        }
+                        if (nodeA->gateIndex_ != a || network.degree(*nodeA) != neighbours.size())
+                        {
+                            return false;
+                        }
+                        for (size_t order = 0; order < neighbours.size(); ++order)
+                        {
+                            if (network.accessNodeFromNode(*nodeA, order)->data_ != neighbours[order])
+                            {
+                                return false;
+                            }
+                        }
+                        relationCount += neighbours.size();
+                    }
+                    return relationCount == network.relationCount();
+                };
+            auto change = [&](int a, int b, bool connect)
+                {
+                    if (connect)
+                    {
+                        network.connect(*nodes[a], *nodes[b]);
+                    }
+                    else
+                    {
+                        network.disconnect(*nodes[a], *nodes[b]);
+                    }
+                    related[a][b] = connect;
+                    related[b][a] = connect;
+                };
+
+            bool stillMatches = true;
+            for (int i = 0; i < 20000 && stillMatches; ++i)
+            {
+                const int a = static_cast<int>(rng() % nodeCount);
+                const int b = i % 50 == 0 ? a : static_cast<int>(rng() % nodeCount);
+                change(a, b, rng() % 3 != 0);
+                stillMatches = i % 2000 != 0 || matches();
+            }
+            this->assert_true(stillMatches && matches(), "Relations match after random changes.");
+            this->assert_throws([&network, &nodes]() { network.accessNodeFromNode(*nodes[0], network.degree(*nodes[0])); });
+
+            bool counts = true;
+            size_t triangles = 0;
+            for (int a = 0; a < nodeCount; ++a)
+            {
+                for (int b = 0; b < nodeCount; ++b)
+                {
+                    size_t common = 0;
+                    size_t united = 0;
+                    for (int c = 0; c < nodeCount; ++c)
+                    {
+                        common += related[a][c] && related[b][c] ? 1 : 0;
+                        united += related[a][c] || related[b][c] ? 1 : 0;
+                        triangles += a < b && b < c && related[a][b] && related[b][c] && related[a][c] ? 1 : 0;
+                    }
+                    counts = counts && network.commonNeighbourCount(*nodes[a], *nodes[b]) == common && network.neighbourUnionCount(*nodes[a], *nodes[b]) == united;
+                }
+            }
+            this->assert_true(counts, "Common neighbours and unions of neighbours match.");
+            this->assert_equals(triangles, network.triangleCount());
+
+            NetworkType copy(network);
+            this->assert_true(copy.equals(network), "Copy is equal.");
+            copy.connect(*copy.accessNodeFromGate(0), *copy.accessNodeFromGate(1));
+            copy.disconnect(*copy.accessNodeFromGate(0), *copy.accessNodeFromGate(2));
+            this->assert_true(copy.equals(network) == (related[0][1] && !related[0][2]), "Changed copy differs.");
+
+            for (int i = 0; i < 40; ++i)
+            {
+                const int victim = static_cast<int>(rng() % nodeCount);
+                if (present[victim])
+                {
+                    network.remove(nodes[victim]);
+                    present[victim] = false;
+                    for (int other = 0; other < nodeCount; ++other)
+                    {
+                        related[victim][other] = false;
+                        related[other][victim] = false;
+                    }
+                }
+            }
+            this->assert_true(matches(), "Relations match after removals.");
+            const size_t remaining = static_cast<size_t>(std::count(present.begin(), present.end(), true));
+            this->assert_equals(remaining, network.size());
+
+            network.clear();
+            this->assert_true(network.isEmpty() && network.relationCount() == 0, "Cleared network is empty.");
+        }
+    };
+
+    /**
+     * @brief All network tests.
+     */
+    class NetworkTest : public CompositeTest
+    {
+    public:
+        NetworkTest() :
+            CompositeTest("Network")
+        {
+            this->add_test(std::make_unique<NetworkTestFreeze>());
+            this->add_test(std::make_unique<NetworkTestCsrReadOnly>());
+            this->add_test(std::make_unique<NetworkTestAssign>());
+            this->add_test(std::make_unique<NetworkTestRemove>());
+            this->add_test(std::make_unique<NetworkTestSortedRelations>());
+            this->add_test(std::make_unique<NetworkTestBitMatrix>());
+        }
+    };
+}
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <libds/amt/explicit_hierarchy.h>
+#include <libds/amt/succinct_hierarchy.h>
+#include <tests/_details/test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ds::tests
+{
+    namespace details
+    {
+        // Every third node deepens the hierarchy, the others attach anywhere.
+        inline void growRandomMWEH(amt::MultiWayExplicitHierarchy<int>& hierarchy, std::vector<amt::MWEHBlock<int>*>& nodes, int count)
+        {
+            std::default_random_engine rng(144);
+            nodes.push_back(&hierarchy.emplaceRoot());
+            for (int i = 1; i < count; ++i)
+            {
+                auto* parent = i % 3 == 0 ? nodes.back() : nodes[rng() % nodes.size()];
+                auto& son = hierarchy.emplaceSon(*parent, rng() % (hierarchy.degree(*parent) + 1));
+                son.data_ = i;
+                nodes.push_back(&son);
+            }
+        }
+    }
+
+    /**
+     * @brief Tests that navigation matches the explicit hierarchy it was built from.
+     */
+    class SuccinctHierarchyTestNavigation : public LeafTest
+    {
+    public:
+        SuccinctHierarchyTestNavigation() :
+            LeafTest("navigation")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            for (int count : { 1, 2, 300, 5000 })
+            {
+                amt::MultiWayExplicitHierarchy<int> source;
+                std::vector<amt::MWEHBlock<int>*> nodes;
+                details::growRandomMWEH(source, nodes, count);
+                amt::SuccinctHierarchy<int> hierarchy(source);
+                this->assert_equals(static_cast<size_t>(count), hierarchy.size());
+
+                // Nodes of both hierarchies are paired by their pre-order.
+                std::vector<amt::MWEHBlock<int>*> sourceNodes;
+                source.processPreOrder(source.accessRoot(), [&sourceNodes](const amt::MWEHBlock<int>* b)
+                    {
+                        sourceNodes.push_back(const_cast<amt::MWEHBlock<int>*>(b));
+                    });
+                std::vector<amt::MemoryBlock<int>*> succinctNodes;
+                hierarchy.processPreOrder(hierarchy.accessRoot(), [&succinctNodes](const amt::MemoryBlock<int>* b)
+                    {
+                        succinctNodes.push_back(const_cast<amt::MemoryBlock<int>*>(b));
+                    });
+                this->assert_equals(sourceNodes.size(), succinctNodes.size());
+
+                bool matches = true;
+                for (size_t i = 0; i < sourceNodes.size() && matches; ++i)
+                {
+                    auto* sourceNode = sourceNodes[i];
+                    auto* node = succinctNodes[i];
+                    const size_t degree = source.degree(*sourceNode);
+                    auto* sourceParent = source.accessParent(*sourceNode);
+                    auto* parent = hierarchy.accessParent(*node);
+                    matches = node == hierarchy.accessRoot() + i &&
+                              node->data_ == sourceNode->data_ &&
+                              hierarchy.degree(*node) == degree &&
+                              hierarchy.isLeaf(*node) == (degree == 0) &&
+                              hierarchy.level(*node) == source.level(*sourceNode) &&
+                              hierarchy.nodeCount(*node) == source.nodeCount(*sourceNode) &&
+                              (sourceParent == nullptr ? parent == nullptr : parent != nullptr && parent->data_ == sourceParent->data_) &&
+                              hierarchy.accessSon(*node, degree) == nullptr;
+                    for (size_t order = 0; order < degree && matches; ++order)
+                    {
+                        auto* son = hierarchy.accessSon(*node, order);
+                        matches = son != nullptr && son->data_ == source.accessSon(*sourceNode, order)->data_;
+                    }
+                }
+                this->assert_true(matches, "Nodes match for " + std::to_string(count) + " nodes.");
+
+                std::vector<int> expected;
+                std::vector<int> actual;
+                source.processPostOrder(source.accessRoot(), [&expected](amt::MWEHBlock<int>* b) { expected.push_back(b->data_); });
+                hierarchy.processPostOrder(hierarchy.accessRoot(), [&actual](amt::MemoryBlock<int>* b) { actual.push_back(b->data_); });
+                this->assert_true(expected == actual, "Post-order matches.");
+
+                expected.clear();
+                actual.clear();
+                for (int data : source)
+                {
+                    expected.push_back(data);
+                }
+                for (int data : hierarchy)
+                {
+                    actual.push_back(data);
+                }
+                this->assert_true(expected == actual, "Iterator matches.");
+            }
+        }
+    };
+
+    /**
+     * @brief Tests a deep hierarchy, whose excess spans many blocks of the min-max tree.
+     */
+    class SuccinctHierarchyTestDeep : public LeafTest
+    {
+    public:
+        SuccinctHierarchyTestDeep() :
+            LeafTest("deep")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            // A path of 3000 nodes, every node of it has also a leaf as its second son.
+            const size_t length = 3000;
+            amt::MultiWayExplicitHierarchy<int> source;
+            auto* node = &source.emplaceRoot();
+            for (size_t i = 1; i < length; ++i)
+            {
+                auto* next = &source.emplaceSon(*node, 0);
+                source.emplaceSon(*node, 1);
+                node = next;
+            }
+
+            amt::SuccinctHierarchy<int> hierarchy(source);
+            auto* root = hierarchy.accessRoot();
+            this->assert_equals(2 * length - 1, hierarchy.nodeCount(*root));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.degree(*root));
+
+            auto* deepest = root;
+            while (!hierarchy.isLeaf(*deepest))
+            {
+                deepest = hierarchy.accessSon(*deepest, 0);
+            }
+            this->assert_equals(length - 1, hierarchy.level(*deepest));
+
+            auto* lastLeaf = hierarchy.accessSon(*root, 1);
+            this->assert_equals(root, hierarchy.accessParent(*lastLeaf));
+            this->assert_equals(2 * length - 2, static_cast<size_t>(lastLeaf - root));
+
+            size_t steps = 0;
+            for (auto* ancestor = hierarchy.accessParent(*deepest); ancestor != nullptr; ancestor = hierarchy.accessParent(*ancestor))
+            {
+                ++steps;
+            }
+            this->assert_equals(length - 1, steps);
+        }
+    };
+
+    /**
+     * @brief Tests writing the image and using it in place.
+     */
+    class SuccinctHierarchyTestImage : public LeafTest
+    {
+    public:
+        SuccinctHierarchyTestImage() :
+            LeafTest("image")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            amt::MultiWayExplicitHierarchy<int> source;
+            std::vector<amt::MWEHBlock<int>*> nodes;
+            details::growRandomMWEH(source, nodes, 2000);
+            amt::SuccinctHierarchy<int> hierarchy(source);
+
+            std::ostringstream output;
+            hierarchy.writeImage(output);
+            const std::string bytes = output.str();
+            this->assert_equals(hierarchy.getImageSize(), bytes.size());
+
+            std::vector<std::uint64_t> image(bytes.size() / sizeof(std::uint64_t));
+            std::memcpy(image.data(), bytes.data(), bytes.size());
+            amt::SuccinctHierarchy<int> mapped(image.data(), bytes.size());
+            this->assert_false(mapped.ownsImage(), "Mapped hierarchy uses the image in place.");
+            this->assert_equals(static_cast<const void*>(image.data()), mapped.getImage());
+            this->assert_true(mapped.equals(hierarchy), "Mapped hierarchy equals the original.");
+
+            auto* root = mapped.accessRoot();
+            const auto* rootAddress = reinterpret_cast<const unsigned char*>(root);
+            const auto* imageAddress = reinterpret_cast<const unsigned char*>(image.data());
+            this->assert_true(rootAddress > imageAddress && rootAddress < imageAddress + bytes.size(), "Data lie in the image.");
+            this->assert_equals(hierarchy.degree(*hierarchy.accessRoot()), mapped.degree(*root));
+            this->assert_equals(hierarchy.nodeCount(*hierarchy.accessRoot()), mapped.nodeCount(*root));
+
+            mapped.accessSon(*root, 0)->data_ = -1;
+            this->assert_false(mapped.equals(hierarchy), "Data are changed in the image.");
+
+            amt::SuccinctHierarchy<int> copy(mapped);
+            this->assert_true(copy.ownsImage(), "Copy owns its image.");
+            this->assert_true(copy.equals(mapped), "Copy equals the mapped hierarchy.");
+
+            // The root opens at the lowest bit of the first word after the four header words.
+            image[4] ^= 1;
+            this->assert_throws([&]() { amt::SuccinctHierarchy<int>(image.data(), bytes.size()); });
+            image[4] ^= 1;
+            const size_t ranksWord = 4 + (2 * hierarchy.size() + 63) / 64;
+            ++image[ranksWord + 1];
+            this->assert_throws([&]() { amt::SuccinctHierarchy<int>(image.data(), bytes.size()); });
+            --image[ranksWord + 1];
+            amt::SuccinctHierarchy<int> restored(image.data(), bytes.size());
+            this->assert_true(restored.equals(mapped), "Restored image is accepted.");
+
+            image[0] = 0;
+            this->assert_throws([&]() { amt::SuccinctHierarchy<int>(image.data(), bytes.size()); });
+            this->assert_throws([&]() { amt::SuccinctHierarchy<int>(image.data() + 1, 8); });
+        }
+    };
+
+    /**
+     * @brief Tests the empty hierarchy, assignment and unavailable modifications.
+     */
+    class SuccinctHierarchyTestReadOnly : public LeafTest
+    {
+    public:
+        SuccinctHierarchyTestReadOnly() :
+            LeafTest("read-only")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            amt::SuccinctHierarchy<int> empty;
+            this->assert_true(empty.isEmpty(), "New hierarchy is empty.");
+            this->assert_equals(static_cast<amt::MemoryBlock<int>*>(nullptr), empty.accessRoot());
+
+            amt::MultiWayExplicitHierarchy<int> source;
+            std::vector<amt::MWEHBlock<int>*> nodes;
+            details::growRandomMWEH(source, nodes, 100);
+            amt::SuccinctHierarchy<int> hierarchy(source);
+            auto& root = *hierarchy.accessRoot();
+            this->assert_throws([&]() { hierarchy.emplaceRoot(); });
+            this->assert_throws([&]() { hierarchy.emplaceSon(root, 0); });
+            this->assert_throws([&]() { hierarchy.removeSon(root, 0); });
+
+            empty.assign(hierarchy);
+            this->assert_true(empty.equals(hierarchy), "Assigned hierarchy is equal.");
+            empty.clear();
+            this->assert_equals(static_cast<size_t>(0), empty.size());
+            this->assert_false(empty.equals(hierarchy), "Cleared hierarchy differs.");
+        }
+    };
+
+    /**
+     * @brief All succinct hierarchy tests.
+     */
+    class SuccinctHierarchyTest : public CompositeTest
+    {
+    public:
+        SuccinctHierarchyTest() :
+            CompositeTest("SuccinctHierarchy")
+        {
+            this->add_test(std::make_unique<SuccinctHierarchyTestNavigation>());
+            this->add_test(std::make_unique<SuccinctHierarchyTestDeep>());
+            this->add_test(std::make_unique<SuccinctHierarchyTestImage>());
+            this->add_test(std::make_unique<SuccinctHierarchyTestReadOnly>());
+        }
+    };
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <libds/amt/veb_implicit_hierarchy.h>
+#include <libds/adt/tree.h>
+#include <tests/_details/test.hpp>
+#include <memory>
+#include <vector>
+
+namespace ds::tests
+{
+    namespace details
+    {
+        inline amt::VebImplicitHierarchy<int> makeVebIH(const int n)
+        {
+            amt::VebImplicitHierarchy<int> hierarchy;
+            for (int i = 0; i < n; ++i)
+            {
+                hierarchy.insertLastLeaf().data_ = i;
+            }
+            return hierarchy;
+        }
+    }
+
+    /**
+     * @brief Tests that the layout maps BFS indices to distinct positions and back.
+     */
+    class VebImplicitHierarchyTestLayout : public LeafTest
+    {
+    public:
+        VebImplicitHierarchyTestLayout() :
+            LeafTest("layout")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            //          0
+            //      1       2
+            //    3   4   5   6
+            // Top tree {0}, bottom trees {1, 3, 4} and {2, 5, 6}.
+            auto small = details::makeVebIH(7);
+            const std::vector<size_t> expected = { 0, 1, 4, 2, 3, 5, 6 };
+            for (size_t index = 0; index < expected.size(); ++index)
+            {
+                this->assert_equals(expected[index], small.positionOf(index));
+            }
+
+            bool bijective = true;
+            for (int n : { 1, 2, 3, 15, 16, 100, 1023, 1024, 5000 })
+            {
+                auto hierarchy = details::makeVebIH(n);
+                std::vector<bool> used(hierarchy.getCapacity(), false);
+                for (int i = 0; i < n; ++i)
+                {
+                    auto* node = hierarchy.access(static_cast<size_t>(i));
+                    const size_t position = hierarchy.positionOf(static_cast<size_t>(i));
+                    bijective = bijective && node->data_ == i && !used[position] && hierarchy.indexOf(*node) == static_cast<size_t>(i);
+                    used[position] = true;
+                }
+            }
+            this->assert_true(bijective, "Layout is a bijection.");
+        }
+    };
+
+    /**
+     * @brief Tests that navigation matches the BFS implicit hierarchy.
+     */
+    class VebImplicitHierarchyTestNavigation : public LeafTest
+    {
+    public:
+        VebImplicitHierarchyTestNavigation() :
+            LeafTest("navigation")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 1000;
+            auto veb = details::makeVebIH(n);
+            amt::BinaryIH<int> bfs;
+            for (int i = 0; i < n; ++i)
+            {
+                bfs.insertLastLeaf().data_ = i;
+            }
+
+            bool same = true;
+            for (int i = 0; i < n; ++i)
+            {
+                auto* vebNode = veb.access(static_cast<size_t>(i));
+                auto* bfsNode = bfs.accessRoot() + i;
+                auto* vebParent = veb.accessParent(*vebNode);
+                auto* bfsParent = bfs.accessParent(*bfsNode);
+                same = same && (vebParent == nullptr) == (bfsParent == nullptr);
+                same = same && (vebParent == nullptr || vebParent->data_ == bfsParent->data_);
+                same = same && veb.degree(*vebNode) == bfs.degree(*bfsNode);
+                same = same && veb.level(*vebNode) == bfs.level(*bfsNode);
+                for (size_t sonOrder = 0; sonOrder < 2; ++sonOrder)
+                {
+                    auto* vebSon = veb.accessSon(*vebNode, sonOrder);
+                    auto* bfsSon = bfs.accessSon(*bfsNode, sonOrder);
+                    same = same && (vebSon == nullptr) == (bfsSon == nullptr);
+                    same = same && (vebSon == nullptr || vebSon->data_ == bfsSon->data_);
+                }
+            }
+            this->assert_true(same, "Parents, sons, degrees and levels match.");
+            this->assert_equals(static_cast<size_t>(n), veb.nodeCount());
+
+            std::vector<int> preOrder;
+            veb.processPreOrder(veb.accessRoot(), [&preOrder](const amt::MemoryBlock<int>* b)
+                {
+                    preOrder.push_back(b->data_);
+                });
+            std::vector<int> expected;
+            bfs.processPreOrder(bfs.accessRoot(), [&expected](const amt::MemoryBlock<int>* b)
+                {
+                    expected.push_back(b->data_);
+                });
+            this->assert_true(preOrder == expected, "Pre-order matches.");
+
+            bool walked = true;
+            for (size_t path = 0; path < 64; ++path)
+            {
+                amt::VebImplicitHierarchy<int>::PathWalker walker(veb);
+                size_t remaining = path;
+                while (walker.goToSon(remaining & 1))
+                {
+                    remaining >>= 1;
+                    walked = walked && walker.accessCurrent() == veb.access(walker.getIndex());
+                    walked = walked && walker.accessCurrent()->data_ == static_cast<int>(walker.getIndex());
+                }
+                walked = walked && veb.degree(walker.getIndex()) < 2 && walker.getLevel() >= 8;
+                while (walker.goToParent())
+                {
+                    walked = walked && walker.accessCurrent() == veb.access(walker.getIndex());
+                }
+                walked = walked && walker.accessCurrent() == veb.accessRoot();
+            }
+            this->assert_true(walked, "Path walker visits the same nodes as random access.");
+        }
+    };
+
+    /**
+     * @brief Tests insertion and removal across layout changes.
+     */
+    class VebImplicitHierarchyTestInsertRemove : public LeafTest
+    {
+    public:
+        VebImplicitHierarchyTestInsertRemove() :
+            LeafTest("insert-remove")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 300;
+            auto hierarchy = details::makeVebIH(n);
+            this->assert_equals(static_cast<size_t>(9), hierarchy.getHeight());
+            this->assert_equals(n - 1, hierarchy.accessLastLeaf()->data_);
+
+            bool intact = true;
+            for (int i = n - 1; i >= 0; --i)
+            {
+                this->assert_equals(i, hierarchy.accessLastLeaf()->data_);
+                hierarchy.removeLastLeaf();
+                for (int j = 0; j < i; j += 7)
+                {
+                    intact = intact && hierarchy.access(static_cast<size_t>(j))->data_ == j;
+                }
+            }
+            this->assert_true(intact, "Remaining nodes survive shrinking.");
+            this->assert_true(hierarchy.isEmpty(), "Hierarchy is empty.");
+            this->assert_equals(static_cast<size_t>(0), hierarchy.getHeight());
+            this->assert_null(hierarchy.accessRoot());
+            this->assert_throws([&hierarchy]() { hierarchy.removeLastLeaf(); });
+        }
+    };
+
+    /**
+     * @brief Tests copy, assignment and comparison.
+     */
+    class VebImplicitHierarchyTestCopyAssign : public LeafTest
+    {
+    public:
+        VebImplicitHierarchyTestCopyAssign() :
+            LeafTest("copy-assign")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto hierarchy = details::makeVebIH(50);
+            amt::VebImplicitHierarchy<int> copy(hierarchy);
+            this->assert_true(hierarchy.equals(copy), "Copy is equal.");
+
+            amt::VebImplicitHierarchy<int> assigned;
+            assigned.assign(hierarchy);
+            this->assert_true(hierarchy.equals(assigned), "Assigned hierarchy is equal.");
+
+            assigned.accessLastLeaf()->data_ = -1;
+            this->assert_false(hierarchy.equals(assigned), "Modified hierarchy is not equal.");
+
+            copy.removeLastLeaf();
+            this->assert_false(hierarchy.equals(copy), "Smaller hierarchy is not equal.");
+
+            adt::VebImplicitBinaryTree<int> tree;
+            this->assert_true(tree.isEmpty(), "Tree over the van Emde Boas hierarchy is empty.");
+        }
+    };
+
+    /**
+     * @brief All van Emde Boas implicit hierarchy tests.
+     */
+    class VebImplicitHierarchyTest : public CompositeTest
+    {
+    public:
+        VebImplicitHierarchyTest() :
+            CompositeTest("VebImplicitHierarchy")
+        {
+            this->add_test(std::make_unique<VebImplicitHierarchyTestLayout>());
+            this->add_test(std::make_unique<VebImplicitHierarchyTestNavigation>());
+            this->add_test(std::make_unique<VebImplicitHierarchyTestInsertRemove>());
+            this->add_test(std::make_unique<VebImplicitHierarchyTestCopyAssign>());
+        }
+    };
+}
@@ -0,0 +1,568 @@
+#pragma once
+
+#include <libds/amt/bit_matrix_network.h>
+#include <libds/amt/csr_network.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/graph/addressable_heap.h>
+#include <libds/graph/breadth_first_search.h>
+#include <libds/graph/connected_components.h>
+#include <libds/graph/edge_list.h>
+#include <libds/graph/shortest_paths.h>
+#include <libds/work_stealing_pool.h>
+#include <tests/_details/test.hpp>
+#include <tests/amt/network.test.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ds::tests
+{
+    namespace details
+    {
+        // Distances by a plain queue over the relations of the gate, -1 for unreached nodes.
+        template<class NetworkType>
+        std::vector<long> queueDistances(const NetworkType& network, size_t source)
+        {
+            std::vector<long> distances(network.size(), -1);
+            std::queue<size_t> queue;
+            distances[source] = 0;
+            queue.push(source);
+            while (!queue.empty())
+            {
+                const size_t node = queue.front();
+                queue.pop();
+                auto* block = network.accessNodeFromGate(node);
+                for (size_t order = 0; order < network.degree(*block); ++order)
+                {
+                    const size_t neighbour = network.accessNodeFromNode(*block, order)->gateIndex_;
+                    if (distances[neighbour] < 0)
+                    {
+                        distances[neighbour] = distances[node] + 1;
+                        queue.push(neighbour);
+                    }
+                }
+            }
+            return distances;
+        }
+
+        // Smallest index of the component of every node, found by plain searches in the order of the gate.
+        template<class NetworkType>
+        std::vector<std::uint32_t> searchedComponents(const NetworkType& network)
+        {
+            const std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+            std::vector<std::uint32_t> labels(network.size(), none);
+            for (size_t node = 0; node < network.size(); ++node)
+            {
+                if (labels[node] == none)
+                {
+                    const std::vector<long> distances = queueDistances(network, node);
+                    for (size_t reached = 0; reached < network.size(); ++reached)
+                    {
+                        if (distances[reached] >= 0)
+                        {
+                            labels[reached] = static_cast<std::uint32_t>(node);
+                        }
+                    }
+                }
+            }
+            return labels;
+        }
+
+        // Side by side grid whose node at (row, column) holds row * side + column.
+        inline amt::CsrNetwork<int> makeGrid(int side)
+        {
+            amt::IGIRNetwork<int> network;
+            std::vector<amt::IRNetworkBlock<int>*> nodes;
+            for (int i = 0; i < side * side; ++i)
+            {
+                nodes.push_back(&network.insert());
+                nodes.back()->data_ = i;
+            }
+            for (int row = 0; row < side; ++row)
+            {
+                for (int column = 0; column < side; ++column)
+                {
+                    if (column + 1 < side)
+                    {
+                        network.connect(*nodes[row * side + column], *nodes[row * side + column + 1]);
+                    }
+                    if (row + 1 < side)
+                    {
+                        network.connect(*nodes[row * side + column], *nodes[(row + 1) * side + column]);
+                    }
+                }
+            }
+            return network.freeze();
+        }
+
+        // Symmetric weight from 1 to 7, so the Manhattan distance never overestimates.
+        inline long gridWeight(const amt::MemoryBlock<int>& from, const amt::MemoryBlock<int>& to)
+        {
+            return 1 + (static_cast<long>(from.data_) * to.data_ + from.data_ + to.data_) % 7;
+        }
+
+        // Data of every node followed by gate indices of its relations in their order.
+        template<class NetworkType>
+        std::vector<std::vector<size_t>> relationIndices(const NetworkType& network)
+        {
+            std::vector<std::vector<size_t>> result(network.size());
+            for (size_t node = 0; node < network.size(); ++node)
+            {
+                auto* block = network.accessNodeFromGate(node);
+                result[node].push_back(static_cast<size_t>(block->data_));
+                for (size_t order = 0; order < network.degree(*block); ++order)
+                {
+                    result[node].push_back(network.accessNodeFromNode(*block, order)->gateIndex_);
+                }
+            }
+            return result;
+        }
+    }
+
+    /**
+     * @brief Tests the addressable heap against an ordered set of priorities and indices.
+     */
+    class GraphTestAddressableHeap : public LeafTest
+    {
+    public:
+        GraphTestAddressableHeap() :
+            LeafTest("addressable-heap")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const size_t capacity = 500;
+            graph::AddressableHeap<int> heap(capacity);
+            std::set<std::pair<int, size_t>> model;
+            std::vector<int> priorities(capacity, 0);
+            std::default_random_engine rng(144);
+
+            bool matches = true;
+            for (int i = 0; i < 20000; ++i)
+            {
+                const size_t index = rng() % capacity;
+                const int priority = static_cast<int>(rng() % 100000);
+                if (rng() % 3 == 0 && !model.empty())
+                {
+                    // Equal priorities may pop in any order.
+                    const int top = heap.priority(heap.peek());
+                    const size_t popped = heap.pop();
+                    matches = matches && model.begin()->first == top && model.erase({ top, popped }) == 1 && !heap.contains(popped);
+                }
+                else if (heap.contains(index))
+                {
+                    const bool decreased = heap.pushOrDecrease(index, priority);
+                    matches = matches && decreased == (priority < priorities[index]);
+                    if (decreased)
+                    {
+                        model.erase({ priorities[index], index });
+                        model.insert({ priority, index });
+                        priorities[index] = priority;
+                    }
+                }
+                else
+                {
+                    heap.push(index, priority);
+                    model.insert({ priority, index });
+                    priorities[index] = priority;
+                }
+                matches = matches && heap.size() == model.size() && (model.empty() || heap.priority(heap.peek()) == model.begin()->first);
+            }
+            this->assert_true(matches, "Heap pops indices in the order of priorities.");
+
+            // Equal priorities may pop in any order, so only the priorities are checked.
+            bool sorted = true;
+            int previous = -1;
+            while (!heap.isEmpty())
+            {
+                const int priority = heap.priority(heap.peek());
+                sorted = sorted && previous <= priority;
+                previous = priority;
+                heap.pop();
+            }
+            this->assert_true(sorted, "Remaining indices pop in the order of priorities.");
+
+            heap.push(3, 1);
+            this->assert_throws([&heap]() { heap.push(3, 0); });
+            this->assert_throws([&heap]() { heap.push(capacity, 0); });
+            heap.reset(capacity);
+            this->assert_true(heap.isEmpty() && !heap.contains(3), "Reset empties the heap.");
+            this->assert_throws([&heap]() { heap.pop(); });
+        }
+    };
+
+    /**
+     * @brief Tests distances and parents of serial and parallel searches against a plain queue.
+     */
+    class GraphTestBreadthFirstSearch : public LeafTest
+    {
+    public:
+        GraphTestBreadthFirstSearch() :
+            LeafTest("breadth-first-search")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            WorkStealingPool pool(4);
+            graph::BreadthFirstSearch search;
+            // Sparse networks stay top-down and have many components, dense networks switch to bottom-up.
+            const std::pair<int, int> shapes[] = { { 3000, 2500 }, { 5000, 40000 }, { 200, 150 }, { 4000, 20000 } };
+            for (const auto& [nodeCount, relationCount] : shapes)
+            {
+                amt::IGIRNetwork<int> network;
+                details::growRandomNetwork(network, nodeCount, relationCount);
+                const amt::CsrNetwork<int> snapshot = network.freeze();
+                for (WorkStealingPool* searchPool : { static_cast<WorkStealingPool*>(nullptr), &pool })
+                {
+                    for (size_t source : { size_t{ 0 }, static_cast<size_t>(nodeCount - 1) })
+                    {
+                        search.run(snapshot, source, searchPool);
+                        const std::vector<long> expected = details::queueDistances(network, source);
+                        bool distances = search.nodeCount() == snapshot.size();
+                        bool parents = true;
+                        size_t reached = 0;
+                        for (size_t node = 0; node < snapshot.size(); ++node)
+                        {
+                            const graph::BreadthFirstSearch::IndexType distance = search.distance(node);
+                            distances = distances && (expected[node] < 0 ? distance == graph::BreadthFirstSearch::UNREACHED : distance == expected[node]);
+                            if (expected[node] > 0)
+                            {
+                                const size_t parent = search.parent(node);
+                                parents = parents && search.distance(parent) + 1 == distance &&
+                                          snapshot.relationExists(*snapshot.accessNodeFromGate(parent), *snapshot.accessNodeFromGate(node));
+                            }
+                            reached += expected[node] < 0 ? 0 : 1;
+                        }
+                        this->assert_true(distances, "Distances match a plain search.");
+                        this->assert_true(parents, "Parents lie one level closer to the source.");
+                        this->assert_equals(reached, search.reachedCount());
+                        this->assert_equals(source, static_cast<size_t>(search.parent(source)));
+                    }
+                }
+                if (relationCount > 4 * nodeCount)
+                {
+                    this->assert_true(search.bottomUpLevelCount() > 0, "Dense network is searched bottom-up.");
+                }
+            }
+
+            // Explicit gate is searched through its snapshot.
+            amt::EGERNetwork<int> explicitNetwork;
+            details::growRandomNetwork(explicitNetwork, 500, 3000);
+            const amt::CsrNetwork<int> explicitSnapshot = explicitNetwork.freeze();
+            search.run(explicitSnapshot, 7);
+            const std::vector<long> expected = details::queueDistances(explicitNetwork, 7);
+            bool distances = true;
+            for (size_t node = 0; node < explicitNetwork.size(); ++node)
+            {
+                distances = distances && (expected[node] < 0 ? search.distance(node) == graph::BreadthFirstSearch::UNREACHED : search.distance(node) == expected[node]);
+            }
+            this->assert_true(distances, "Distances in an explicit gate match a plain search.");
+            this->assert_throws([&search, &explicitSnapshot]() { search.run(explicitSnapshot, explicitSnapshot.size()); });
+            this->assert_throws([&search, &explicitSnapshot]() { search.distance(explicitSnapshot.size()); });
+
+            // Bit matrix is searched by a function listing the related nodes.
+            amt::BitMatrixNetwork<int> matrix;
+            details::growRandomNetwork(matrix, 300, 600);
+            auto neighbours = [&matrix](size_t node, auto visit)
+                {
+                    const auto& block = *matrix.accessNodeFromGate(node);
+                    for (size_t order = 0; order < matrix.degree(block); ++order)
+                    {
+                        visit(matrix.accessNodeFromNode(block, order)->gateIndex_);
+                    }
+                };
+            search.run(matrix.size(), 3, neighbours);
+            const std::vector<long> matrixExpected = details::queueDistances(matrix, 3);
+            bool matrixDistances = true;
+            size_t reached = 0;
+            long farthest = 0;
+            for (size_t node = 0; node < matrix.size(); ++node)
+            {
+                matrixDistances = matrixDistances && (matrixExpected[node] < 0 ? search.distance(node) == graph::BreadthFirstSearch::UNREACHED : search.distance(node) == matrixExpected[node]);
+                reached += matrixExpected[node] < 0 ? 0 : 1;
+                farthest = std::max(farthest, matrixExpected[node]);
+            }
+            this->assert_true(matrixDistances, "Distances in a bit matrix match a plain search.");
+            this->assert_equals(reached, search.reachedCount());
+            this->assert_equals(static_cast<size_t>(farthest + 1), search.levelCount());
+            this->assert_throws([&search, &matrix, neighbours]() { search.run(matrix.size(), matrix.size(), neighbours); });
+        }
+    };
+
+    /**
+     * @brief Tests Dijkstra against relaxation of all relations and A* against Dijkstra on a grid.
+     */
+    class GraphTestShortestPaths : public LeafTest
+    {
+    public:
+        GraphTestShortestPaths() :
+            LeafTest("shortest-paths")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int side = 30;
+            const amt::CsrNetwork<int> grid = details::makeGrid(side);
+            graph::ShortestPaths<long> dijkstra;
+            dijkstra.dijkstra(grid, 0, details::gridWeight);
+
+            // Relaxes every relation until nothing changes.
+            std::vector<long> expected(grid.size(), graph::ShortestPaths<long>::INFINITE);
+            expected[0] = 0;
+            for (bool changed = true; changed;)
+            {
+                changed = false;
+                for (size_t node = 0; node < grid.size(); ++node)
+                {
+                    const amt::MemoryBlock<int>& from = *grid.accessNodeFromGate(node);
+                    grid.processNeighbours(from, [&](amt::MemoryBlock<int>* to)
+                        {
+                            const size_t neighbour = grid.indexOf(*to);
+                            if (expected[node] != graph::ShortestPaths<long>::INFINITE && expected[node] + details::gridWeight(from, *to) < expected[neighbour])
+                            {
+                                expected[neighbour] = expected[node] + details::gridWeight(from, *to);
+                                changed = true;
+                            }
+                        });
+                }
+            }
+            bool distances = true;
+            for (size_t node = 0; node < grid.size(); ++node)
+            {
+                distances = distances && dijkstra.distance(node) == expected[node];
+            }
+            this->assert_true(distances, "Dijkstra finds the shortest distances.");
+            this->assert_equals(grid.size(), dijkstra.settledCount());
+
+            graph::ShortestPaths<long> aStar;
+            std::default_random_engine rng(144);
+            bool paths = true;
+            bool fewer = true;
+            for (int i = 0; i < 50; ++i)
+            {
+                const size_t target = rng() % grid.size();
+                auto manhattan = [side, target](const amt::MemoryBlock<int>& node)
+                    {
+                        return static_cast<long>(std::abs(node.data_ / side - static_cast<int>(target) / side) + std::abs(node.data_ % side - static_cast<int>(target) % side));
+                    };
+                paths = paths && aStar.aStar(grid, 0, target, details::gridWeight, manhattan) && aStar.distance(target) == expected[target];
+                fewer = fewer && aStar.settledCount() <= dijkstra.settledCount();
+
+                const std::vector<size_t> path = aStar.path(target);
+                long length = 0;
+                for (size_t j = 1; j < path.size(); ++j)
+                {
+                    const amt::MemoryBlock<int>& from = *grid.accessNodeFromGate(path[j - 1]);
+                    const amt::MemoryBlock<int>& to = *grid.accessNodeFromGate(path[j]);
+                    paths = paths && grid.relationExists(from, to);
+                    length += details::gridWeight(from, to);
+                }
+                paths = paths && !path.empty() && path.front() == 0 && path.back() == target && length == expected[target];
+            }
+            this->assert_true(paths, "A* finds shortest paths.");
+            this->assert_true(fewer, "A* settles at most the nodes of Dijkstra.");
+
+            //  0 - 1   2
+            const amt::CsrNetwork<int> split({ 0, 1, 2 }, { 0, 1, 2, 2 }, { 1, 0 });
+            auto unit = [](const amt::MemoryBlock<int>&, const amt::MemoryBlock<int>&) { return 1L; };
+            auto zero = [](const amt::MemoryBlock<int>&) { return 0L; };
+            this->assert_false(aStar.aStar(split, 0, 2, unit, zero), "Unrelated target is not reached.");
+            this->assert_true(aStar.path(2).empty(), "Unreached target has no path.");
+            this->assert_equals(1L, aStar.distance(1));
+            auto negative = [](const amt::MemoryBlock<int>&, const amt::MemoryBlock<int>&) { return -1L; };
+            this->assert_throws([&aStar, &split, negative]() { aStar.dijkstra(split, 0, negative); });
+            this->assert_throws([&aStar, &split, unit, zero]() { aStar.aStar(split, 0, 3, unit, zero); });
+
+            // Grid given by a function listing the related nodes with their weights.
+            graph::ShortestPaths<long> listed;
+            listed.dijkstra(grid.size(), 0, [&grid](size_t node, auto& relax)
+                {
+                    const amt::MemoryBlock<int>* nodes = grid.accessNodeFromGate(0);
+                    const auto* last = grid.endNeighbours(nodes[node]);
+                    for (const auto* neighbour = grid.beginNeighbours(nodes[node]); neighbour != last; ++neighbour)
+                    {
+                        relax(*neighbour, details::gridWeight(nodes[node], nodes[*neighbour]));
+                    }
+                });
+            bool listedDistances = true;
+            for (size_t node = 0; node < grid.size(); ++node)
+            {
+                listedDistances = listedDistances && listed.distance(node) == expected[node];
+            }
+            this->assert_true(listedDistances, "Dijkstra over listed relations matches relaxation.");
+            this->assert_throws([&listed]() { listed.dijkstra(2, 0, [](size_t, auto& relax) { relax(1, -1L); }); });
+        }
+    };
+
+    /**
+     * @brief Tests serial and parallel components of networks and snapshots against plain searches.
+     */
+    class GraphTestConnectedComponents : public LeafTest
+    {
+    public:
+        GraphTestConnectedComponents() :
+            LeafTest("connected-components")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            WorkStealingPool pool(4);
+            const std::pair<int, int> shapes[] = { { 3000, 1500 }, { 5000, 40000 }, { 300, 290 } };
+            for (const auto& [nodeCount, relationCount] : shapes)
+            {
+                amt::IGIRNetwork<int> network;
+                details::growRandomNetwork(network, nodeCount, relationCount);
+                const amt::CsrNetwork<int> snapshot = network.freeze();
+                const std::vector<std::uint32_t> expected = details::searchedComponents(network);
+                this->assert_true(graph::connectedComponents(snapshot) == expected, "Serial components of a snapshot match.");
+                this->assert_true(graph::connectedComponents(snapshot, &pool) == expected, "Parallel components of a snapshot match.");
+                this->assert_true(graph::connectedComponents(network) == expected, "Serial components of a network match.");
+                this->assert_true(graph::connectedComponents(network, &pool) == expected, "Parallel components of a network match.");
+            }
+
+            // A long path connected in random order would overflow a recursive search.
+            const int pathLength = 200000;
+            amt::EGERNetwork<int> path;
+            std::vector<amt::ERNetworkBlock<int>*> nodes;
+            std::vector<int> order;
+            for (int i = 0; i < pathLength; ++i)
+            {
+                nodes.push_back(&path.insert());
+                nodes.back()->data_ = i;
+                order.push_back(i);
+            }
+            std::shuffle(order.begin(), order.end() - 1, std::default_random_engine(144));
+            for (auto it = order.begin(); it != order.end() - 1; ++it)
+            {
+                path.connect(*nodes[*it], *nodes[*it + 1]);
+            }
+            const std::vector<std::uint32_t> serial = graph::connectedComponents(path);
+            this->assert_equals(static_cast<size_t>(1), graph::componentCount(serial));
+            this->assert_true(serial == graph::connectedComponents(path, &pool), "Parallel components of a path match.");
+
+            amt::IGIRNetwork<int> empty;
+            this->assert_true(graph::connectedComponents(empty).empty(), "Empty network has no components.");
+        }
+    };
+
+    /**
+     * @brief Tests serial and sharded loads of text and binary edge lists against networks connected relation by relation.
+     */
+    class GraphTestEdgeList : public LeafTest
+    {
+    public:
+        GraphTestEdgeList() :
+            LeafTest("edge-list")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const std::filesystem::path directory = std::filesystem::temp_directory_path();
+            const std::string textPath = (directory / "ds-edge-list-test.txt").string();
+            const std::string binaryPath = (directory / "ds-edge-list-test.bin").string();
+
+            // Relations with loops and duplicates, nodes 0 and 1 stay isolated.
+            const std::uint32_t nodeCount = 3000;
+            std::default_random_engine rng(144);
+            std::vector<std::uint32_t> relations;
+            for (int i = 0; i < 20000; ++i)
+            {
+                const std::uint32_t from = 2 + rng() % (nodeCount - 2);
+                relations.push_back(from);
+                relations.push_back(i % 100 == 0 ? from : 2 + static_cast<std::uint32_t>(rng() % (nodeCount - 2)));
+            }
+            relations.back() = nodeCount - 1;
+
+            {
+                std::ofstream text(textPath, std::ios::binary);
+                text << "# comment\n% comment\n\n";
+                for (size_t i = 0; i < relations.size(); i += 2)
+                {
+                    text << relations[i] << (i % 3 == 0 ? "\t" : " ") << relations[i + 1] << (i % 5 == 0 ? " 1.5\r\n" : "\n");
+                }
+                std::ofstream binary(binaryPath, std::ios::binary);
+                binary.write(reinterpret_cast<const char*>(relations.data()), static_cast<std::streamsize>(relations.size() * sizeof(std::uint32_t)));
+            }
+
+            amt::IGIRNetwork<int> incremental;
+            for (std::uint32_t i = 0; i < nodeCount; ++i)
+            {
+                incremental.insert().data_ = static_cast<int>(i);
+            }
+            for (size_t i = 0; i < relations.size(); i += 2)
+            {
+                incremental.connect(*incremental.accessNodeFromGate(relations[i]), *incremental.accessNodeFromGate(relations[i + 1]));
+            }
+            const std::vector<std::vector<size_t>> expected = details::relationIndices(incremental);
+
+            WorkStealingPool pool(4);
+            for (const std::string& path : { textPath, binaryPath })
+            {
+                const graph::EdgeListFormat format = path == textPath ? graph::EdgeListFormat::Text : graph::EdgeListFormat::Binary;
+                for (WorkStealingPool* shards : { static_cast<WorkStealingPool*>(nullptr), &pool })
+                {
+                    amt::IGIRNetwork<int> implicitNetwork;
+                    graph::loadEdgeList(implicitNetwork, path, format, shards);
+                    this->assert_true(details::relationIndices(implicitNetwork) == expected, "Loaded implicit relations match.");
+                    amt::EGERNetwork<int> explicitNetwork;
+                    graph::loadEdgeList(explicitNetwork, path, format, shards);
+                    this->assert_true(details::relationIndices(explicitNetwork) == expected, "Loaded explicit relations match.");
+                }
+            }
+
+            this->assert_throws([&incremental, &textPath]() { graph::loadEdgeList(incremental, textPath, graph::EdgeListFormat::Text); });
+            amt::IGIRNetwork<int> empty;
+            this->assert_throws([&empty, &textPath]() { graph::loadEdgeList(empty, textPath + ".missing", graph::EdgeListFormat::Text); });
+            {
+                std::ofstream text(textPath, std::ios::binary);
+                text << "1 2\n3 x\n";
+                std::ofstream binary(binaryPath, std::ios::binary);
+                binary << "12345";
+            }
+            this->assert_throws([&empty, &textPath]() { graph::loadEdgeList(empty, textPath, graph::EdgeListFormat::Text); });
+            this->assert_throws([&empty, &binaryPath]() { graph::loadEdgeList(empty, binaryPath, graph::EdgeListFormat::Binary); });
+            this->assert_true(empty.isEmpty(), "Failed load leaves the network empty.");
+
+            std::filesystem::remove(textPath);
+            std::filesystem::remove(binaryPath);
+        }
+    };
+
+    /**
+     * @brief All graph algorithm tests.
+     */
+    class GraphTest : public CompositeTest
+    {
+    public:
+        GraphTest() :
+            CompositeTest("graph")
+        {
+            this->add_test(std::make_unique<GraphTestAddressableHeap>());
+            this->add_test(std::make_unique<GraphTestBreadthFirstSearch>());
+            this->add_test(std::make_unique<GraphTestShortestPaths>());
+            this->add_test(std::make_unique<GraphTestConnectedComponents>());
+            this->add_test(std::make_unique<GraphTestEdgeList>());
+        }
+    };
+}
@@ -3,6 +3,8 @@
 #include <tests/_details/test.hpp>
 #include <libds/mm/compact_memory_manager.h>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace ds::tests
 {
@@ -258,6 +260,84 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests sharing of the buffer by copy-on-write copies.
+     */
+    class CompactMemoryManagerTestCopyOnWrite : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestCopyOnWrite() :
+            LeafTest("copyOnWrite")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 10;
+
+            mm::CompactMemoryManager<DummyData> manager1;
+            manager1.setCopyOnWrite(true);
+            for (int i = 0; i < n; ++i)
+            {
+                manager1.allocateMemory()->set_number(i);
+            }
+
+            mm::CompactMemoryManager<DummyData> manager2(manager1);
+            const mm::CompactMemoryManager<DummyData>& reader1 = manager1;
+            const mm::CompactMemoryManager<DummyData>& reader2 = manager2;
+            this->assert_true(manager1.isShared() && manager2.isShared(), "Copy shares the buffer.");
+            this->assert_true(&reader1.getBlockAt(3) == &reader2.getBlockAt(3), "Reading does not copy.");
+            this->assert_true(manager1.equals(manager2), "Copy equals original.");
+
+            for (int i = 0; i < n; ++i)
+            {
+                manager1.getBlockAt(i).set_number(-1);
+            }
+            this->assert_false(manager1.isShared() || manager2.isShared(), "Mutation detaches the buffer.");
+            for (int i = 0; i < n; ++i)
+            {
+                this->assert_equals(manager2.getBlockAt(i).get_number(), i, "Copy keeps its data");
+            }
+
+            mm::CompactMemoryManager<DummyData> manager3;
+            manager3.assign(manager2);
+            manager3.releaseMemoryAt(0);
+            manager3.allocateMemory()->set_number(n);
+            this->assert_equals(static_cast<size_t>(n), manager2.getAllocatedBlockCount());
+            this->assert_equals(0, manager2.getBlockAt(0).get_number());
+            this->assert_equals(1, manager3.getBlockAt(0).get_number());
+            this->assert_equals(n, manager3.getBlockAt(n - 1).get_number());
+
+            manager2.setCopyOnWrite(false);
+            mm::CompactMemoryManager<DummyData> manager4(manager2);
+            this->assert_false(manager4.isShared(), "Copy of a plain manager is deep.");
+
+            // Snapshots copied, detached and destroyed on other threads leave the original intact.
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t)
+            {
+                threads.emplace_back([&manager3, t]()
+                    {
+                        for (int i = 0; i < 1000; ++i)
+                        {
+                            mm::CompactMemoryManager<DummyData> snapshot(manager3);
+                            if ((i + t) % 2 == 0)
+                            {
+                                snapshot.getBlockAt(0).set_number(-1);
+                            }
+                        }
+                    });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            this->assert_false(manager3.isShared(), "Snapshots of other threads are released.");
+            this->assert_equals(1, manager3.getBlockAt(0).get_number());
+        }
+    };
+
     class CompactMemoryManagerTestEquals : public LeafTest
     {
     public:
@@ -397,6 +477,7 @@ namespace ds::tests
             this->add_test(std::make_unique<CompactMemoryManagerTestReleaseAt>());
             this->add_test(std::make_unique<CompactMemoryManagerTestReleasePtr>());
             this->add_test(std::make_unique<CompactMemoryManagerTestAssign>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestCopyOnWrite>());
             this->add_test(std::make_unique<CompactMemoryManagerTestEquals>());
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateAddress>());
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateIndex>());
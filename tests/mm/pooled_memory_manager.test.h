@@ -0,0 +1,122 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/pooled_memory_manager.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace ds::tests
+{
+    class PooledMemoryManagerTestReuse : public LeafTest
+    {
+    public:
+        PooledMemoryManagerTestReuse() :
+            LeafTest("reuse")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PooledMemoryManager<int> manager(4);
+            std::vector<int*> elems;
+            for (int i = 0; i < 10; ++i)
+            {
+                elems.push_back(manager.allocateMemory());
+                *elems.back() = i;
+            }
+
+            this->assert_equals(static_cast<size_t>(10), manager.getAllocatedBlockCount());
+            this->assert_equals(static_cast<size_t>(3), manager.getChunkCount());
+
+            int* released = elems[5];
+            manager.releaseMemory(released);
+            this->assert_true(manager.allocateMemory() == released, "Released block is reused.");
+            this->assert_equals(static_cast<size_t>(10), manager.getAllocatedBlockCount());
+            this->assert_equals(9, *elems[9]);
+
+            for (int* elem : elems)
+            {
+                manager.releaseMemory(elem);
+            }
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+        }
+    };
+
+    class PooledMemoryManagerTestReserve : public LeafTest
+    {
+    public:
+        PooledMemoryManagerTestReserve() :
+            LeafTest("reserve")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PooledMemoryManager<int> manager(4);
+            int* first = manager.allocateMemory();
+            int* second = manager.allocateMemory();
+            manager.releaseMemory(first);
+
+            manager.reserve(10);
+            int* previous = manager.allocateMemory();
+            bool contiguous = previous != first;
+            for (int i = 1; i < 10; ++i)
+            {
+                int* current = manager.allocateMemory();
+                contiguous = contiguous && current == previous + 1;
+                previous = current;
+            }
+            this->assert_true(contiguous, "Reserved blocks are contiguous and skip released ones.");
+            this->assert_equals(static_cast<size_t>(2), manager.getChunkCount());
+            this->assert_equals(static_cast<size_t>(11), manager.getAllocatedBlockCount());
+            manager.releaseMemory(second);
+        }
+    };
+
+    class PooledMemoryManagerTestTransfer : public LeafTest
+    {
+    public:
+        PooledMemoryManagerTestTransfer() :
+            LeafTest("transfer")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PooledMemoryManager<int> pool;
+            mm::MemoryManager<int> manager;
+            int* ip = pool.allocateMemory();
+
+            bool thrown = false;
+            try
+            {
+                pool.transferOwnership(manager, 1);
+            }
+            catch (const std::logic_error&)
+            {
+                thrown = true;
+            }
+
+            this->assert_true(thrown, "Pooled blocks cannot be transferred.");
+            this->assert_equals(static_cast<size_t>(1), pool.getAllocatedBlockCount());
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+            pool.releaseMemory(ip);
+        }
+    };
+
+    class PooledMemoryManagerTest : public CompositeTest
+    {
+    public:
+        PooledMemoryManagerTest() :
+            CompositeTest("PooledMemoryManager")
+        {
+            this->add_test(std::make_unique<PooledMemoryManagerTestReuse>());
+            this->add_test(std::make_unique<PooledMemoryManagerTestReserve>());
+            this->add_test(std::make_unique<PooledMemoryManagerTestTransfer>());
+        }
+    };
+}
@@ -3,6 +3,7 @@
 #include <tests/_details/test.hpp>
 #include <tests/adt/adt.test.h>
 #include <tests/amt/amt.test.h>
+#include <tests/graph/graph.test.h>
 #include <tests/mm/mm.test.h>
 #include <memory>
 
@@ -17,6 +18,7 @@ namespace ds::tests
             this->add_test(std::make_unique<MMTest>());
             this->add_test(std::make_unique<AMTTest>());
             this->add_test(std::make_unique<ADTTest>());
+            this->add_test(std::make_unique<GraphTest>());
         }
     };
 }